@@ -4,9 +4,26 @@
 #include "Angle/Angle.hpp"
 
 #include "Quaternion/Quaternion.hpp"
+#include "Quaternion/QuaternionBatch.hpp"
+#include "Matrix/Space/TransformHierarchy.hpp"
+#include "Types/Expression.hpp"
+#include "Matrix/DynamicMatrix.hpp"
+#include "Matrix/LinearSolver.hpp"
+#include "Matrix/Matrix3Decomposition.hpp"
+#include "Quaternion/Skinning.hpp"
+#include "Angle/EulerAngel.hpp"
+#include "Collision/DynamicAABBTree.hpp"
+#include "Collision/SweepAndPrune.hpp"
+#include "Collision/NarrowPhaseDispatcher.hpp"
+#include "Collision/NarrowPhaseTests.hpp"
+#include "Collision/OrientedBoxSAT.hpp"
+#include "Collision/SegmentSlabTest.hpp"
 
 #include <stdlib.h>     /* std::rand, std::rand */
+#include <vector>       /* std::vector */
+#include <memory>       /* std::unique_ptr */
 #include <time.h>       /* time */
+#include <cmath>        /* std::cbrt */
 
 using namespace FoxMath;
 
@@ -20,7 +37,7 @@ static void BM_QuaternionV1(benchmark::State& state)
         Vector3<> vec {5.f, 10.f, 6.f};
         Vector3<> axis {0.f, 0.5f, 0.5f};
         axis.normalize();
-        Quaternion<>::RotateVector(vec, axis, 3_rad);
+        Quaternion<>::rotateVector(vec, axis, 3_rad);
 
         benchmark::DoNotOptimize(vec);
         benchmark::ClobberMemory();
@@ -36,7 +53,7 @@ static void BM_QuaternionV2(benchmark::State& state)
         Vector3<> vec {5.f, 10.f, 6.f};
         Vector3<> axis {0.f, 0.5f, 0.5f};
         axis.normalize();
-        Quaternion<>::RotateVector2(vec, axis, 3_rad);
+        Quaternion<>::rotateVector2(vec, axis, 3_rad);
 
         benchmark::DoNotOptimize(vec);
         benchmark::ClobberMemory();
@@ -45,6 +62,186 @@ static void BM_QuaternionV2(benchmark::State& state)
 // Register the function as a benchmark
 BENCHMARK(BM_QuaternionV2);
 
+/*Reference : q * v * q^-1 with two Hamilton products*/
+static void BM_QuaternionRotateVectorHamilton(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  Quaternion<float> quat (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+  quat.normalize();
+  const std::vector<Vec3f> vectors (static_cast<size_t>(state.range(0)), Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+  std::vector<Vec3f> rst (vectors.size());
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < vectors.size(); i++)
+        {
+          rst[i] = (quat * vectors[i] * quat.getInverse()).getXYZ();
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QuaternionRotateVectorHamilton)->Arg(1024);
+
+static void BM_QuaternionRotateVector(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  Quaternion<float> quat (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+  quat.normalize();
+  const std::vector<Vec3f> vectors (static_cast<size_t>(state.range(0)), Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+  std::vector<Vec3f> rst (vectors.size());
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < vectors.size(); i++)
+        {
+          rst[i] = vectors[i];
+          quat.rotateVector(rst[i]);
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QuaternionRotateVector)->Arg(1024);
+
+static void BM_QuaternionRotateVectors(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  Quaternion<float> quat (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+  quat.normalize();
+  const std::vector<Vec3f> vectors (static_cast<size_t>(state.range(0)), Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+  std::vector<Vec3f> rst (vectors.size());
+
+  for (auto _ : state)
+  {
+        quat.rotateVectors(vectors.data(), rst.data(), vectors.size());
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QuaternionRotateVectors)->Arg(1024)->Arg(1 << 20)->UseRealTime();
+
+static void BM_QuaternionRotateVectorsPairwise(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  std::vector<Quaternion<float>> quats;
+  quats.reserve(static_cast<size_t>(state.range(0)));
+
+  for (size_t i = 0; i < static_cast<size_t>(state.range(0)); i++)
+  {
+    quats.emplace_back(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+    quats.back().normalize();
+  }
+
+  const std::vector<Vec3f> vectors (quats.size(), Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+  std::vector<Vec3f> rst (vectors.size());
+
+  for (auto _ : state)
+  {
+        Quaternion<float>::rotateVectorsPairwise(quats.data(), vectors.data(), rst.data(), vectors.size());
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QuaternionRotateVectorsPairwise)->Arg(1024)->Arg(1 << 20)->UseRealTime();
+
+static std::vector<Quaternion<float>> createRandomUnitQuaternions(size_t count)
+{
+  std::vector<Quaternion<float>> quats;
+  quats.reserve(count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    quats.emplace_back(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+    quats.back().normalize();
+  }
+
+  return quats;
+}
+
+static void BM_QuaternionSLerp(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const std::vector<Quaternion<float>> starts = createRandomUnitQuaternions(static_cast<size_t>(state.range(0)));
+  const std::vector<Quaternion<float>> ends   = createRandomUnitQuaternions(starts.size());
+  std::vector<Quaternion<float>> rst (starts);
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < rst.size(); i++)
+        {
+          rst[i].sLerp(starts[i], ends[i], 0.3f);
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QuaternionSLerp)->Arg(1024)->Arg(1 << 16);
+
+static void BM_QuaternionBatchSLerp(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const std::vector<Quaternion<float>> starts = createRandomUnitQuaternions(static_cast<size_t>(state.range(0)));
+  const std::vector<Quaternion<float>> ends   = createRandomUnitQuaternions(starts.size());
+  const QuaternionBatch<float> startBatch (starts.data(), starts.size());
+  const QuaternionBatch<float> endBatch (ends.data(), ends.size());
+  QuaternionBatch<float> rst (starts.size());
+
+  for (auto _ : state)
+  {
+        rst.sLerp(startBatch, endBatch, 0.3f);
+
+        benchmark::DoNotOptimize(rst.getStream(0));
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QuaternionBatchSLerp)->Arg(1024)->Arg(1 << 16);
+
+static void BM_QuaternionBatchNLerp(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const std::vector<Quaternion<float>> starts = createRandomUnitQuaternions(static_cast<size_t>(state.range(0)));
+  const std::vector<Quaternion<float>> ends   = createRandomUnitQuaternions(starts.size());
+  const QuaternionBatch<float> startBatch (starts.data(), starts.size());
+  const QuaternionBatch<float> endBatch (ends.data(), ends.size());
+  QuaternionBatch<float> rst (starts.size());
+
+  for (auto _ : state)
+  {
+        rst.nLerp(startBatch, endBatch, 0.3f);
+
+        benchmark::DoNotOptimize(rst.getStream(0));
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QuaternionBatchNLerp)->Arg(1024)->Arg(1 << 16);
+
 static void BM_NewReverseMatrixAtCompileTime(benchmark::State& state) 
 {
   for (auto _ : state)
@@ -62,107 +259,1367 @@ static void BM_NewReverseMatrixAtCompileTime(benchmark::State& state)
 // Register the function as a benchmark
 BENCHMARK(BM_NewReverseMatrixAtCompileTime);
 
-static void BM_NewReverseMatrixAtRunTime(benchmark::State& state) 
+template <bool TBatch>
+static void BM_Matrix3SVD(benchmark::State& state) 
 {
   std::srand (time(NULL));
 
+  const size_t count = static_cast<size_t>(state.range(0));
+
+  std::vector<Matrix3<float>> matrices (count);
+  std::vector<SVD3<float>> rst (count);
+
+  for (Matrix3<float>& mat : matrices)
+    for (size_t i = 0; i < 9; i++)
+      mat.getData(i) = RAND_FLOAT;
+
   for (auto _ : state)
   {
-        SquareMatrix<3, float, EMatrixConvention::ColumnMajor> rst (  RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, 
-                                                                      RAND_FLOAT, RAND_FLOAT, RAND_FLOAT,
-                                                                      RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
-
-        rst.reverse();
+        if constexpr (TBatch)
+        {
+          computeSVD(matrices.data(), rst.data(), count);
+        }
+        else
+        {
+          for (size_t i = 0; i < count; i++)
+            rst[i] = getSVD(matrices[i]);
+        }
 
-        benchmark::DoNotOptimize(rst);
+        benchmark::DoNotOptimize(rst.data());
         benchmark::ClobberMemory();
   }
+
+  state.SetItemsProcessed(state.iterations() * count);
 }
-// Register the function as a benchmark
-BENCHMARK(BM_NewReverseMatrixAtRunTime);
+BENCHMARK_TEMPLATE(BM_Matrix3SVD, false)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_Matrix3SVD, true)->Arg(4096);
 
-// Define another benchmark
-/*
-static void BM_OldReverseMatrixAtRunTime(benchmark::State& state)
+template <bool TBatch>
+static void BM_Matrix4DecomposeTRS(benchmark::State& state)
 {
   std::srand (time(NULL));
 
+  const size_t count = static_cast<size_t>(state.range(0));
+
+  std::vector<Matrix4<float>> matrices;
+  std::vector<TRSDecomposition<float>> rst (count);
+  matrices.reserve(count);
+
+  for (size_t i = 0; i < count; i++)
+    matrices.push_back(Matrix4<float>::createTRSMatrix(Vec3<float>(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT), Vec3<float>(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT), Vec3<float>(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT)));
+
   for (auto _ : state)
   {
-        FoxMath::Mat3 rst { RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, 
-                                        RAND_FLOAT, RAND_FLOAT, RAND_FLOAT,
-                                        RAND_FLOAT, RAND_FLOAT, RAND_FLOAT};
+        if constexpr (TBatch)
+        {
+          Matrix4<float>::decomposeTRS(matrices.data(), rst.data(), count);
+        }
+        else
+        {
+          for (size_t i = 0; i < count; i++)
+            rst[i] = matrices[i].decomposeTRS();
+        }
 
-        rst.inverse(rst);
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
 
-        benchmark::DoNotOptimize(rst);
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_Matrix4DecomposeTRS, false)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_Matrix4DecomposeTRS, true)->Arg(4096);
+
+/*Skinning of range(0) vertices with 4 influences among 64 bones : dual quaternion palette (32 bytes by bone) or matrix palette (64 bytes by bone)*/
+template <bool TDualQuaternion>
+static void BM_Skinning(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const size_t count = static_cast<size_t>(state.range(0));
+  constexpr size_t boneCount = 64;
+
+  std::vector<DualQuaternion<float>> dualQuaternionPalette;
+  std::vector<Matrix4<float>> matrixPalette;
+
+  for (size_t i = 0; i < boneCount; i++)
+  {
+    const DualQuaternion<float> bone (Quaternion<float>(Vec3<float>(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT), Angle<EAngleType::Radian, float>(RAND_FLOAT)), Vec3<float>(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+    dualQuaternionPalette.push_back(bone);
+    matrixPalette.push_back(bone.toMatrix());
+  }
+
+  VectorBatch<4, unsigned int> boneIndices (count);
+  VectorBatch<4, float> weights (count);
+  VectorBatch<3, float> positions (count), normals (count), dstPositions, dstNormals;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    for (size_t influence = 0; influence < 4; influence++)
+    {
+      boneIndices.getStream(influence)[i] = std::rand() % boneCount;
+      weights.getStream(influence)[i] = 0.25f;
+    }
+
+    for (size_t component = 0; component < 3; component++)
+    {
+      positions.getStream(component)[i] = RAND_FLOAT;
+      normals.getStream(component)[i] = RAND_FLOAT;
+    }
+  }
+
+  for (auto _ : state)
+  {
+        if constexpr (TDualQuaternion)
+          skinDualQuaternion(dualQuaternionPalette.data(), boneIndices, weights, positions, normals, dstPositions, dstNormals);
+        else
+          skinLinearBlend(matrixPalette.data(), boneIndices, weights, positions, normals, dstPositions, dstNormals);
+
+        benchmark::DoNotOptimize(dstPositions.getStream(0));
         benchmark::ClobberMemory();
   }
+
+  state.SetItemsProcessed(state.iterations() * count);
 }
+BENCHMARK_TEMPLATE(BM_Skinning, false)->Arg(1 << 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Skinning, true)->Arg(1 << 16)->UseRealTime();
 
-BENCHMARK(BM_OldReverseMatrixAtRunTime);
-*/
-BENCHMARK(_);
+template <bool TBatch>
+static void BM_EulerToQuaternion(benchmark::State& state) 
+{
+  std::srand (time(NULL));
 
-static void BM_NewTRSMatrixAtCompileTime(benchmark::State& state) 
+  const size_t count = static_cast<size_t>(state.range(0));
+  std::vector<EulerAngle<float>> eulerAngles;
+  VectorBatch<3, float> eulerBatch (count);
+  eulerAngles.reserve(count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    const Vec3f angles (RAND_FLOAT / RAND_MAX * 6.f - 3.f, RAND_FLOAT / RAND_MAX * 6.f - 3.f, RAND_FLOAT / RAND_MAX * 6.f - 3.f);
+    eulerAngles.emplace_back(angles, EEulerOrder::ZXY);
+    eulerBatch.setVector(i, angles);
+  }
+
+  std::vector<Quaternion<float>> rst (count, Quaternion<float>::identity);
+  QuaternionBatch<float> rstBatch (count);
+
+  for (auto _ : state)
+  {
+    if constexpr (TBatch)
+    {
+      EulerAngle<float>::toQuaternions(eulerBatch, EEulerOrder::ZXY, rstBatch);
+      benchmark::DoNotOptimize(rstBatch.getStream(0));
+    }
+    else
+    {
+      for (size_t i = 0; i < count; i++)
+      {
+        rst[i] = eulerAngles[i].toQuaternion();
+      }
+
+      benchmark::DoNotOptimize(rst.data());
+    }
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_EulerToQuaternion, false)->Arg(1 << 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_EulerToQuaternion, true)->Arg(1 << 16)->UseRealTime();
+
+template <bool TTree>
+static void BM_BroadPhaseStep(benchmark::State& state) 
 {
   std::srand (time(NULL));
-  
+
+  /*Boxes of size 1 moving in a cube keeping the density constant : about 4 overlaps by box*/
+  const size_t count = static_cast<size_t>(state.range(0));
+  const float worldSize = std::cbrt(static_cast<float>(count)) * 3.f;
+
+  std::vector<BoundingBox3<float>> boxes;
+  std::vector<Vec3f> velocities;
+  boxes.reserve(count);
+  velocities.reserve(count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    const Vec3f center (RAND_FLOAT / RAND_MAX * worldSize, RAND_FLOAT / RAND_MAX * worldSize, RAND_FLOAT / RAND_MAX * worldSize);
+    boxes.emplace_back(BoundingBox3<float>::createFromCenterExtents(center, 0.5f, 0.5f, 0.5f));
+    velocities.emplace_back(RAND_FLOAT / RAND_MAX * 0.1f - 0.05f, RAND_FLOAT / RAND_MAX * 0.1f - 0.05f, RAND_FLOAT / RAND_MAX * 0.1f - 0.05f);
+  }
+
+  DynamicAABBTree<float, size_t> tree;
+  std::vector<size_t> proxies (count);
+  std::vector<DynamicAABBTree<float, size_t>::Pair> pairs;
+  tree.reserve(count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    proxies[i] = tree.insert(boxes[i], i);
+  }
+  tree.rebuild();
+  tree.computePairs(pairs);
+
   for (auto _ : state)
   {
-        constexpr SquareMatrix<3, float, EMatrixConvention::ColumnMajor> matConstColumnMajorSqrt = SquareMatrix<3, float, EMatrixConvention::ColumnMajor>::identity();
+    for (size_t i = 0; i < count; i++)
+    {
+      boxes[i] = BoundingBox3<float>{boxes[i].min + velocities[i], boxes[i].max + velocities[i]};
+    }
 
-        constexpr Vec3f translation (3.f, 5.f, 6.f);
-        constexpr Vec3f rotation (1.f, 0.f, 0.f);
-        constexpr Vec3f scale (3.f, 5.f, 6.f);
+    if constexpr (TTree)
+    {
+      for (size_t i = 0; i < count; i++)
+      {
+        tree.update(proxies[i], boxes[i], velocities[i]);
+      }
 
-        SquareMatrix<3, float, EMatrixConvention::ColumnMajor> rst =  matConstColumnMajorSqrt.createScaleMatrix(scale) * 
-                                                                      matConstColumnMajorSqrt.createRotationArroundAxisMatrix(rotation, 60_deg) *
-                                                                      matConstColumnMajorSqrt.createScaleMatrix(scale);
-        benchmark::DoNotOptimize(rst);
-        //benchmark::ClobberMemory();
+      tree.computePairs(pairs);
+      benchmark::DoNotOptimize(pairs.data());
+    }
+    else
+    {
+      size_t pairCount = 0;
+      for (size_t i = 0; i < count; i++)
+      {
+        for (size_t j = i + 1; j < count; j++)
+        {
+          pairCount += boxes[i].overlaps(boxes[j]);
+        }
+      }
+
+      benchmark::DoNotOptimize(pairCount);
+    }
+
+    benchmark::ClobberMemory();
   }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
 }
-// Register the function as a benchmark
-BENCHMARK(BM_NewTRSMatrixAtCompileTime);
+BENCHMARK_TEMPLATE(BM_BroadPhaseStep, false)->RangeMultiplier(4)->Range(1 << 10, 1 << 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_BroadPhaseStep, true)->RangeMultiplier(4)->Range(1 << 10, 1 << 17)->UseRealTime();
 
-static void BM_NewTRSMatrixAtRunTime(benchmark::State& state) 
+static void BM_SweepAndPruneStep(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  /*Same scene than BM_BroadPhaseStep*/
+  const size_t count = static_cast<size_t>(state.range(0));
+  const float worldSize = std::cbrt(static_cast<float>(count)) * 3.f;
+
+  std::vector<BoundingBox3<float>> boxes;
+  std::vector<Vec3f> velocities;
+  boxes.reserve(count);
+  velocities.reserve(count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    const Vec3f center (RAND_FLOAT / RAND_MAX * worldSize, RAND_FLOAT / RAND_MAX * worldSize, RAND_FLOAT / RAND_MAX * worldSize);
+    boxes.emplace_back(BoundingBox3<float>::createFromCenterExtents(center, 0.5f, 0.5f, 0.5f));
+    velocities.emplace_back(RAND_FLOAT / RAND_MAX * 0.1f - 0.05f, RAND_FLOAT / RAND_MAX * 0.1f - 0.05f, RAND_FLOAT / RAND_MAX * 0.1f - 0.05f);
+  }
+
+  SweepAndPrune<float, size_t> sweepAndPrune;
+  std::vector<size_t> proxies (count);
+  std::vector<SweepAndPrune<float, size_t>::Pair> addedPairs;
+  std::vector<SweepAndPrune<float, size_t>::Pair> removedPairs;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    proxies[i] = sweepAndPrune.insert(boxes[i], i);
+  }
+  sweepAndPrune.chooseSweepAxis();
+  sweepAndPrune.update(addedPairs, removedPairs);
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      boxes[i] = BoundingBox3<float>{boxes[i].min + velocities[i], boxes[i].max + velocities[i]};
+      sweepAndPrune.setBox(proxies[i], boxes[i]);
+    }
+
+    sweepAndPrune.update(addedPairs, removedPairs);
+    benchmark::DoNotOptimize(addedPairs.data());
+    benchmark::DoNotOptimize(removedPairs.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SweepAndPruneStep)->RangeMultiplier(4)->Range(1 << 10, 1 << 17)->UseRealTime();
+
+template <bool TDispatcher>
+static void BM_NarrowPhase(benchmark::State& state) 
 {
   std::srand (time(NULL));
 
+  using Dispatcher = NarrowPhaseDispatcher<float, NarrowPhaseTests<float>, BoundingBox3<float>, BoundingSphere<float>>;
+
+  /*Half boxes, half spheres. Candidate pairs come from the broad phase*/
+  const size_t count = static_cast<size_t>(state.range(0));
+  const float worldSize = std::cbrt(static_cast<float>(count)) * 2.f;
+
+  std::vector<BoundingBox3<float>> boxes;
+  std::vector<BoundingSphere<float>> spheres;
+  DynamicAABBTree<float, ShapeHandle> tree (0.f);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    const Vec3f center (RAND_FLOAT / RAND_MAX * worldSize, RAND_FLOAT / RAND_MAX * worldSize, RAND_FLOAT / RAND_MAX * worldSize);
+
+    if (i % 2)
+    {
+      boxes.emplace_back(BoundingBox3<float>::createFromCenterExtents(center, 0.5f, 0.5f, 0.5f));
+      tree.insert(boxes.back(), Dispatcher::createHandle<BoundingBox3<float>>(boxes.size() - 1));
+    }
+    else
+    {
+      spheres.emplace_back(BoundingSphere<float>{center, 0.5f});
+      tree.insert(spheres.back().getBoundingBox(), Dispatcher::createHandle<BoundingSphere<float>>(spheres.size() - 1));
+    }
+  }
+
+  std::vector<Dispatcher::CandidatePair> pairs;
+  tree.forEachPair([&](const ShapeHandle& first, const ShapeHandle& second)
+  {
+    pairs.push_back(Dispatcher::CandidatePair{first, second});
+  });
+
+  Dispatcher dispatcher;
+  std::vector<Contact<float>> contacts;
+  contacts.reserve(pairs.size());
+
   for (auto _ : state)
   {
-        const Vec3f translation  (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
-        const Vec3f rotation     (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
-        const Vec3f scale        (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+    if constexpr (TDispatcher)
+    {
+      dispatcher.dispatch(pairs, contacts, boxes, spheres);
+    }
+    else
+    {
+      /*Pair by pair switch on the shape types*/
+      contacts.clear();
+      for (size_t i = 0; i < pairs.size(); i++)
+      {
+        const ShapeHandle& first  = pairs[i].first;
+        const ShapeHandle& second = pairs[i].second;
+        Contact<float> contact;
+        bool isColliding;
 
-        Mat4f<EMatrixConvention::ColumnMajor> rst = Mat4f<EMatrixConvention::ColumnMajor>::createTRSMatrix(translation, rotation, scale);
-        benchmark::DoNotOptimize(rst);
-        //benchmark::ClobberMemory();
+        if (first.type == 0 && second.type == 0)
+          isColliding = NarrowPhaseTests<float>::collide(boxes[first.index], boxes[second.index], contact);
+        else if (first.type == 1 && second.type == 1)
+          isColliding = NarrowPhaseTests<float>::collide(spheres[first.index], spheres[second.index], contact);
+        else if (first.type == 1)
+          isColliding = NarrowPhaseTests<float>::collide(spheres[first.index], boxes[second.index], contact);
+        else
+        {
+          isColliding = NarrowPhaseTests<float>::collide(spheres[second.index], boxes[first.index], contact);
+          contact.normal = -contact.normal;
+        }
+
+        if (isColliding)
+        {
+          contact.pairIndex = i;
+          contacts.push_back(contact);
+        }
+      }
+    }
+
+    benchmark::DoNotOptimize(contacts.data());
+    benchmark::ClobberMemory();
   }
+
+  state.SetItemsProcessed(state.iterations() * pairs.size());
 }
-// Register the function as a benchmark
-BENCHMARK(BM_NewTRSMatrixAtRunTime);
-/*
-// Define another benchmark
-static void BM_OldTRSMatrixAtRunTime(benchmark::State& state)
+BENCHMARK_TEMPLATE(BM_NarrowPhase, false)->Arg(1 << 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NarrowPhase, true)->Arg(1 << 16)->UseRealTime();
+
+static std::vector<OrientedBox3<float>> createRandomOrientedBoxes(size_t count, float worldSize)
+{
+  std::vector<OrientedBox3<float>> boxes (count);
+
+  for (OrientedBox3<float>& box : boxes)
+  {
+    Vec3f axisI (RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f);
+    Vec3f axisJ (RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f);
+    axisI.normalize();
+    axisJ = axisJ - axisI * axisI.dot(axisJ);
+    axisJ.normalize();
+
+    box.center  = Vec3f(RAND_FLOAT / RAND_MAX * worldSize, RAND_FLOAT / RAND_MAX * worldSize, RAND_FLOAT / RAND_MAX * worldSize);
+    box.axes    = {axisI, axisJ, axisI.getCross(axisJ)};
+    box.extents = Vec3f(RAND_FLOAT / RAND_MAX + 0.2f, RAND_FLOAT / RAND_MAX + 0.2f, RAND_FLOAT / RAND_MAX + 0.2f);
+  }
+
+  return boxes;
+}
+
+/*Previous SAT : project the 8 corners of both boxes on each of the 15 axes*/
+static bool isSATFoundedOnAxeByCorners(const OrientedBox3<float>& box1, const OrientedBox3<float>& box2, const Vec3f& axe)
+{
+  float minBox[2] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+  float maxBox[2] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+  const OrientedBox3<float>* boxes[2] = {&box1, &box2};
+
+  for (size_t box = 0; box < 2; box++)
+  {
+    for (size_t corner = 0; corner < 8; corner++)
+    {
+      const Vec3f point = boxes[box]->center + boxes[box]->axes[0] * ((corner & 1) ? boxes[box]->extents.getX() : -boxes[box]->extents.getX())
+                                             + boxes[box]->axes[1] * ((corner & 2) ? boxes[box]->extents.getY() : -boxes[box]->extents.getY())
+                                             + boxes[box]->axes[2] * ((corner & 4) ? boxes[box]->extents.getZ() : -boxes[box]->extents.getZ());
+      const float projection = axe.dot(point);
+      minBox[box] = std::min(minBox[box], projection);
+      maxBox[box] = std::max(maxBox[box], projection);
+    }
+  }
+
+  return minBox[1] <= maxBox[0] && minBox[0] <= maxBox[1];
+}
+
+template <bool TProjectedRadius>
+static void BM_OrientedBoxSAT(benchmark::State& state) 
 {
   std::srand (time(NULL));
 
+  const size_t count = static_cast<size_t>(state.range(0));
+  const std::vector<OrientedBox3<float>> boxes = createRandomOrientedBoxes(count, 8.f);
+  const OrientedBox3<float> box = createRandomOrientedBoxes(1, 8.f)[0];
+  std::unique_ptr<bool[]> results (new bool[count]);
+
   for (auto _ : state)
   {
-        const FoxMath::Vec3 translation  {RAND_FLOAT, RAND_FLOAT, RAND_FLOAT};
-        const FoxMath::Vec3 rotation     {RAND_FLOAT, RAND_FLOAT, RAND_FLOAT};
-        const FoxMath::Vec3 scale        {RAND_FLOAT, RAND_FLOAT, RAND_FLOAT};
+    for (size_t i = 0; i < count; i++)
+    {
+      if constexpr (TProjectedRadius)
+      {
+        results[i] = OrientedBoxSAT<float>::isOverlapping(box, boxes[i]);
+      }
+      else
+      {
+        bool isOverlapping = true;
+        for (size_t axis = 0; axis < 15 && isOverlapping; axis++)
+        {
+          const Vec3f axe = (axis < 3) ? box.axes[axis] : (axis < 6) ? boxes[i].axes[axis - 3] : Vec3f(box.axes[(axis - 6) / 3].getCross(boxes[i].axes[(axis - 6) % 3]));
+          isOverlapping = isSATFoundedOnAxeByCorners(box, boxes[i], axe);
+        }
+        results[i] = isOverlapping;
+      }
+    }
 
-        FoxMath::Mat4 rst = FoxMath::Mat4::createTRSMatrix(scale, rotation, translation);
-        benchmark::DoNotOptimize(rst);
-        //benchmark::ClobberMemory();
+    benchmark::DoNotOptimize(results.get());
+    benchmark::ClobberMemory();
   }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
 }
+BENCHMARK_TEMPLATE(BM_OrientedBoxSAT, false)->Arg(1 << 14)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_OrientedBoxSAT, true)->Arg(1 << 14)->UseRealTime();
 
-BENCHMARK(BM_OldTRSMatrixAtRunTime);
-BENCHMARK(_);*/
+static void BM_OrientedBoxSATBatch(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const size_t count = static_cast<size_t>(state.range(0));
+  const std::vector<OrientedBox3<float>> boxes = createRandomOrientedBoxes(count, 8.f);
+  const OrientedBox3<float> box = createRandomOrientedBoxes(1, 8.f)[0];
+  const OrientedBoxBatch<float> batch (boxes.data(), count);
+  std::unique_ptr<bool[]> results (new bool[count]);
+
+  for (auto _ : state)
+  {
+    OrientedBoxSAT<float>::isOverlapping(box, batch, results.get());
+    benchmark::DoNotOptimize(results.get());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_OrientedBoxSATBatch)->Arg(1 << 14)->UseRealTime();
+
+static std::vector<BoundingBox3<float>> createRandomBoundingBoxes(size_t count, float worldSize)
+{
+  std::vector<BoundingBox3<float>> boxes (count);
+
+  for (BoundingBox3<float>& box : boxes)
+  {
+    box = BoundingBox3<float>::createFromCenterExtents(Vec3f(RAND_FLOAT / RAND_MAX * worldSize, RAND_FLOAT / RAND_MAX * worldSize, RAND_FLOAT / RAND_MAX * worldSize),
+                                                       RAND_FLOAT / RAND_MAX + 0.2f, RAND_FLOAT / RAND_MAX + 0.2f, RAND_FLOAT / RAND_MAX + 0.2f);
+  }
+
+  return boxes;
+}
+
+template <bool TPacket>
+static void BM_SegmentSlabTest(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const size_t count = static_cast<size_t>(state.range(0));
+  const BoundingBox3<float> box = createRandomBoundingBoxes(1, 8.f)[0];
+  std::vector<Vec3f> pt1 (count);
+  std::vector<Vec3f> pt2 (count);
+  SegmentBatch<float> segments (count);
+  std::vector<SlabHit<float>> hits (count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    pt1[i] = Vec3f(RAND_FLOAT / RAND_MAX * 8.f, RAND_FLOAT / RAND_MAX * 8.f, RAND_FLOAT / RAND_MAX * 8.f);
+    pt2[i] = Vec3f(RAND_FLOAT / RAND_MAX * 8.f, RAND_FLOAT / RAND_MAX * 8.f, RAND_FLOAT / RAND_MAX * 8.f);
+    segments.setSegment(i, pt1[i], pt2[i]);
+  }
+
+  for (auto _ : state)
+  {
+    if constexpr (TPacket)
+    {
+      SegmentSlabTest<float>::intersect(segments, box, hits.data());
+    }
+    else
+    {
+      for (size_t i = 0; i < count; i++)
+      {
+        SegmentSlabTest<float>::intersect(pt1[i], pt2[i], box, hits[i]);
+      }
+    }
+
+    benchmark::DoNotOptimize(hits.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_SegmentSlabTest, false)->Arg(1 << 14)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SegmentSlabTest, true)->Arg(1 << 14)->UseRealTime();
+
+static void BM_SegmentSlabTestBoxes(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const size_t count = static_cast<size_t>(state.range(0));
+  const std::vector<BoundingBox3<float>> boxes = createRandomBoundingBoxes(count, 8.f);
+  const BoundingBoxBatch<float> batch (boxes.data(), count);
+  const Vec3f pt1 (0.f, 0.f, 0.f);
+  const Vec3f pt2 (8.f, 8.f, 8.f);
+  std::vector<SlabHit<float>> hits (count);
+
+  for (auto _ : state)
+  {
+    SegmentSlabTest<float>::intersect(pt1, pt2, batch, hits.data());
+    benchmark::DoNotOptimize(hits.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SegmentSlabTestBoxes)->Arg(1 << 14)->UseRealTime();
+
+static void BM_NewReverseMatrixAtRunTime(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  for (auto _ : state)
+  {
+        SquareMatrix<3, float, EMatrixConvention::ColumnMajor> rst (  RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, 
+                                                                      RAND_FLOAT, RAND_FLOAT, RAND_FLOAT,
+                                                                      RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+
+        rst.reverse();
+
+        benchmark::DoNotOptimize(rst);
+        benchmark::ClobberMemory();
+  }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_NewReverseMatrixAtRunTime);
+
+/*0 : getReverse then product, 1 : LU, 2 : Cholesky, 3 : QR. Matrix is factorized once per iteration and reused for all right-hand sides*/
+template <size_t TSize, int TMethod>
+static void BM_LinearSolve(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const size_t rhsCount = static_cast<size_t>(state.range(0));
+
+  /*A * transpose(A) + n * I is symmetric positive definite so it's valid for all methods*/
+  SquareMatrix<TSize, float> randomMat;
+  for (size_t i = 0; i < TSize * TSize; i++)
+    randomMat.getData(i) = RAND_FLOAT;
+
+  SquareMatrix<TSize, float> mat = static_cast<const GenericMatrix<TSize, TSize, float>&>(randomMat) * randomMat.getTransposed();
+  for (size_t i = 0; i < TSize; i++)
+    mat.getData(i, i) += static_cast<float>(TSize);
+
+  std::vector<GenericVector<TSize, float>> rhs (rhsCount);
+  std::vector<GenericVector<TSize, float>> solutions (rhsCount);
+  for (GenericVector<TSize, float>& vec : rhs)
+    for (size_t i = 0; i < TSize; i++)
+      vec.setData(i, RAND_FLOAT);
+
+  for (auto _ : state)
+  {
+        if constexpr (TMethod == 0)
+        {
+          const SquareMatrix<TSize, float> reverse = mat.getReverse();
+          for (size_t i = 0; i < rhsCount; i++)
+            solutions[i] = reverse * rhs[i];
+        }
+        else if constexpr (TMethod == 1)
+          LUDecomposition<TSize, float>(mat).solve(rhs.data(), solutions.data(), rhsCount);
+        else if constexpr (TMethod == 2)
+          CholeskyDecomposition<TSize, float>(mat).solve(rhs.data(), solutions.data(), rhsCount);
+        else
+          QRDecomposition<TSize, float>(mat).solve(rhs.data(), solutions.data(), rhsCount);
+
+        benchmark::DoNotOptimize(solutions.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * rhsCount);
+}
+BENCHMARK_TEMPLATE(BM_LinearSolve, 6, 0)->Arg(1)->Arg(64);
+BENCHMARK_TEMPLATE(BM_LinearSolve, 6, 1)->Arg(1)->Arg(64);
+BENCHMARK_TEMPLATE(BM_LinearSolve, 6, 2)->Arg(1)->Arg(64);
+BENCHMARK_TEMPLATE(BM_LinearSolve, 6, 3)->Arg(1)->Arg(64);
+BENCHMARK_TEMPLATE(BM_LinearSolve, 16, 0)->Arg(1)->Arg(64);
+BENCHMARK_TEMPLATE(BM_LinearSolve, 16, 1)->Arg(1)->Arg(64);
+BENCHMARK_TEMPLATE(BM_LinearSolve, 16, 2)->Arg(1)->Arg(64);
+BENCHMARK_TEMPLATE(BM_LinearSolve, 16, 3)->Arg(1)->Arg(64);
+
+static void BM_PerspectiveMatrixAtCompileTime(benchmark::State& state) 
+{
+  for (auto _ : state)
+  {
+        constexpr Matrix4<float> projection = Matrix4<float>::createPerspectiveMatrix(16.f / 9.f, 0.1f, 100.f, Angle<EAngleType::Radian, float>(1.2f));
+
+        Matrix4<float> rst = projection;
+
+        benchmark::DoNotOptimize(rst);
+  }
+}
+BENCHMARK(BM_PerspectiveMatrixAtCompileTime);
+
+static void BM_PerspectiveMatrixAtRunTime(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  for (auto _ : state)
+  {
+        Matrix4<float> rst = Matrix4<float>::createPerspectiveMatrix(16.f / 9.f, 0.1f, 100.f, Angle<EAngleType::Radian, float>(RAND_FLOAT));
+
+        benchmark::DoNotOptimize(rst);
+        benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_PerspectiveMatrixAtRunTime);
+
+// Define another benchmark
+/*
+static void BM_OldReverseMatrixAtRunTime(benchmark::State& state)
+{
+  std::srand (time(NULL));
+
+  for (auto _ : state)
+  {
+        FoxMath::Mat3 rst { RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, 
+                                        RAND_FLOAT, RAND_FLOAT, RAND_FLOAT,
+                                        RAND_FLOAT, RAND_FLOAT, RAND_FLOAT};
+
+        rst.inverse(rst);
+
+        benchmark::DoNotOptimize(rst);
+        benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(BM_OldReverseMatrixAtRunTime);
+*/
+BENCHMARK(_);
+
+static void BM_NewTRSMatrixAtCompileTime(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+  
+  for (auto _ : state)
+  {
+        constexpr SquareMatrix<3, float, EMatrixConvention::ColumnMajor> matConstColumnMajorSqrt = SquareMatrix<3, float, EMatrixConvention::ColumnMajor>::identity();
+
+        constexpr Vec3f translation (3.f, 5.f, 6.f);
+        constexpr Vec3f rotation (1.f, 0.f, 0.f);
+        constexpr Vec3f scale (3.f, 5.f, 6.f);
+
+        SquareMatrix<3, float, EMatrixConvention::ColumnMajor> rst =  matConstColumnMajorSqrt.createScaleMatrix(scale) * 
+                                                                      matConstColumnMajorSqrt.createRotationArroundAxisMatrix(rotation, 60_deg) *
+                                                                      matConstColumnMajorSqrt.createScaleMatrix(scale);
+        benchmark::DoNotOptimize(rst);
+        //benchmark::ClobberMemory();
+  }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_NewTRSMatrixAtCompileTime);
+
+static void BM_NewTRSMatrixAtRunTime(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  for (auto _ : state)
+  {
+        const Vec3f translation  (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+        const Vec3f rotation     (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+        const Vec3f scale        (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+
+        Mat4f<EMatrixConvention::ColumnMajor> rst = Mat4f<EMatrixConvention::ColumnMajor>::createTRSMatrix(translation, rotation, scale);
+        benchmark::DoNotOptimize(rst);
+        //benchmark::ClobberMemory();
+  }
+}
+// Register the function as a benchmark
+BENCHMARK(BM_NewTRSMatrixAtRunTime);
+/*
+// Define another benchmark
+static void BM_OldTRSMatrixAtRunTime(benchmark::State& state)
+{
+  std::srand (time(NULL));
+
+  for (auto _ : state)
+  {
+        const FoxMath::Vec3 translation  {RAND_FLOAT, RAND_FLOAT, RAND_FLOAT};
+        const FoxMath::Vec3 rotation     {RAND_FLOAT, RAND_FLOAT, RAND_FLOAT};
+        const FoxMath::Vec3 scale        {RAND_FLOAT, RAND_FLOAT, RAND_FLOAT};
+
+        FoxMath::Mat4 rst = FoxMath::Mat4::createTRSMatrix(scale, rotation, translation);
+        benchmark::DoNotOptimize(rst);
+        //benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(BM_OldTRSMatrixAtRunTime);
+BENCHMARK(_);*/
+
+template <EMatrixConvention TMatrixConvention>
+static void BM_Mat4Multiply(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  std::vector<Mat4f<TMatrixConvention>> lhs (static_cast<size_t>(state.range(0)));
+  std::vector<Mat4f<TMatrixConvention>> rhs (lhs.size());
+  std::vector<Mat4f<TMatrixConvention>> rst (lhs.size());
+
+  for (size_t i = 0; i < lhs.size(); i++)
+  {
+    for (size_t j = 0; j < 16; j++)
+    {
+      lhs[i].getData(j) = RAND_FLOAT;
+      rhs[i].getData(j) = RAND_FLOAT;
+    }
+  }
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < lhs.size(); i++)
+        {
+          rst[i] = lhs[i] * rhs[i];
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Mat4Multiply, EMatrixConvention::RowMajor)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_Mat4Multiply, EMatrixConvention::ColumnMajor)->Arg(1024);
+
+/*Affine composition : compare with BM_Mat4Multiply*/
+static void BM_TransformCompose(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  std::vector<Transformf> lhs (static_cast<size_t>(state.range(0)));
+  std::vector<Transformf> rhs (lhs.size());
+  std::vector<Transformf> rst (lhs.size());
+
+  for (size_t i = 0; i < lhs.size(); i++)
+  {
+    for (size_t j = 0; j < 12; j++)
+    {
+      lhs[i].getData()[j] = RAND_FLOAT;
+      rhs[i].getData()[j] = RAND_FLOAT;
+    }
+  }
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < lhs.size(); i++)
+        {
+          rst[i] = lhs[i] * rhs[i];
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TransformCompose)->Arg(1024);
+
+/*Reference : triple loop with convention branch in the inner loop like the previous operator*/
+static void BM_Mat4MultiplyTripleLoop(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  std::vector<Mat4f<EMatrixConvention::ColumnMajor>> lhs (static_cast<size_t>(state.range(0)));
+  std::vector<Mat4f<EMatrixConvention::ColumnMajor>> rhs (lhs.size());
+  std::vector<Mat4f<EMatrixConvention::ColumnMajor>> rst (lhs.size());
+
+  for (size_t i = 0; i < lhs.size(); i++)
+  {
+    for (size_t j = 0; j < 16; j++)
+    {
+      lhs[i].getData(j) = RAND_FLOAT;
+      rhs[i].getData(j) = RAND_FLOAT;
+    }
+  }
+
+  for (auto _ : state)
+  {
+        for (size_t m = 0; m < lhs.size(); m++)
+        {
+          rst[m].fill(0.f);
+
+          for (size_t i = 0; i < 4; i++)
+            for (size_t j = 0; j < 4; j++)
+              for (size_t index = 0; index < 4; index++)
+                rst[m].getData(i, j) += lhs[m].getData(index, j) * rhs[m].getData(i, index);
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Mat4MultiplyTripleLoop)->Arg(1024);
+
+template <EMatrixConvention TMatrixConvention>
+static void BM_Mat4VectorMultiply(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  Mat4f<TMatrixConvention> mat;
+  for (size_t j = 0; j < 16; j++)
+    mat.getData(j) = RAND_FLOAT;
+
+  std::vector<GenericVector<4, float>> vecs (static_cast<size_t>(state.range(0)), GenericVector<4, float>(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, 1.f));
+
+  for (auto _ : state)
+  {
+        for (GenericVector<4, float>& vec : vecs)
+        {
+          vec = mat * vec;
+        }
+
+        benchmark::DoNotOptimize(vecs.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Mat4VectorMultiply, EMatrixConvention::RowMajor)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_Mat4VectorMultiply, EMatrixConvention::ColumnMajor)->Arg(1024);
+
+static void BM_Mat4TransformPointsOneByOne(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const Mat4f<> mat = Mat4f<>::createTRSMatrix(Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT), Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT), Vec3f(1.f, 2.f, 3.f));
+  const std::vector<Vec3f> points (static_cast<size_t>(state.range(0)), Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+  std::vector<Vec3f> rst (points.size());
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < points.size(); i++)
+        {
+          const GenericVector<4, float> point = mat * GenericVector<4, float>(points[i][0], points[i][1], points[i][2], 1.f);
+          rst[i] = Vec3f(point[0], point[1], point[2]);
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Mat4TransformPointsOneByOne)->Arg(1024)->Arg(1 << 20);
+
+static void BM_Mat4TransformPoints(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const Mat4f<> mat = Mat4f<>::createTRSMatrix(Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT), Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT), Vec3f(1.f, 2.f, 3.f));
+  const std::vector<Vec3f> points (static_cast<size_t>(state.range(0)), Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+  std::vector<Vec3f> rst (points.size());
+
+  for (auto _ : state)
+  {
+        mat.transformPoints(points.data(), rst.data(), points.size());
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Mat4TransformPoints)->Arg(1024)->Arg(1 << 20)->UseRealTime();
+
+static void BM_Mat4TransformNormals(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const Mat4f<> mat = Mat4f<>::createTRSMatrix(Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT), Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT), Vec3f(1.f, 2.f, 3.f));
+  const std::vector<Vec3f> normals (static_cast<size_t>(state.range(0)), Vec3f(0.f, 1.f, 0.f));
+  std::vector<Vec3f> rst (normals.size());
+
+  for (auto _ : state)
+  {
+        mat.transformNormals(normals.data(), rst.data(), normals.size());
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Mat4TransformNormals)->Arg(1024)->Arg(1 << 20)->UseRealTime();
+
+/*Reference : every world matrix recomputed each frame from its local TRS matrix. Node i has (i - 1) / 4 as parent*/
+static void BM_HierarchyFullRecompute(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const size_t count = static_cast<size_t>(state.range(0));
+  std::vector<Vec3f> translations (count), rotations (count), scales (count, Vec3f(1.f, 1.f, 1.f));
+  std::vector<Mat4f<>> worlds (count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    translations[i] = Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+    rotations[i] = Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+  }
+
+  for (auto _ : state)
+  {
+        /*1% of the nodes move*/
+        for (size_t i = 0; i < count / 100; i++)
+          translations[static_cast<size_t>(std::rand()) % count] = Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+
+        worlds[0] = Mat4f<>::createTRSMatrix(translations[0], rotations[0], scales[0]);
+
+        for (size_t i = 1; i < count; i++)
+          worlds[i] = worlds[(i - 1) / 4] * Mat4f<>::createTRSMatrix(translations[i], rotations[i], scales[i]);
+
+        benchmark::DoNotOptimize(worlds.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HierarchyFullRecompute)->Arg(100000)->UseRealTime();
+
+static void BM_TransformHierarchyUpdate(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const size_t count = static_cast<size_t>(state.range(0));
+  TransformHierarchyf hierarchy;
+  ThreadPool pool;
+  hierarchy.reserve(count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    Quaternion<float> rotation (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+    rotation.normalize();
+    hierarchy.addNode(i == 0 ? TransformHierarchyf::invalidNode : (i - 1) / 4, Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT), rotation, Vec3f(1.f, 1.f, 1.f));
+  }
+
+  hierarchy.update(pool);
+
+  for (auto _ : state)
+  {
+        /*1% of the nodes move*/
+        for (size_t i = 0; i < count / 100; i++)
+          hierarchy.setLocalTranslation(static_cast<size_t>(std::rand()) % count, Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+
+        hierarchy.update(pool);
+
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TransformHierarchyUpdate)->Arg(100000)->UseRealTime();
+
+template <size_t TSize>
+static void BM_GenericMatrixMultiply(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  std::unique_ptr<SquareMatrix<TSize, float>> lhs = std::make_unique<SquareMatrix<TSize, float>>();
+  std::unique_ptr<SquareMatrix<TSize, float>> rhs = std::make_unique<SquareMatrix<TSize, float>>();
+  std::unique_ptr<GenericMatrix<TSize, TSize, float>> rst = std::make_unique<GenericMatrix<TSize, TSize, float>>();
+
+  for (size_t j = 0; j < TSize * TSize; j++)
+  {
+    lhs->getData(j) = RAND_FLOAT;
+    rhs->getData(j) = RAND_FLOAT;
+  }
+
+  for (auto _ : state)
+  {
+        *rst = *lhs * *rhs;
+
+        benchmark::DoNotOptimize(rst->getData().data());
+        benchmark::ClobberMemory();
+  }
+}
+BENCHMARK_TEMPLATE(BM_GenericMatrixMultiply, 3);
+BENCHMARK_TEMPLATE(BM_GenericMatrixMultiply, 16);
+BENCHMARK_TEMPLATE(BM_GenericMatrixMultiply, 96);
+
+template <EPrecision TPrecision>
+static void BM_Vec3Normalize(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  std::vector<Vec3f> vectors;
+  vectors.reserve(static_cast<size_t>(state.range(0)));
+
+  for (size_t i = 0; i < static_cast<size_t>(state.range(0)); i++)
+  {
+    vectors.emplace_back(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+  }
+
+  std::vector<Vec3f> rst (vectors);
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < vectors.size(); i++)
+        {
+          rst[i] = vectors[i].template getNormalized<TPrecision>();
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Vec3Normalize, EPrecision::Precise)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_Vec3Normalize, EPrecision::Fast)->Arg(1024);
+
+template <EPrecision TPrecision>
+static void BM_Vec3BatchNormalize(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  Vec3fBatch vectors;
+  vectors.reserve(static_cast<size_t>(state.range(0)));
+
+  for (size_t i = 0; i < static_cast<size_t>(state.range(0)); i++)
+  {
+    vectors.pushBack(Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+  }
+
+  for (auto _ : state)
+  {
+        vectors.template normalize<TPrecision>();
+
+        benchmark::DoNotOptimize(vectors.getStream(0));
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Vec3BatchNormalize, EPrecision::Precise)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_Vec3BatchNormalize, EPrecision::Fast)->Arg(1024);
+
+template <EPrecision TPrecision, bool TFused>
+static void BM_SinCos(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  std::vector<float> angles (static_cast<size_t>(state.range(0)));
+
+  for (float& angle : angles)
+  {
+    angle = RAND_FLOAT / RAND_MAX * 6.28318530f - 3.14159265f;
+  }
+
+  std::vector<float> rst (angles.size());
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < angles.size(); i++)
+        {
+          if constexpr (TFused)
+          {
+            const Math::SinCos<float> sinCos = Math::sincos<TPrecision>(angles[i]);
+            rst[i] = sinCos.sin + sinCos.cos;
+          }
+          else
+          {
+            rst[i] = Math::sin<TPrecision>(angles[i]) + Math::cos<TPrecision>(angles[i]);
+          }
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_SinCos, EPrecision::Precise, false)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_SinCos, EPrecision::Precise, true)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_SinCos, EPrecision::Fast, false)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_SinCos, EPrecision::Fast, true)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_SinCos, EPrecision::Table, true)->Arg(1024);
+
+template <EPrecision TPrecision>
+static void BM_EulerRotationMatrix(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  std::vector<Vec3f> rotations;
+  rotations.reserve(static_cast<size_t>(state.range(0)));
+
+  for (size_t i = 0; i < static_cast<size_t>(state.range(0)); i++)
+  {
+    rotations.emplace_back(RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX);
+  }
+
+  std::vector<Matrix4<float>> rst (rotations.size());
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < rotations.size(); i++)
+        {
+          rst[i] = Matrix4<float>::createFixedAngleEulerRotationMatrix<TPrecision>(rotations[i]);
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_EulerRotationMatrix, EPrecision::Precise)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_EulerRotationMatrix, EPrecision::Fast)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_EulerRotationMatrix, EPrecision::Table)->Arg(1024);
+
+static void BM_SinCosTableStep(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const Math::Table::SinCosTable<float, 1024> table;
+  std::vector<long long> steps (static_cast<size_t>(state.range(0)));
+
+  for (long long& step : steps)
+  {
+    step = std::rand() % 1024;
+  }
+
+  std::vector<Matrix4<float>> rst (steps.size());
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < steps.size(); i++)
+        {
+          const Math::SinCos<float>& sinCos = table.getStep(steps[i]);
+          rst[i] = Matrix4<float>{ sinCos.cos, -sinCos.sin, 0.f, 0.f,
+                                   sinCos.sin,  sinCos.cos, 0.f, 0.f,
+                                   0.f,         0.f,        1.f, 0.f,
+                                   0.f,         0.f,        0.f, 1.f};
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SinCosTableStep)->Arg(1024);
+
+template <size_t TLength, bool TLazy>
+static void BM_VectorLinearCombination(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  std::vector<GenericVector<TLength, float>> a (static_cast<size_t>(state.range(0)));
+  std::vector<GenericVector<TLength, float>> b (a.size());
+  std::vector<GenericVector<TLength, float>> c (a.size());
+  std::vector<GenericVector<TLength, float>> rst (a.size());
+
+  for (size_t i = 0; i < a.size(); i++)
+  {
+    for (size_t j = 0; j < TLength; j++)
+    {
+      a[i].setData(j, RAND_FLOAT);
+      b[i].setData(j, RAND_FLOAT);
+      c[i].setData(j, RAND_FLOAT);
+    }
+  }
+
+  const float s = RAND_FLOAT;
+  const float t = RAND_FLOAT;
+
+  for (auto _ : state)
+  {
+        for (size_t i = 0; i < a.size(); i++)
+        {
+          if constexpr (TLazy)
+          {
+            Expression::lazy(rst[i]) = Expression::lazy(a[i]) * s + Expression::lazy(b[i]) * t - c[i];
+          }
+          else
+          {
+            rst[i] = a[i] * s + b[i] * t - c[i];
+          }
+        }
+
+        benchmark::DoNotOptimize(rst.data());
+        benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_VectorLinearCombination, 3, false)->Arg(64);
+BENCHMARK_TEMPLATE(BM_VectorLinearCombination, 3, true)->Arg(64);
+BENCHMARK_TEMPLATE(BM_VectorLinearCombination, 16, false)->Arg(64);
+BENCHMARK_TEMPLATE(BM_VectorLinearCombination, 16, true)->Arg(64);
+BENCHMARK_TEMPLATE(BM_VectorLinearCombination, 64, false)->Arg(64);
+BENCHMARK_TEMPLATE(BM_VectorLinearCombination, 64, true)->Arg(64);
+
+template <size_t TSize, bool TLazy>
+static void BM_MatrixLinearCombination(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  std::unique_ptr<GenericMatrix<TSize, TSize, float>> a = std::make_unique<GenericMatrix<TSize, TSize, float>>();
+  std::unique_ptr<GenericMatrix<TSize, TSize, float>> b = std::make_unique<GenericMatrix<TSize, TSize, float>>();
+  std::unique_ptr<GenericMatrix<TSize, TSize, float>> c = std::make_unique<GenericMatrix<TSize, TSize, float>>();
+  std::unique_ptr<GenericMatrix<TSize, TSize, float>> rst = std::make_unique<GenericMatrix<TSize, TSize, float>>();
+
+  for (size_t j = 0; j < TSize * TSize; j++)
+  {
+    a->getData(j) = RAND_FLOAT;
+    b->getData(j) = RAND_FLOAT;
+    c->getData(j) = RAND_FLOAT;
+  }
+
+  const float s = RAND_FLOAT;
+  const float t = RAND_FLOAT;
+
+  for (auto _ : state)
+  {
+        if constexpr (TLazy)
+        {
+          Expression::lazy(*rst) = Expression::lazy(*a) * s + Expression::lazy(*b) * t - *c;
+        }
+        else
+        {
+          *rst = *a * s + *b * t - *c;
+        }
+
+        benchmark::DoNotOptimize(rst->getData().data());
+        benchmark::ClobberMemory();
+  }
+}
+BENCHMARK_TEMPLATE(BM_MatrixLinearCombination, 4, false);
+BENCHMARK_TEMPLATE(BM_MatrixLinearCombination, 4, true);
+BENCHMARK_TEMPLATE(BM_MatrixLinearCombination, 32, false);
+BENCHMARK_TEMPLATE(BM_MatrixLinearCombination, 32, true);
+
+template <bool TArena>
+static void BM_DynamicMatrixScratch(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const size_t size = static_cast<size_t>(state.range(0));
+
+  DynamicMatrix<float> mat (size, size);
+  DynamicVector<float> vec (size);
+
+  for (size_t i = 0; i < size * size; i++)
+    mat.getData(i) = RAND_FLOAT;
+
+  for (size_t i = 0; i < size; i++)
+    vec[i] = RAND_FLOAT;
+
+  Arena arena (4 * size * sizeof(float) + 256);
+
+  for (auto _ : state)
+  {
+        if constexpr (TArena)
+        {
+          ArenaAllocator<float> allocator (arena);
+          DynamicVectorArena<float> tmp (size, allocator);
+          DynamicVectorArena<float> rst (size, allocator);
+
+          multiply(mat.getView(), vec.getView(), tmp.getView());
+          multiply(mat.getView(), tmp.getView(), rst.getView());
+
+          benchmark::DoNotOptimize(rst.getData());
+          arena.reset();
+        }
+        else
+        {
+          DynamicVector<float> rst = mat * (mat * vec);
+
+          benchmark::DoNotOptimize(rst.getData());
+        }
+
+        benchmark::ClobberMemory();
+  }
+}
+BENCHMARK_TEMPLATE(BM_DynamicMatrixScratch, false)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_DynamicMatrixScratch, true)->Arg(16)->Arg(256);
+
+template <bool TDispatch>
+static void BM_MatrixMultiplySweep(benchmark::State& state) 
+{
+  std::srand (time(NULL));
+
+  const size_t size = static_cast<size_t>(state.range(0));
+
+  DynamicMatrix<float> lhs (size, size);
+  DynamicMatrix<float> rhs (size, size);
+  DynamicMatrix<float> rst (size, size);
+
+  for (size_t i = 0; i < size * size; i++)
+  {
+    lhs.getData(i) = RAND_FLOAT;
+    rhs.getData(i) = RAND_FLOAT;
+  }
+
+  for (auto _ : state)
+  {
+        /*multiply switch to the packed Gemm above Gemm::minMultiplyAddCount, multiplyBlocked is the reference*/
+        if constexpr (TDispatch)
+          MatrixKernel::multiply(lhs.getData(), rhs.getData(), rst.getData(), size, size, size);
+        else
+          MatrixKernel::multiplyBlocked(lhs.getData(), rhs.getData(), rst.getData(), size, size, size);
+
+        benchmark::DoNotOptimize(rst.getData());
+        benchmark::ClobberMemory();
+  }
+
+  state.counters["GFLOP/s"] = benchmark::Counter(2.0 * static_cast<double>(size * size * size) * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK_TEMPLATE(BM_MatrixMultiplySweep, false)->RangeMultiplier(2)->Range(4, 1024);
+BENCHMARK_TEMPLATE(BM_MatrixMultiplySweep, true)->RangeMultiplier(2)->Range(4, 1024)->UseRealTime();
 
 static void BM_NewAngle(benchmark::State& state)
 {
@@ -28,6 +28,12 @@
 
 #pragma once
 
+#include "Numeric/Math.hpp" //Math::sin, Math::cos, Math::sqrt, Math::pow
+#include "Numeric/EPrecision.hpp" //EPrecision
+
+#include <concepts> //std::floating_point
+#include <numbers> //std::numbers::pi_v
+
 /**
  * @see : https://easings.net/
  */
@@ -52,38 +58,41 @@ inline constexpr T ten = static_cast<T>(10);
 
 /**
  * @brief easeInSine interpolation
+ * @tparam TPrecision : EPrecision::Fast use minimax sin and cos
  * @tparam T : floating type of the variable
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = EPrecision::Precise, std::floating_point T>
 inline constexpr T easeInSine(T x)
 {
-    return one<T> - std::cos((x * std::numbers::pi_v<T>) / one<T>);
+    return one<T> - Math::cos<TPrecision>((x * std::numbers::pi_v<T>) / one<T>);
 }
 
 /**
  * @brief easeOutSine interpolation
+ * @tparam TPrecision : EPrecision::Fast use minimax sin and cos
  * @tparam T : floating type of the variable
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = EPrecision::Precise, std::floating_point T>
 inline constexpr T easeOutSine(T x)
 {
-    return std::sin((x * std::numbers::pi_v<T>) / two<T>);
+    return Math::sin<TPrecision>((x * std::numbers::pi_v<T>) / two<T>);
 }
 
 /**
  * @brief easeInOutSine interpolation
+ * @tparam TPrecision : EPrecision::Fast use minimax sin and cos
  * @tparam T : floating type of the variable
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = EPrecision::Precise, std::floating_point T>
 inline constexpr T easeInOutSine(T x)
 {
-    return -(std::cos(std::numbers::pi_v<T> * x) - one<T>) / two<T>;
+    return -(Math::cos<TPrecision>(std::numbers::pi_v<T> * x) - one<T>) / two<T>;
 }
 
 /**
@@ -95,7 +104,7 @@ inline constexpr T easeInOutSine(T x)
 template <size_t Pow = 2, std::floating_point T>
 inline constexpr T easeIn(T x)
 {
-    return std::pow(x, Pow);
+    return Math::pow(x, Pow);
 }
 
 /**
@@ -107,7 +116,7 @@ inline constexpr T easeIn(T x)
 template <size_t Pow = 2, std::floating_point T>
 inline constexpr T easeOut(T x)
 {
-    return one<T> - std::pow(one<T> - x, Pow);
+    return one<T> - Math::pow(one<T> - x, Pow);
 }
 
 /**
@@ -119,32 +128,34 @@ inline constexpr T easeOut(T x)
 template <size_t Pow = 2, std::floating_point T>
 inline constexpr T easeInOut(T x)
 {
-    return x < half_one<T> ? std::pow(two<T>, Pow - 1) * std::pow(x, Pow)
-                           : one<T> - std::pow(-two<T> * x + two<T>, Pow) / two<T>;
+    return x < half_one<T> ? Math::pow(two<T>, Pow - 1) * Math::pow(x, Pow)
+                           : one<T> - Math::pow(-two<T> * x + two<T>, Pow) / two<T>;
 }
 
 /**
  * @brief easeInCirc interpolation
+ * @tparam TPrecision : EPrecision::Fast use x * rsqrt(x) for sqrt
  * @tparam T : floating type of the variable
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = EPrecision::Precise, std::floating_point T>
 inline constexpr T easeInCirc(T x)
 {
-    return one<T> - std::sqrt(one<T> - std::pow(x, 2));
+    return one<T> - Math::sqrt<TPrecision>(one<T> - Math::pow(x, 2));
 }
 
 /**
  * @brief easeInCirc interpolation
+ * @tparam TPrecision : EPrecision::Fast use x * rsqrt(x) for sqrt
  * @tparam T : floating type of the variable
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = EPrecision::Precise, std::floating_point T>
 inline constexpr T easeOutCirc(T x)
 {
-    return std::sqrt(one<T> - std::pow(x - one<T>, 2));
+    return Math::sqrt<TPrecision>(one<T> - Math::pow(x - one<T>, 2));
 }
 
 /**
@@ -174,7 +185,7 @@ inline constexpr T easeOutBack(T x)
     const T c1 = static_cast<T>(1.70158);
     const T c3 = c1 + one<T>;
 
-    return one<T> + c3 * pow(x - one<T>, 3) + c1 * pow(x - one<T>, 2);
+    return one<T> + c3 * Math::pow(x - one<T>, 3) + c1 * Math::pow(x - one<T>, 2);
 }
 
 /**
@@ -190,60 +201,63 @@ inline constexpr T easeInOutBack(T x)
     const T c2 = c1 * static_cast<T>(1.525);
 
     return x < half_one<T>
-               ? (std::pow(two<T> * x, 2) * ((c2 + one<T>)*two<T> * x - c2)) / two<T>
-               : (std::pow(two<T> * x - two<T>, 2) * ((c2 + one<T>)*(x * two<T> - two<T>)+c2) + two<T>) / two<T>;
+               ? (Math::pow(two<T> * x, 2) * ((c2 + one<T>)*two<T> * x - c2)) / two<T>
+               : (Math::pow(two<T> * x - two<T>, 2) * ((c2 + one<T>)*(x * two<T> - two<T>)+c2) + two<T>) / two<T>;
 }
 
 /**
  * @brief easeInElastic interpolation
+ * @tparam TPrecision : EPrecision::Fast use minimax sin and cos
  * @tparam T : floating type of the variable
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = EPrecision::Precise, std::floating_point T>
 inline constexpr T easeInElastic(T x)
 {
     const T c4 = (two<T> * std::numbers::pi_v<T>) / three<T>;
 
     return x == zero<T>  ? zero<T>
            : x == one<T> ? one<T>
-                         : -std::pow(two<T>, ten<T> * x - ten<T>) * std::sin((x * ten<T> - static_cast<T>(10.75)) * c4);
+                         : -Math::pow(two<T>, ten<T> * x - ten<T>) * Math::sin<TPrecision>((x * ten<T> - static_cast<T>(10.75)) * c4);
 }
 
 /**
  * @brief easeOutElastic interpolation
+ * @tparam TPrecision : EPrecision::Fast use minimax sin and cos
  * @tparam T : floating type of the variable
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = EPrecision::Precise, std::floating_point T>
 inline constexpr T easeOutElastic(T x)
 {
     const T c4 = (two<T> * std::numbers::pi_v<T>) / three<T>;
 
     return x == zero<T>  ? zero<T>
            : x == one<T> ? one<T>
-                         : std::pow(two<T>, -ten<T> * x) * sin((x * ten<T> - static_cast<T>(0.75)) * c4) + one<T>;
+                         : Math::pow(two<T>, -ten<T> * x) * Math::sin<TPrecision>((x * ten<T> - static_cast<T>(0.75)) * c4) + one<T>;
 }
 
 /**
  * @brief easeInOutElastic interpolation
+ * @tparam TPrecision : EPrecision::Fast use minimax sin and cos
  * @tparam T : floating type of the variable
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = EPrecision::Precise, std::floating_point T>
 inline constexpr T easeInOutElastic(T x)
 {
     const T c5 = (two<T> * std::numbers::pi_v<T>) / static_cast<T>(4.5);
 
     return x == zero<T>      ? zero<T>
            : x == one<T>     ? one<T>
-           : x < half_one<T> ? -(std::pow(two<T>, static_cast<T>(20) * x - ten<T>) *
-                                 std::sin((static_cast<T>(20) * x - static_cast<T>(11.125)) * c5)) /
+           : x < half_one<T> ? -(Math::pow(two<T>, static_cast<T>(20) * x - ten<T>) *
+                                 Math::sin<TPrecision>((static_cast<T>(20) * x - static_cast<T>(11.125)) * c5)) /
                                    two<T>
-                             : (std::pow(two<T>, -static_cast<T>(20) * x + ten<T>) *
-                                std::sin((static_cast<T>(20) * x - static_cast<T>(11.125)) * c5)) /
+                             : (Math::pow(two<T>, -static_cast<T>(20) * x + ten<T>) *
+                                Math::sin<TPrecision>((static_cast<T>(20) * x - static_cast<T>(11.125)) * c5)) /
                                        two<T> +
                                    one<T>;
 }
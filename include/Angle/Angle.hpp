@@ -36,6 +36,8 @@
 #include "Types/Operators/Comparison.hpp"
 #include "Angle/EAngleType.hpp"
 #include "Types/Implicit.hpp"
+#include "Numeric/EPrecision.hpp" //EPrecision
+#include "Numeric/Math.hpp" //Math::sincos, Math::SinCos, Math::Real
 
 namespace FoxMath
 {
@@ -134,6 +136,16 @@ namespace FoxMath
         [[nodiscard]] inline constexpr
         Angle<EAngleType::Radian, TOtherType> toRadian() const noexcept;
 
+        /**
+         * @brief Sine and cosine of the angle computed together. Degree angle is converted to radian first
+         * 
+         * @tparam TPrecision : EPrecision::Fast use minimax sin and cos, EPrecision::Table use the shared lookup table of Math::Table
+         * @return constexpr Math::SinCos<Math::Real<TType>> 
+         */
+        template <EPrecision TPrecision = EPrecision::Precise>
+        [[nodiscard]] inline constexpr
+        Math::SinCos<Math::Real<TType>> getSinCos() const noexcept;
+
         #pragma endregion //!methods
     
         #pragma region accessor
@@ -82,6 +82,14 @@ Angle<EAngleType::Radian, TOtherType> Angle<TAngleType, TType>::toRadian() const
     }
 }
 
+template <EAngleType TAngleType, typename TType>
+template <EPrecision TPrecision>
+inline constexpr
+Math::SinCos<Math::Real<TType>> Angle<TAngleType, TType>::getSinCos() const noexcept
+{
+    return Math::sincos<TPrecision>(toRadian<Math::Real<TType>>().getAngle());
+}
+
 template <EAngleType TAngleType, typename TType>
 inline constexpr
 const TType& Angle<TAngleType, TType>::getAngle() const noexcept
@@ -0,0 +1,101 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+namespace FoxMath
+{
+    /**
+     * @brief Order of the three rotations of an Euler angle, read as extrinsic rotations around the fixed axes of the referential.
+     * XYZ rotate around X, then around Y, then around Z : R = Rz * Ry * Rx (same as intrinsic rotations z-y'-x'').
+     * The first six orders are Tait-Bryan angles (three different axes), the last six are proper Euler angles (first and last axis are the same).
+     */
+    enum class EEulerOrder
+    {
+        XYZ,
+        XZY,
+        YXZ,
+        YZX,
+        ZXY,
+        ZYX,
+        XYX,
+        XZX,
+        YXY,
+        YZY,
+        ZXZ,
+        ZYZ
+    };
+
+    [[nodiscard]] constexpr inline
+    const char* eulerOrderToString (EEulerOrder order) noexcept
+    {
+        switch (order)
+        {
+        case EEulerOrder::XYZ:
+            return "XYZ";
+
+        case EEulerOrder::XZY:
+            return "XZY";
+
+        case EEulerOrder::YXZ:
+            return "YXZ";
+
+        case EEulerOrder::YZX:
+            return "YZX";
+
+        case EEulerOrder::ZXY:
+            return "ZXY";
+
+        case EEulerOrder::ZYX:
+            return "ZYX";
+
+        case EEulerOrder::XYX:
+            return "XYX";
+
+        case EEulerOrder::XZX:
+            return "XZX";
+
+        case EEulerOrder::YXY:
+            return "YXY";
+
+        case EEulerOrder::YZY:
+            return "YZY";
+
+        case EEulerOrder::ZXZ:
+            return "ZXZ";
+
+        case EEulerOrder::ZYZ:
+            return "ZYZ";
+        
+        default:
+            return "Unknow";
+        }
+    }
+
+} /*namespace FoxMath*/
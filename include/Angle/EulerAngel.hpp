@@ -29,9 +29,343 @@
 
 #pragma once
 
+#include "Angle/Angle.hpp" //Angle
+#include "Angle/EEulerOrder.hpp" //EEulerOrder
+#include "Vector/Vector3.hpp" //Vector3<TType>
+#include "Vector/VectorBatch.hpp" //VectorBatch
+#include "Matrix/Matrix3.hpp" //Matrix3
+#include "Matrix/Matrix4.hpp" //Matrix4
+#include "Quaternion/Quaternion.hpp" //Quaternion
+#include "Quaternion/QuaternionBatch.hpp" //QuaternionBatch
+#include "Numeric/Math.hpp" //Math::sincos, Math::atan2, Math::sqrt, Math::Fast::sincosPacket
+#include "Numeric/EPrecision.hpp" //EPrecision
+#include "Numeric/SIMD.hpp" //SIMD::Packet
+#include "Thread/ParallelFor.hpp" //parallelFor
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <iostream> //std::ostream
+#include <limits> //std::numeric_limits
+#include <stddef.h> //sizt_t
+
 namespace FoxMath
 {
+    /*Use of IsArithmetic*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class EulerAngle;
+
+    /**
+     * @brief Three rotations in radian around the axes given by an EEulerOrder. Angles are stored by rotation step : for EEulerOrder::XYZ,
+     * the first angle rotate around X, the second around Y and the third around Z. Conversions to and from Matrix3, Matrix4 and Quaternion are closed form
+     * for the 12 orders (no intermediate matrix product) and compute one fused sincos per axis.
+     * Conversions from rotation return the first angle and the third angle in [-pi, pi]. The second angle is in [-pi/2, pi/2] for Tait-Bryan orders
+     * and in [0, pi] for proper Euler orders. On gimbal lock, the first angle is 0 and the third angle hold the whole rotation.
+     * @example `FoxMath::EulerAngle<float> euler (Vec3f{pitch, yaw, roll}, EEulerOrder::YXZ); Quaternion<float> q = euler.toQuaternion();`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class EulerAngle<TType>
+    {
+        private:
+
+        using Packet = SIMD::Packet<TType>;
+        using PacketType = typename Packet::Type;
+
+        protected:
+
+        /**
+         * @brief Axes of an order : rotations are around first, second and first (proper Euler) or third (Tait-Bryan) axis.
+         * third is always the axis not used by first and second. parity is 1 if (first, second, third) is a direct permutation of (X, Y, Z), else -1
+         */
+        struct Axes
+        {
+            size_t  first;
+            size_t  second;
+            size_t  third;
+            TType   parity;
+            bool    isProperEuler;
+        };
+
+        #pragma region attribut
+
+        Vector3<TType> m_angles {};
+        EEulerOrder    m_order  {EEulerOrder::XYZ};
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        [[nodiscard]] static inline constexpr
+        Axes getAxes (EEulerOrder order) noexcept;
+
+        /**
+         * @brief Rotation matrix coefficients in math notation (m[row][column]) of the unit quaternion
+         */
+        static inline constexpr
+        void getRotationCoefficients (const Quaternion<TType>& quaternion, TType (&m)[3][3]) noexcept;
+
+        /**
+         * @brief Rotation matrix coefficients in math notation (m[row][column]) of the Euler angle. One sincos by angle
+         */
+        template <EPrecision TPrecision>
+        inline constexpr
+        void getRotationCoefficients (TType (&m)[3][3]) const noexcept;
+
+        /**
+         * @brief Closed form extraction of the angles of order from rotation matrix coefficients in math notation
+         */
+        [[nodiscard]] static inline
+        EulerAngle createFromRotationCoefficients (const TType (&m)[3][3], EEulerOrder order) noexcept;
+
+        /**
+         * @brief atan2 of Packet::size points. Use the Cephes atanf polynomial after reduction on [0, tan(pi/8)] (absolute error < 2e-7 on float).
+         * Without SIMD packet, use Math::atan2
+         */
+        [[nodiscard]] static inline
+        PacketType atan2Packet (PacketType y, PacketType x) noexcept;
+
+        /**
+         * @brief Closed form conversion of Packet::size Euler angles to quaternions (x, y, z, w)
+         */
+        static inline
+        void quaternionPacket (const PacketType (&angles)[3], const Axes& axes, PacketType (&quaternion)[4]) noexcept;
+
+        /**
+         * @brief Closed form conversion of Packet::size unit quaternions (x, y, z, w) to Euler angles
+         */
+        static inline
+        void anglesPacket (const PacketType (&quaternion)[4], const Axes& axes, PacketType (&angles)[3]) noexcept;
+
+        /**
+         * @brief Call functor(index) for each packet of [0, count[ across threads. Streams of VectorBatch are padded so the last packet can be full
+         */
+        template <typename TFunctor>
+        static inline
+        void forEachPacket (size_t count, TFunctor&& functor) noexcept;
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Create null rotation with order XYZ
+         * 
+         */
+        constexpr inline
+        EulerAngle () noexcept                                      = default;
+
+        constexpr inline
+        EulerAngle (const EulerAngle& other) noexcept				= default;
+
+        constexpr inline
+        EulerAngle (EulerAngle&& other) noexcept				    = default;
+
+        inline
+        ~EulerAngle () noexcept				                        = default;
+
+        constexpr inline
+        EulerAngle& operator=(EulerAngle const& other) noexcept	    = default;
+
+        constexpr inline
+        EulerAngle& operator=(EulerAngle && other) noexcept         = default;
+
+        /**
+         * @brief Create Euler angle based on angles in radian sorted by rotation step
+         * 
+         * @param angles : first, second and third angle
+         * @param order 
+         */
+        explicit constexpr inline
+        EulerAngle (const Vector3<TType>& angles, EEulerOrder order = EEulerOrder::XYZ) noexcept;
+
+        /**
+         * @brief Create Euler angle based on the angle of each rotation step
+         * 
+         * @param first 
+         * @param second 
+         * @param third 
+         * @param order 
+         */
+        constexpr inline
+        EulerAngle (Angle<EAngleType::Radian, TType> first, Angle<EAngleType::Radian, TType> second, Angle<EAngleType::Radian, TType> third, EEulerOrder order = EEulerOrder::XYZ) noexcept;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Convert to unit quaternion. q = q3 * q2 * q1 with one sincos by half angle
+         * 
+         * @tparam TPrecision : EPrecision::Fast use minimax sin and cos, EPrecision::Table use the shared lookup table of Math::Table
+         * @return Quaternion<TType> 
+         */
+        template <EPrecision TPrecision = EPrecision::Precise>
+        [[nodiscard]] inline
+        Quaternion<TType> toQuaternion() const noexcept;
+
+        /**
+         * @brief Convert to rotation matrix in math notation : matrix * v rotate v
+         * 
+         * @tparam TMatrixConvention 
+         * @tparam TPrecision : EPrecision::Fast use minimax sin and cos, EPrecision::Table use the shared lookup table of Math::Table
+         * @return constexpr Matrix3<TType, TMatrixConvention> 
+         */
+        template <EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor, EPrecision TPrecision = EPrecision::Precise>
+        [[nodiscard]] inline constexpr
+        Matrix3<TType, TMatrixConvention> toMatrix3() const noexcept;
+
+        /**
+         * @brief Convert to rotation matrix in math notation without translation. XYZ give the same matrix than Matrix4::createFixedAngleEulerRotationMatrix
+         * 
+         * @tparam TMatrixConvention 
+         * @tparam TPrecision : EPrecision::Fast use minimax sin and cos, EPrecision::Table use the shared lookup table of Math::Table
+         * @return constexpr Matrix4<TType, TMatrixConvention> 
+         */
+        template <EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor, EPrecision TPrecision = EPrecision::Precise>
+        [[nodiscard]] inline constexpr
+        Matrix4<TType, TMatrixConvention> toMatrix4() const noexcept;
+
+        /**
+         * @brief Get the same rotation expressed with an other order. Go through the closed form quaternion conversions
+         * 
+         * @param order 
+         * @return EulerAngle 
+         */
+        [[nodiscard]] inline
+        EulerAngle getReordered(EEulerOrder order) const noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region static methods
+
+        /**
+         * @brief Create Euler angle from unit quaternion
+         * 
+         * @param quaternion : unit quaternion
+         * @param order 
+         * @return EulerAngle 
+         */
+        [[nodiscard]] static inline
+        EulerAngle createFromQuaternion(const Quaternion<TType>& quaternion, EEulerOrder order = EEulerOrder::XYZ) noexcept;
+
+        /**
+         * @brief Create Euler angle from rotation matrix in math notation
+         * 
+         * @tparam TMatrixConvention 
+         * @param rotation : orthonormal matrix
+         * @param order 
+         * @return EulerAngle 
+         */
+        template <EMatrixConvention TMatrixConvention>
+        [[nodiscard]] static inline
+        EulerAngle createFromMatrix(const Matrix3<TType, TMatrixConvention>& rotation, EEulerOrder order = EEulerOrder::XYZ) noexcept;
+
+        /**
+         * @brief Create Euler angle from the rotation part of a matrix in math notation
+         * 
+         * @tparam TMatrixConvention 
+         * @param transform : matrix with orthonormal upper 3x3 part (use Matrix4::decomposeTRS to remove scale)
+         * @param order 
+         * @return EulerAngle 
+         */
+        template <EMatrixConvention TMatrixConvention>
+        [[nodiscard]] static inline
+        EulerAngle createFromMatrix(const Matrix4<TType, TMatrixConvention>& transform, EEulerOrder order = EEulerOrder::XYZ) noexcept;
+
+        /**
+         * @brief Convert batch of Euler angles with the same order to unit quaternions. Process Packet::size angles per step (8 with AVX) with polynomial sin and cos
+         * and split big batches across threads. dst is resized to the size of angles.
+         * @example `EulerAngle<float>::toQuaternions(importedKeys, EEulerOrder::ZYX, rotationKeys);`
+         * 
+         * @param angles : first, second and third angle of each rotation (see getAngles)
+         * @param order 
+         * @param dst 
+         */
+        static inline
+        void toQuaternions(const VectorBatch<3, TType>& angles, EEulerOrder order, QuaternionBatch<TType>& dst);
+
+        /**
+         * @brief Convert batch of unit quaternions to Euler angles of order. Process Packet::size quaternions per step with polynomial atan2
+         * and split big batches across threads. dst is resized to the size of quaternions.
+         * 
+         * @param quaternions : unit quaternions
+         * @param order 
+         * @param dst : first, second and third angle of each rotation
+         */
+        static inline
+        void fromQuaternions(const QuaternionBatch<TType>& quaternions, EEulerOrder order, VectorBatch<3, TType>& dst);
+
+        /**
+         * @brief Express batch of Euler angles with an other order without intermediate matrix or buffer. angles and dst can be the same batch.
+         * 
+         * @param angles 
+         * @param srcOrder : order of angles
+         * @param dstOrder : order of dst
+         * @param dst 
+         */
+        static inline
+        void reorder(const VectorBatch<3, TType>& angles, EEulerOrder srcOrder, EEulerOrder dstOrder, VectorBatch<3, TType>& dst);
+
+        #pragma endregion //!static methods
+
+        #pragma region accessor
+
+        /**
+         * @brief Get angles in radian sorted by rotation step
+         * 
+         * @return constexpr const Vector3<TType>& 
+         */
+        [[nodiscard]] inline constexpr
+        const Vector3<TType>& getAngles() const noexcept { return m_angles; }
+
+        [[nodiscard]] inline constexpr
+        Angle<EAngleType::Radian, TType> getFirst() const noexcept { return Angle<EAngleType::Radian, TType>(m_angles.getX()); }
+
+        [[nodiscard]] inline constexpr
+        Angle<EAngleType::Radian, TType> getSecond() const noexcept { return Angle<EAngleType::Radian, TType>(m_angles.getY()); }
+
+        [[nodiscard]] inline constexpr
+        Angle<EAngleType::Radian, TType> getThird() const noexcept { return Angle<EAngleType::Radian, TType>(m_angles.getZ()); }
+
+        [[nodiscard]] inline constexpr
+        EEulerOrder getOrder() const noexcept { return m_order; }
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        inline constexpr
+        void setAngles(const Vector3<TType>& angles) noexcept { m_angles = angles; }
+
+        /**
+         * @brief Change the order without changing the angles (the rotation change). Use getReordered to keep the rotation
+         * 
+         * @param order 
+         */
+        inline constexpr
+        void setOrder(EEulerOrder order) noexcept { m_order = order; }
+
+        #pragma endregion //!mutator
+    };
+
+    #pragma region stream operators
+
+    /**
+     * @brief output stream : order then first, second and third angle in radian
+     * 
+     * @tparam TType 
+     * @param out 
+     * @param eulerAngle 
+     * @return std::ostream& 
+     */
+    template <typename TType>
+    inline
+    std::ostream& 	operator<<		(std::ostream& out, const EulerAngle<TType>& eulerAngle) noexcept;
 
+    #pragma endregion //!stream operators
 
+    #include "EulerAngel.inl"
 
 } /*namespace FoxMath*/
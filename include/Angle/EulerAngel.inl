@@ -0,0 +1,524 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+inline constexpr
+typename EulerAngle<TType>::Axes EulerAngle<TType>::getAxes (EEulerOrder order) noexcept
+{
+    /*Orders are sorted by first axis then second axis, Tait-Bryan orders before proper Euler orders*/
+    constexpr size_t firstAxes[6]   = {0, 0, 1, 1, 2, 2};
+    constexpr size_t secondAxes[6]  = {1, 2, 0, 2, 0, 1};
+
+    const size_t index  = static_cast<size_t>(order) % 6;
+    const size_t first  = firstAxes[index];
+    const size_t second = secondAxes[index];
+
+    return Axes {first, second, 3 - first - second, (second == (first + 1) % 3) ? static_cast<TType>(1) : static_cast<TType>(-1), static_cast<size_t>(order) >= 6};
+}
+
+template <typename TType>
+inline constexpr
+void EulerAngle<TType>::getRotationCoefficients (const Quaternion<TType>& quaternion, TType (&m)[3][3]) noexcept
+{
+    const TType x = quaternion.getX();
+    const TType y = quaternion.getY();
+    const TType z = quaternion.getZ();
+    const TType w = quaternion.getW();
+    const TType one = static_cast<TType>(1);
+    const TType two = static_cast<TType>(2);
+
+    m[0][0] = one - two * (y * y + z * z);
+    m[0][1] = two * (x * y - w * z);
+    m[0][2] = two * (x * z + w * y);
+    m[1][0] = two * (x * y + w * z);
+    m[1][1] = one - two * (x * x + z * z);
+    m[1][2] = two * (y * z - w * x);
+    m[2][0] = two * (x * z - w * y);
+    m[2][1] = two * (y * z + w * x);
+    m[2][2] = one - two * (x * x + y * y);
+}
+
+template <typename TType>
+inline
+EulerAngle<TType> EulerAngle<TType>::createFromRotationCoefficients (const TType (&m)[3][3], EEulerOrder order) noexcept
+{
+    const Axes axes = getAxes(order);
+    const size_t i  = axes.first;
+    const size_t j  = axes.second;
+    const size_t k  = axes.third;
+    const TType  s  = axes.parity;
+
+    /*cosFirst and sinFirst are scaled by cos(second) (Tait-Bryan) or sin(second) (proper Euler) which are positive*/
+    TType cosFirst, sinFirst, second;
+
+    if (axes.isProperEuler)
+    {
+        cosFirst    = s * m[i][k];
+        sinFirst    = m[i][j];
+        second      = static_cast<TType>(Math::atan2(Math::sqrt(m[i][j] * m[i][j] + m[i][k] * m[i][k]), m[i][i]));
+    }
+    else
+    {
+        cosFirst    = m[k][k];
+        sinFirst    = s * m[k][j];
+        second      = static_cast<TType>(Math::atan2(-s * m[k][i], Math::sqrt(m[i][i] * m[i][i] + m[j][i] * m[j][i])));
+    }
+
+    /*Gimbal lock : first and third rotations are around the same axis, the third angle hold the whole rotation*/
+    if (cosFirst * cosFirst + sinFirst * sinFirst < std::numeric_limits<TType>::epsilon() * std::numeric_limits<TType>::epsilon())
+    {
+        cosFirst = static_cast<TType>(1);
+        sinFirst = static_cast<TType>(0);
+    }
+
+    /*The third angle is extracted with the first angle to stay exact near the gimbal lock*/
+    const TType first = static_cast<TType>(Math::atan2(sinFirst, cosFirst));
+    const TType third = axes.isProperEuler  ? static_cast<TType>(Math::atan2(s * cosFirst * m[k][j] - sinFirst * m[k][k], cosFirst * m[j][j] - s * sinFirst * m[j][k]))
+                                            : static_cast<TType>(Math::atan2(sinFirst * m[i][k] - s * cosFirst * m[i][j], cosFirst * m[j][j] - s * sinFirst * m[j][k]));
+
+    return EulerAngle(Vector3<TType>(first, second, third), order);
+}
+
+template <typename TType>
+inline
+typename EulerAngle<TType>::PacketType EulerAngle<TType>::atan2Packet (PacketType y, PacketType x) noexcept
+{
+    if constexpr (Packet::size == 1)
+    {
+        return static_cast<TType>(Math::atan2(y, x));
+    }
+    else
+    {
+        const PacketType zero       = Packet::set1(static_cast<TType>(0));
+        const PacketType one        = Packet::set1(static_cast<TType>(1));
+        const PacketType tanPiOn8   = Packet::set1(static_cast<TType>(0.414213562373095048801688724209698079));
+
+        const PacketType absX   = Packet::abs(x);
+        const PacketType absY   = Packet::abs(y);
+        const PacketType ratio  = Packet::div(Packet::min(absX, absY), Packet::max(Packet::max(absX, absY), Packet::set1(std::numeric_limits<TType>::min())));
+
+        /*atan(z) = pi/4 + atan((z - 1) / (z + 1)) reduce the ratio on [0, tan(pi/8)]*/
+        const PacketType reduced    = Packet::selectIfLess(tanPiOn8, ratio, Packet::div(Packet::sub(ratio, one), Packet::add(ratio, one)), ratio);
+        const PacketType offset     = Packet::selectIfLess(tanPiOn8, ratio, Packet::set1(static_cast<TType>(0.785398163397448309615660845819875721)), zero);
+        const PacketType reduced2   = Packet::mul(reduced, reduced);
+
+        PacketType poly = Packet::set1(static_cast<TType>(8.05374449538e-2));
+        poly = Packet::mulAdd(Packet::set1(static_cast<TType>(-1.38776856032e-1)), poly, reduced2);
+        poly = Packet::mulAdd(Packet::set1(static_cast<TType>(1.99777106478e-1)), poly, reduced2);
+        poly = Packet::mulAdd(Packet::set1(static_cast<TType>(-3.33329491539e-1)), poly, reduced2);
+
+        /*Unfold the octant then the quadrant*/
+        PacketType angle = Packet::add(offset, Packet::mulAdd(reduced, Packet::mul(reduced, reduced2), poly));
+        angle = Packet::selectIfLess(absX, absY, Packet::sub(Packet::set1(static_cast<TType>(1.57079632679489661923)), angle), angle);
+        angle = Packet::selectIfLess(x, zero, Packet::sub(Packet::set1(static_cast<TType>(3.14159265358979323846)), angle), angle);
+        return Packet::selectIfLess(y, zero, Packet::sub(zero, angle), angle);
+    }
+}
+
+template <typename TType>
+inline
+void EulerAngle<TType>::quaternionPacket (const PacketType (&angles)[3], const Axes& axes, PacketType (&quaternion)[4]) noexcept
+{
+    const PacketType half   = Packet::set1(static_cast<TType>(0.5));
+    const PacketType s      = Packet::set1(axes.parity);
+
+    PacketType s0, c0, s1, c1, s2, c2;
+    Math::Fast::sincosPacket<TType>(Packet::mul(angles[0], half), s0, c0);
+    Math::Fast::sincosPacket<TType>(Packet::mul(angles[1], half), s1, c1);
+    Math::Fast::sincosPacket<TType>(Packet::mul(angles[2], half), s2, c2);
+
+    if (axes.isProperEuler)
+    {
+        quaternion[axes.first]  = Packet::mul(c1, Packet::mulAdd(Packet::mul(c2, s0), s2, c0));
+        quaternion[axes.second] = Packet::mul(s1, Packet::mulAdd(Packet::mul(c2, c0), s2, s0));
+        quaternion[axes.third]  = Packet::mul(Packet::mul(s, s1), Packet::sub(Packet::mul(s2, c0), Packet::mul(c2, s0)));
+        quaternion[3]           = Packet::mul(c1, Packet::sub(Packet::mul(c2, c0), Packet::mul(s2, s0)));
+    }
+    else
+    {
+        const PacketType c1c0 = Packet::mul(c1, c0);
+        const PacketType s1s0 = Packet::mul(s1, s0);
+        const PacketType c1s0 = Packet::mul(c1, s0);
+        const PacketType s1c0 = Packet::mul(s1, c0);
+        const PacketType ss2  = Packet::mul(s, s2);
+
+        quaternion[axes.first]  = Packet::sub(Packet::mul(c2, c1s0), Packet::mul(ss2, s1c0));
+        quaternion[axes.second] = Packet::mulAdd(Packet::mul(c2, s1c0), ss2, c1s0);
+        quaternion[axes.third]  = Packet::sub(Packet::mul(s2, c1c0), Packet::mul(Packet::mul(s, c2), s1s0));
+        quaternion[3]           = Packet::mulAdd(Packet::mul(c2, c1c0), ss2, s1s0);
+    }
+}
+
+template <typename TType>
+inline
+void EulerAngle<TType>::anglesPacket (const PacketType (&quaternion)[4], const Axes& axes, PacketType (&angles)[3]) noexcept
+{
+    const PacketType one    = Packet::set1(static_cast<TType>(1));
+    const PacketType two    = Packet::set1(static_cast<TType>(2));
+    const PacketType s      = Packet::set1(axes.parity);
+    const size_t i = axes.first;
+    const size_t j = axes.second;
+    const size_t k = axes.third;
+
+    /*Rotation matrix coefficients in math notation (see getRotationCoefficients)*/
+    const PacketType x = quaternion[0];
+    const PacketType y = quaternion[1];
+    const PacketType z = quaternion[2];
+    const PacketType w = quaternion[3];
+
+    PacketType m[3][3];
+    m[0][0] = Packet::sub(one, Packet::mul(two, Packet::mulAdd(Packet::mul(y, y), z, z)));
+    m[0][1] = Packet::mul(two, Packet::sub(Packet::mul(x, y), Packet::mul(w, z)));
+    m[0][2] = Packet::mul(two, Packet::mulAdd(Packet::mul(x, z), w, y));
+    m[1][0] = Packet::mul(two, Packet::mulAdd(Packet::mul(x, y), w, z));
+    m[1][1] = Packet::sub(one, Packet::mul(two, Packet::mulAdd(Packet::mul(x, x), z, z)));
+    m[1][2] = Packet::mul(two, Packet::sub(Packet::mul(y, z), Packet::mul(w, x)));
+    m[2][0] = Packet::mul(two, Packet::sub(Packet::mul(x, z), Packet::mul(w, y)));
+    m[2][1] = Packet::mul(two, Packet::mulAdd(Packet::mul(y, z), w, x));
+    m[2][2] = Packet::sub(one, Packet::mul(two, Packet::mulAdd(Packet::mul(x, x), y, y)));
+
+    /*Same extraction than createFromRotationCoefficients with branch free gimbal lock*/
+    PacketType cosFirst, sinFirst;
+
+    if (axes.isProperEuler)
+    {
+        cosFirst    = Packet::mul(s, m[i][k]);
+        sinFirst    = m[i][j];
+        angles[1]   = atan2Packet(Packet::sqrt(Packet::mulAdd(Packet::mul(m[i][j], m[i][j]), m[i][k], m[i][k])), m[i][i]);
+    }
+    else
+    {
+        cosFirst    = m[k][k];
+        sinFirst    = Packet::mul(s, m[k][j]);
+        angles[1]   = atan2Packet(Packet::mul(Packet::sub(Packet::set1(static_cast<TType>(0)), s), m[k][i]), Packet::sqrt(Packet::mulAdd(Packet::mul(m[i][i], m[i][i]), m[j][i], m[j][i])));
+    }
+
+    const PacketType squaredScale   = Packet::mulAdd(Packet::mul(cosFirst, cosFirst), sinFirst, sinFirst);
+    const PacketType lockThreshold  = Packet::set1(std::numeric_limits<TType>::epsilon() * std::numeric_limits<TType>::epsilon());
+    cosFirst = Packet::selectIfLess(squaredScale, lockThreshold, one, cosFirst);
+    sinFirst = Packet::selectIfLess(squaredScale, lockThreshold, Packet::set1(static_cast<TType>(0)), sinFirst);
+
+    angles[0] = atan2Packet(sinFirst, cosFirst);
+
+    const PacketType thirdCos = Packet::sub(Packet::mul(cosFirst, m[j][j]), Packet::mul(Packet::mul(s, sinFirst), m[j][k]));
+
+    if (axes.isProperEuler)
+        angles[2] = atan2Packet(Packet::sub(Packet::mul(Packet::mul(s, cosFirst), m[k][j]), Packet::mul(sinFirst, m[k][k])), thirdCos);
+    else
+        angles[2] = atan2Packet(Packet::sub(Packet::mul(sinFirst, m[i][k]), Packet::mul(Packet::mul(s, cosFirst), m[i][j])), thirdCos);
+}
+
+template <typename TType>
+template <typename TFunctor>
+inline
+void EulerAngle<TType>::forEachPacket (size_t count, TFunctor&& functor) noexcept
+{
+    const size_t packetCount = (count + Packet::size - 1) / Packet::size;
+
+    parallelFor(packetCount, defaultParallelGrain / Packet::size, [&](size_t begin, size_t end)
+    {
+        for (size_t packet = begin; packet < end; packet++)
+        {
+            functor(packet * Packet::size);
+        }
+    });
+}
+
+template <typename TType>
+inline constexpr
+EulerAngle<TType>::EulerAngle (const Vector3<TType>& angles, EEulerOrder order) noexcept
+    :   m_angles    {angles},
+        m_order     {order}
+{}
+
+template <typename TType>
+inline constexpr
+EulerAngle<TType>::EulerAngle (Angle<EAngleType::Radian, TType> first, Angle<EAngleType::Radian, TType> second, Angle<EAngleType::Radian, TType> third, EEulerOrder order) noexcept
+    :   m_angles    {static_cast<TType>(first), static_cast<TType>(second), static_cast<TType>(third)},
+        m_order     {order}
+{}
+
+template <typename TType>
+template <EPrecision TPrecision>
+inline
+Quaternion<TType> EulerAngle<TType>::toQuaternion() const noexcept
+{
+    const Axes axes = getAxes(m_order);
+    const TType s   = axes.parity;
+    const TType half = static_cast<TType>(0.5);
+
+    const Math::SinCos<Math::Real<TType>> sinCos0 = Math::sincos<TPrecision>(m_angles.getX() * half);
+    const Math::SinCos<Math::Real<TType>> sinCos1 = Math::sincos<TPrecision>(m_angles.getY() * half);
+    const Math::SinCos<Math::Real<TType>> sinCos2 = Math::sincos<TPrecision>(m_angles.getZ() * half);
+    const TType s0 = static_cast<TType>(sinCos0.sin);
+    const TType c0 = static_cast<TType>(sinCos0.cos);
+    const TType s1 = static_cast<TType>(sinCos1.sin);
+    const TType c1 = static_cast<TType>(sinCos1.cos);
+    const TType s2 = static_cast<TType>(sinCos2.sin);
+    const TType c2 = static_cast<TType>(sinCos2.cos);
+
+    /*q = q2 * q1 * q0 with qn = (sn * axis, cn) expanded with axis cross products : first x second = parity * third*/
+    TType xyzw[4];
+
+    if (axes.isProperEuler)
+    {
+        xyzw[axes.first]    = c1 * (c2 * s0 + s2 * c0);
+        xyzw[axes.second]   = s1 * (c2 * c0 + s2 * s0);
+        xyzw[axes.third]    = s * s1 * (s2 * c0 - c2 * s0);
+        xyzw[3]             = c1 * (c2 * c0 - s2 * s0);
+    }
+    else
+    {
+        xyzw[axes.first]    = c2 * c1 * s0 - s * s2 * s1 * c0;
+        xyzw[axes.second]   = c2 * s1 * c0 + s * s2 * c1 * s0;
+        xyzw[axes.third]    = s2 * c1 * c0 - s * c2 * s1 * s0;
+        xyzw[3]             = c2 * c1 * c0 + s * s2 * s1 * s0;
+    }
+
+    return Quaternion<TType>(xyzw[0], xyzw[1], xyzw[2], xyzw[3]);
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention, EPrecision TPrecision>
+inline constexpr
+Matrix3<TType, TMatrixConvention> EulerAngle<TType>::toMatrix3() const noexcept
+{
+    TType m[3][3] {};
+    getRotationCoefficients<TPrecision>(m);
+
+    return Matrix3<TType, TMatrixConvention>(m[0][0], m[0][1], m[0][2],
+                                             m[1][0], m[1][1], m[1][2],
+                                             m[2][0], m[2][1], m[2][2]);
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention, EPrecision TPrecision>
+inline constexpr
+Matrix4<TType, TMatrixConvention> EulerAngle<TType>::toMatrix4() const noexcept
+{
+    TType m[3][3] {};
+    getRotationCoefficients<TPrecision>(m);
+
+    const TType zero = static_cast<TType>(0);
+    const TType one  = static_cast<TType>(1);
+
+    return Matrix4<TType, TMatrixConvention>(m[0][0], m[0][1], m[0][2], zero,
+                                             m[1][0], m[1][1], m[1][2], zero,
+                                             m[2][0], m[2][1], m[2][2], zero,
+                                             zero,    zero,    zero,    one);
+}
+
+template <typename TType>
+template <EPrecision TPrecision>
+inline constexpr
+void EulerAngle<TType>::getRotationCoefficients (TType (&m)[3][3]) const noexcept
+{
+    const Axes axes = getAxes(m_order);
+    const size_t i  = axes.first;
+    const size_t j  = axes.second;
+    const size_t k  = axes.third;
+    const TType  s  = axes.parity;
+
+    const Math::SinCos<Math::Real<TType>> sinCos0 = Math::sincos<TPrecision>(m_angles.getX());
+    const Math::SinCos<Math::Real<TType>> sinCos1 = Math::sincos<TPrecision>(m_angles.getY());
+    const Math::SinCos<Math::Real<TType>> sinCos2 = Math::sincos<TPrecision>(m_angles.getZ());
+    const TType s0 = static_cast<TType>(sinCos0.sin);
+    const TType c0 = static_cast<TType>(sinCos0.cos);
+    const TType s1 = static_cast<TType>(sinCos1.sin);
+    const TType c1 = static_cast<TType>(sinCos1.cos);
+    const TType s2 = static_cast<TType>(sinCos2.sin);
+    const TType c2 = static_cast<TType>(sinCos2.cos);
+
+    /*Coefficients of XYZ (R = Rz * Ry * Rx) and XYX rewritten on the axes of the order. Odd permutation invert the direction of each rotation*/
+    if (axes.isProperEuler)
+    {
+        m[i][i] = c1;
+        m[i][j] = s1 * s0;
+        m[i][k] = s * s1 * c0;
+        m[j][i] = s2 * s1;
+        m[j][j] = c2 * c0 - s2 * c1 * s0;
+        m[j][k] = -s * (c2 * s0 + s2 * c1 * c0);
+        m[k][i] = -s * c2 * s1;
+        m[k][j] = s * (s2 * c0 + c2 * c1 * s0);
+        m[k][k] = c2 * c1 * c0 - s2 * s0;
+    }
+    else
+    {
+        m[i][i] = c1 * c2;
+        m[i][j] = s0 * s1 * c2 - s * c0 * s2;
+        m[i][k] = s * c0 * s1 * c2 + s0 * s2;
+        m[j][i] = s * c1 * s2;
+        m[j][j] = s * s0 * s1 * s2 + c0 * c2;
+        m[j][k] = c0 * s1 * s2 - s * s0 * c2;
+        m[k][i] = -s * s1;
+        m[k][j] = s * s0 * c1;
+        m[k][k] = c0 * c1;
+    }
+}
+
+template <typename TType>
+inline
+EulerAngle<TType> EulerAngle<TType>::getReordered(EEulerOrder order) const noexcept
+{
+    return createFromQuaternion(toQuaternion(), order);
+}
+
+template <typename TType>
+inline
+EulerAngle<TType> EulerAngle<TType>::createFromQuaternion(const Quaternion<TType>& quaternion, EEulerOrder order) noexcept
+{
+    TType m[3][3] {};
+    getRotationCoefficients(quaternion, m);
+    return createFromRotationCoefficients(m, order);
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline
+EulerAngle<TType> EulerAngle<TType>::createFromMatrix(const Matrix3<TType, TMatrixConvention>& rotation, EEulerOrder order) noexcept
+{
+    TType m[3][3] {};
+
+    for (size_t row = 0; row < 3; row++)
+    {
+        for (size_t column = 0; column < 3; column++)
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                m[row][column] = rotation.getData(row, column);
+            else
+                m[row][column] = rotation.getData(column, row);
+        }
+    }
+
+    return createFromRotationCoefficients(m, order);
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline
+EulerAngle<TType> EulerAngle<TType>::createFromMatrix(const Matrix4<TType, TMatrixConvention>& transform, EEulerOrder order) noexcept
+{
+    TType m[3][3] {};
+
+    for (size_t row = 0; row < 3; row++)
+    {
+        for (size_t column = 0; column < 3; column++)
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                m[row][column] = transform.getData(row, column);
+            else
+                m[row][column] = transform.getData(column, row);
+        }
+    }
+
+    return createFromRotationCoefficients(m, order);
+}
+
+template <typename TType>
+inline
+void EulerAngle<TType>::toQuaternions(const VectorBatch<3, TType>& angles, EEulerOrder order, QuaternionBatch<TType>& dst)
+{
+    const Axes axes = getAxes(order);
+    dst.resize(angles.size());
+
+    forEachPacket(angles.size(), [&](size_t index)
+    {
+        const PacketType eulerAngles[3] = {Packet::load(angles.getStream(0) + index), Packet::load(angles.getStream(1) + index), Packet::load(angles.getStream(2) + index)};
+
+        PacketType quaternion[4];
+        quaternionPacket(eulerAngles, axes, quaternion);
+
+        for (size_t component = 0; component < 4; component++)
+        {
+            Packet::store(dst.getStream(component) + index, quaternion[component]);
+        }
+    });
+}
+
+template <typename TType>
+inline
+void EulerAngle<TType>::fromQuaternions(const QuaternionBatch<TType>& quaternions, EEulerOrder order, VectorBatch<3, TType>& dst)
+{
+    const Axes axes = getAxes(order);
+    dst.resize(quaternions.size());
+
+    forEachPacket(quaternions.size(), [&](size_t index)
+    {
+        PacketType quaternion[4];
+
+        for (size_t component = 0; component < 4; component++)
+        {
+            quaternion[component] = Packet::load(quaternions.getStream(component) + index);
+        }
+
+        PacketType angles[3];
+        anglesPacket(quaternion, axes, angles);
+
+        for (size_t component = 0; component < 3; component++)
+        {
+            Packet::store(dst.getStream(component) + index, angles[component]);
+        }
+    });
+}
+
+template <typename TType>
+inline
+void EulerAngle<TType>::reorder(const VectorBatch<3, TType>& angles, EEulerOrder srcOrder, EEulerOrder dstOrder, VectorBatch<3, TType>& dst)
+{
+    const Axes srcAxes = getAxes(srcOrder);
+    const Axes dstAxes = getAxes(dstOrder);
+    dst.resize(angles.size());
+
+    forEachPacket(angles.size(), [&](size_t index)
+    {
+        const PacketType srcAngles[3] = {Packet::load(angles.getStream(0) + index), Packet::load(angles.getStream(1) + index), Packet::load(angles.getStream(2) + index)};
+
+        PacketType quaternion[4];
+        quaternionPacket(srcAngles, srcAxes, quaternion);
+
+        PacketType dstAngles[3];
+        anglesPacket(quaternion, dstAxes, dstAngles);
+
+        for (size_t component = 0; component < 3; component++)
+        {
+            Packet::store(dst.getStream(component) + index, dstAngles[component]);
+        }
+    });
+}
+
+template <typename TType>
+inline
+std::ostream& 	operator<<		(std::ostream& out, const EulerAngle<TType>& eulerAngle) noexcept
+{
+    const Vector3<TType>& angles = eulerAngle.getAngles();
+    out << eulerOrderToString(eulerAngle.getOrder()) << " " << angles.getX() << " " << angles.getY() << " " << angles.getZ();
+    return out;
+}
@@ -0,0 +1,139 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Vector/Vector3.hpp" //Vector3<TType>
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <iostream> //std::ostream
+#include <algorithm> //std::min, std::max
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    struct BoundingBox3;
+
+    /**
+     * @brief Axis aligned bounding box stored by its min and max corners. It's the value type of the broad phases : it's trivially copiable,
+     * overlap and containment are 6 comparisons without any square root.
+     * A legacy Shape3D OrientedBox is converted through its AABB (center and half extents) with createFromAABB(orientedBox.getAABB()).
+     * Boxes touching by a face overlap, like AabbAabb::isBothAABBCollided.
+     * @example `BoundingBox3<float> box = BoundingBox3<float>::createFromCenterExtents(center, 1.f, 2.f, 1.f);`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    struct BoundingBox3<TType>
+    {
+        #pragma region attribut
+
+        Vector3<TType> min {};
+        Vector3<TType> max {};
+
+        #pragma endregion //!attribut
+
+        #pragma region static methods
+
+        /**
+         * @brief Create the box of center and half extents along X (extI), Y (extJ) and Z (extK), like Shape3D AABB
+         */
+        [[nodiscard]] static inline
+        BoundingBox3 createFromCenterExtents (const Vector3<TType>& center, TType extI, TType extJ, TType extK) noexcept;
+
+        /**
+         * @brief Create the box from a Shape3D AABB like object (getCenter(), getExtI(), getExtJ() and getExtK()).
+         * @example `BoundingBox3<float>::createFromAABB(orientedBox.getAABB())`
+         */
+        template <typename TAABB>
+        [[nodiscard]] static inline
+        BoundingBox3 createFromAABB (const TAABB& aabb) noexcept;
+
+        /**
+         * @brief Smallest box containing both boxes
+         */
+        [[nodiscard]] static inline
+        BoundingBox3 merge (const BoundingBox3& lhs, const BoundingBox3& rhs) noexcept;
+
+        #pragma endregion //!static methods
+
+        #pragma region methods
+
+        /**
+         * @brief True if both boxes overlap or touch
+         */
+        [[nodiscard]] inline
+        bool overlaps (const BoundingBox3& other) const noexcept;
+
+        /**
+         * @brief True if other is inside the box (borders included)
+         */
+        [[nodiscard]] inline
+        bool contains (const BoundingBox3& other) const noexcept;
+
+        /**
+         * @brief Surface area of the box. Used as the insertion cost by the dynamic tree
+         */
+        [[nodiscard]] inline
+        TType getSurfaceArea () const noexcept;
+
+        /**
+         * @brief Copy of the box grown by margin on each side
+         */
+        [[nodiscard]] inline
+        BoundingBox3 getFattened (TType margin) const noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        Vector3<TType> getCenter () const noexcept;
+
+        /**
+         * @brief Half extents along X, Y and Z
+         */
+        [[nodiscard]] inline
+        Vector3<TType> getExtents () const noexcept;
+
+        #pragma endregion //!accessor
+    };
+
+    #pragma region stream operators
+
+    template <typename TType>
+    inline
+    std::ostream& 	operator<<		(std::ostream& out, const BoundingBox3<TType>& box) noexcept;
+
+    #pragma endregion //!stream operators
+
+    #include "BoundingBox3.inl"
+
+} /*namespace FoxMath*/
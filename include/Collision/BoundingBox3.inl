@@ -0,0 +1,116 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+inline
+BoundingBox3<TType> BoundingBox3<TType>::createFromCenterExtents (const Vector3<TType>& center, TType extI, TType extJ, TType extK) noexcept
+{
+    const Vector3<TType> extents {extI, extJ, extK};
+    return BoundingBox3{center - extents, center + extents};
+}
+
+template <typename TType>
+template <typename TAABB>
+inline
+BoundingBox3<TType> BoundingBox3<TType>::createFromAABB (const TAABB& aabb) noexcept
+{
+    const auto center = aabb.getCenter();
+    return createFromCenterExtents(Vector3<TType>{static_cast<TType>(center.x), static_cast<TType>(center.y), static_cast<TType>(center.z)},
+                                   static_cast<TType>(aabb.getExtI()), static_cast<TType>(aabb.getExtJ()), static_cast<TType>(aabb.getExtK()));
+}
+
+template <typename TType>
+inline
+BoundingBox3<TType> BoundingBox3<TType>::merge (const BoundingBox3& lhs, const BoundingBox3& rhs) noexcept
+{
+    return BoundingBox3{Vector3<TType>{std::min(lhs.min.getX(), rhs.min.getX()), std::min(lhs.min.getY(), rhs.min.getY()), std::min(lhs.min.getZ(), rhs.min.getZ())},
+                        Vector3<TType>{std::max(lhs.max.getX(), rhs.max.getX()), std::max(lhs.max.getY(), rhs.max.getY()), std::max(lhs.max.getZ(), rhs.max.getZ())}};
+}
+
+template <typename TType>
+inline
+bool BoundingBox3<TType>::overlaps (const BoundingBox3& other) const noexcept
+{
+    /*Non short-circuit and : the 6 comparisons compile without branch*/
+    return (min.getX() <= other.max.getX()) & (other.min.getX() <= max.getX()) &
+           (min.getY() <= other.max.getY()) & (other.min.getY() <= max.getY()) &
+           (min.getZ() <= other.max.getZ()) & (other.min.getZ() <= max.getZ());
+}
+
+template <typename TType>
+inline
+bool BoundingBox3<TType>::contains (const BoundingBox3& other) const noexcept
+{
+    return (min.getX() <= other.min.getX()) & (other.max.getX() <= max.getX()) &
+           (min.getY() <= other.min.getY()) & (other.max.getY() <= max.getY()) &
+           (min.getZ() <= other.min.getZ()) & (other.max.getZ() <= max.getZ());
+}
+
+template <typename TType>
+inline
+TType BoundingBox3<TType>::getSurfaceArea () const noexcept
+{
+    const TType sizeX = max.getX() - min.getX();
+    const TType sizeY = max.getY() - min.getY();
+    const TType sizeZ = max.getZ() - min.getZ();
+
+    return static_cast<TType>(2) * (sizeX * sizeY + sizeY * sizeZ + sizeZ * sizeX);
+}
+
+template <typename TType>
+inline
+BoundingBox3<TType> BoundingBox3<TType>::getFattened (TType margin) const noexcept
+{
+    const Vector3<TType> marginVector {margin, margin, margin};
+    return BoundingBox3{min - marginVector, max + marginVector};
+}
+
+template <typename TType>
+inline
+Vector3<TType> BoundingBox3<TType>::getCenter () const noexcept
+{
+    return (min + max) * static_cast<TType>(0.5);
+}
+
+template <typename TType>
+inline
+Vector3<TType> BoundingBox3<TType>::getExtents () const noexcept
+{
+    return (max - min) * static_cast<TType>(0.5);
+}
+
+template <typename TType>
+inline
+std::ostream& 	operator<<		(std::ostream& out, const BoundingBox3<TType>& box) noexcept
+{
+    out << "min : " << box.min << " max : " << box.max;
+    return out;
+}
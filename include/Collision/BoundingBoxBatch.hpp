@@ -0,0 +1,119 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 21 h 45
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Collision/BoundingBox3.hpp" //BoundingBox3
+#include "Vector/VectorBatch.hpp" //VectorBatch
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <cassert> //assert
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /*Define default template arg and apply template condition*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class BoundingBoxBatch;
+
+    /**
+     * @brief Structure of arrays container of axis aligned boxes : 6 streams for the min corner (0 to 2) and the max corner (3 to 5).
+     * Used by SegmentSlabTest to test one segment against Packet::size boxes at once.
+     * @example `FoxMath::BoundingBoxBatch<float> boxes (aabbs.data(), aabbs.size());`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class BoundingBoxBatch<TType> : public VectorBatch<6, TType>
+    {
+        private:
+
+        using Parent = VectorBatch<6, TType>;
+
+        public:
+
+        #pragma region static attribut
+
+        static constexpr size_t minStream = 0;
+        static constexpr size_t maxStream = 3;
+
+        #pragma endregion //! static attribut
+
+        #pragma region constructor/destructor
+
+        BoundingBoxBatch ()                                             = default;
+        BoundingBoxBatch (const BoundingBoxBatch& other)			    = default;
+        BoundingBoxBatch (BoundingBoxBatch&& other) noexcept	        = default;
+        ~BoundingBoxBatch ()				                            = default;
+        BoundingBoxBatch& operator=(BoundingBoxBatch const& other)      = default;
+        BoundingBoxBatch& operator=(BoundingBoxBatch && other)          = default;
+
+        /**
+         * @brief Gather count boxes
+         * 
+         * @param boxes 
+         * @param count 
+         */
+        explicit inline
+        BoundingBoxBatch (const BoundingBox3<TType>* boxes, size_t count);
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Gather count boxes from array of structure in the batch from index offset. The batch grows if needed.
+         * 
+         * @param boxes 
+         * @param count 
+         * @param offset 
+         */
+        inline
+        void gather (const BoundingBox3<TType>* boxes, size_t count, size_t offset = 0);
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        BoundingBox3<TType> getBox (size_t index) const noexcept;
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        inline
+        void setBox (size_t index, const BoundingBox3<TType>& box) noexcept;
+
+        #pragma endregion //!mutator
+    };
+
+    #include "BoundingBoxBatch.inl"
+
+} /*namespace FoxMath*/
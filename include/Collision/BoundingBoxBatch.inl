@@ -0,0 +1,80 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 21 h 45
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+inline
+BoundingBoxBatch<TType>::BoundingBoxBatch (const BoundingBox3<TType>* boxes, size_t count)
+{
+    gather(boxes, count);
+}
+
+template <typename TType>
+inline
+void BoundingBoxBatch<TType>::gather (const BoundingBox3<TType>* boxes, size_t count, size_t offset)
+{
+    if (offset + count > this->size())
+        this->resize(offset + count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        setBox(offset + i, boxes[i]);
+    }
+}
+
+template <typename TType>
+inline
+BoundingBox3<TType> BoundingBoxBatch<TType>::getBox (size_t index) const noexcept
+{
+    assert(index < this->size() && "Index out of range");
+
+    BoundingBox3<TType> box;
+
+    for (size_t component = 0; component < 3; component++)
+    {
+        box.min.getData()[component] = this->m_streams[minStream + component][index];
+        box.max.getData()[component] = this->m_streams[maxStream + component][index];
+    }
+
+    return box;
+}
+
+template <typename TType>
+inline
+void BoundingBoxBatch<TType>::setBox (size_t index, const BoundingBox3<TType>& box) noexcept
+{
+    assert(index < this->size() && "Index out of range");
+
+    for (size_t component = 0; component < 3; component++)
+    {
+        this->m_streams[minStream + component][index] = box.min.getData()[component];
+        this->m_streams[maxStream + component][index] = box.max.getData()[component];
+    }
+}
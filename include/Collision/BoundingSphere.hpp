@@ -0,0 +1,87 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Collision/BoundingBox3.hpp" //BoundingBox3
+#include "Vector/Vector3.hpp" //Vector3<TType>
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <iostream> //std::ostream
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    struct BoundingSphere;
+
+    /**
+     * @brief Sphere stored by its center and radius, value type of the narrow phase like BoundingBox3.
+     * @example `BoundingSphere<float> sphere {Vec3f{0.f, 1.f, 0.f}, 0.5f};`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    struct BoundingSphere<TType>
+    {
+        #pragma region attribut
+
+        Vector3<TType> center {};
+        TType          radius {};
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        /**
+         * @brief True if both spheres overlap or touch
+         */
+        [[nodiscard]] inline
+        bool overlaps (const BoundingSphere& other) const noexcept;
+
+        /**
+         * @brief Box containing the sphere, used to insert the sphere in a broad phase
+         */
+        [[nodiscard]] inline
+        BoundingBox3<TType> getBoundingBox () const noexcept;
+
+        #pragma endregion //!methods
+    };
+
+    #pragma region stream operators
+
+    template <typename TType>
+    inline
+    std::ostream& 	operator<<		(std::ostream& out, const BoundingSphere<TType>& sphere) noexcept;
+
+    #pragma endregion //!stream operators
+
+    #include "BoundingSphere.inl"
+
+} /*namespace FoxMath*/
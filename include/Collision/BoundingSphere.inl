@@ -0,0 +1,55 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+inline
+bool BoundingSphere<TType>::overlaps (const BoundingSphere& other) const noexcept
+{
+    const Vector3<TType> delta = other.center - center;
+    const TType radiusSum = radius + other.radius;
+
+    return delta.squareLength() <= radiusSum * radiusSum;
+}
+
+template <typename TType>
+inline
+BoundingBox3<TType> BoundingSphere<TType>::getBoundingBox () const noexcept
+{
+    return BoundingBox3<TType>::createFromCenterExtents(center, radius, radius, radius);
+}
+
+template <typename TType>
+inline
+std::ostream& 	operator<<		(std::ostream& out, const BoundingSphere<TType>& sphere) noexcept
+{
+    out << "center : " << sphere.center << " radius : " << sphere.radius;
+    return out;
+}
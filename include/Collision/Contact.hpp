@@ -0,0 +1,58 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Vector/Vector3.hpp" //Vector3<TType>
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    struct Contact;
+
+    /**
+     * @brief Contact between two shapes written by the narrow phase. normal is unit and points from the first shape to the second one :
+     * moving the second shape by normal * penetration separate both shapes.
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    struct Contact<TType>
+    {
+        Vector3<TType>  point       {};
+        Vector3<TType>  normal      {};
+        TType           penetration {};
+        size_t          pairIndex   {}; /*Index of the candidate pair in the narrow phase input*/
+    };
+
+} /*namespace FoxMath*/
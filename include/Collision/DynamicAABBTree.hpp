@@ -0,0 +1,312 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Collision/BoundingBox3.hpp" //BoundingBox3
+#include "Vector/Vector3.hpp" //Vector3<TType>
+#include "Thread/ThreadPool.hpp" //ThreadPool, getGlobalThreadPool
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <vector> //std::vector
+#include <array> //std::array
+#include <limits> //std::numeric_limits
+#include <algorithm> //std::max, std::nth_element
+#include <assert.h> //assert
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, typename TUserData = size_t, IsArithmetic<TType> = true>
+    class DynamicAABBTree;
+
+    /**
+     * @brief Broad phase bounding volume hierarchy of BoundingBox3. Each proxy is a leaf storing a fat box (the box grown by a margin and by the predicted displacement)
+     * and a user data (index or pointer of the shape). Updating a proxy that stay inside its fat box cost one containment test, other updates
+     * remove and reinsert the leaf. Insertion choose the sibling with the surface area heuristic, then each ancestor do at most one rotation when its children heights differ by more than 1 (Box2D heuristic).
+     * It keeps the height close to log2(proxy count) in practice but it's not a strict AVL balance : children heights can differ by 2 or 3.
+     * computePairs only return the pairs of overlapping fat boxes where at least one proxy was inserted or moved since the last call, each pair once.
+     * Pairs of proxies that did not move are not reported again : callers keep the persistent pairs themselves before the narrow phase.
+     * Nodes are stored by index in one vector with a free list : proxy ids are stable until remove and insert/remove do not allocate once the pool is big enough.
+     * @example
+     * `DynamicAABBTree<float> tree;`
+     * `size_t proxy = tree.insert(BoundingBox3<float>::createFromAABB(orientedBox.getAABB()), shapeIndex);`
+     * `tree.update(proxy, newBox, displacement);`
+     * `tree.forEachPair([&](size_t shape1, size_t shape2){ ... });`
+     * 
+     * @tparam TType 
+     * @tparam TUserData : copiable and default constructible data associated to each proxy
+     */
+    template <typename TType, typename TUserData>
+    class DynamicAABBTree<TType, TUserData>
+    {
+        public:
+
+        /**
+         * @brief Pair of proxy ids with first < second
+         */
+        struct Pair
+        {
+            size_t first;
+            size_t second;
+        };
+
+        static constexpr size_t nullProxy = std::numeric_limits<size_t>::max();
+
+        /**
+         * @brief Size of the query stack kept on the call stack. The rotations are a heuristic and do not bound the height strictly :
+         * a taller tree makes query continue on a heap allocated stack (like b2GrowableStack of Box2D)
+         */
+        static constexpr size_t inlineStackSize = 256;
+
+        private:
+
+        /**
+         * @brief Number of moved proxies queried by task in computePairs
+         */
+        static constexpr size_t pairChunkSize = 256;
+        static constexpr size_t pairParallelGrain = 4;
+
+        protected:
+
+        struct Node
+        {
+            BoundingBox3<TType> box {};
+            TUserData           userData {};
+            size_t              parent  {nullProxy}; /*Next free node when the node is in the free list*/
+            size_t              child1  {nullProxy};
+            size_t              child2  {nullProxy};
+            int                 height  {-1}; /*0 for leaves, -1 for free nodes*/
+            bool                moved   {false};
+
+            [[nodiscard]] inline
+            bool isLeaf () const noexcept { return child1 == nullProxy; }
+        };
+
+        #pragma region attribut
+
+        std::vector<Node>                   m_nodes         {};
+        std::vector<size_t>                 m_movedProxies  {};
+        std::vector<std::vector<Pair>>      m_chunkPairs    {};
+        size_t                              m_root          {nullProxy};
+        size_t                              m_freeList      {nullProxy};
+        size_t                              m_proxyCount    {0};
+        TType                               m_margin;
+        TType                               m_displacementMultiplier;
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        [[nodiscard]] inline
+        size_t allocateNode ();
+
+        inline
+        void freeNode (size_t node) noexcept;
+
+        inline
+        void insertLeaf (size_t leaf) noexcept;
+
+        inline
+        void removeLeaf (size_t leaf) noexcept;
+
+        /**
+         * @brief Recompute box and height of node from its children
+         */
+        inline
+        void refit (size_t node) noexcept;
+
+        /**
+         * @brief Refit and balance the ancestors of node up to the root
+         */
+        inline
+        void refitAncestors (size_t node) noexcept;
+
+        /**
+         * @brief Rotate the subtree of node if its children heights differ by more than 1. Return the new root of the subtree
+         */
+        [[nodiscard]] inline
+        size_t balance (size_t node) noexcept;
+
+        /**
+         * @brief Top down build of the subtree of leaves [begin, end), split at the median of the centers along the largest axis. Return the root of the subtree
+         */
+        [[nodiscard]] inline
+        size_t build (size_t* begin, size_t* end);
+
+        inline
+        void markMoved (size_t leaf);
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Construct a new empty tree
+         * 
+         * @param margin : fat boxes are grown by margin on each side
+         * @param displacementMultiplier : fat boxes are grown by displacement * displacementMultiplier in the direction of the displacement
+         */
+        explicit DynamicAABBTree (TType margin = static_cast<TType>(0.1), TType displacementMultiplier = static_cast<TType>(4)) noexcept;
+
+        DynamicAABBTree (const DynamicAABBTree& other)			    = default;
+        DynamicAABBTree (DynamicAABBTree&& other)				    = default;
+        ~DynamicAABBTree ()				                            = default;
+        DynamicAABBTree& operator=(DynamicAABBTree const& other)    = default;
+        DynamicAABBTree& operator=(DynamicAABBTree && other)	    = default;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Insert a proxy and return its id. The proxy is reported by the next computePairs
+         * 
+         * @param box : tight box of the shape
+         * @param userData 
+         * @return size_t : proxy id
+         */
+        inline
+        size_t insert (const BoundingBox3<TType>& box, const TUserData& userData);
+
+        /**
+         * @brief Remove the proxy. Its id can be reused by the next insert
+         */
+        inline
+        void remove (size_t proxy) noexcept;
+
+        /**
+         * @brief Update the box of the proxy. Nothing is done if the fat box still contains the box and is not too large.
+         * Else the fat box is recomputed, the leaf is reinserted and the proxy is reported by the next computePairs
+         * 
+         * @param proxy 
+         * @param box : new tight box of the shape
+         * @param displacement : predicted displacement of the shape until the next update
+         * @return true if the leaf was reinserted
+         */
+        inline
+        bool update (size_t proxy, const BoundingBox3<TType>& box, const Vector3<TType>& displacement = Vector3<TType>{});
+
+        /**
+         * @brief Call functor(proxy) for each proxy whose fat box overlap box. The query stop if functor return false.
+         * Query is read only and can be called from several threads.
+         * 
+         * @tparam TFunctor : bool(size_t proxy)
+         * @param box 
+         * @param functor 
+         */
+        template <typename TFunctor>
+        inline
+        void query (const BoundingBox3<TType>& box, TFunctor&& functor) const;
+
+        /**
+         * @brief Fill pairs with the pairs of overlapping fat boxes where at least one proxy was inserted or moved since the last call. Each pair is reported once.
+         * Moved proxies are queried in parallel by the workers of pool, pairs are sorted by moved proxy in insertion order of the moves.
+         * 
+         * @param pairs : cleared before use. Keep it between frames to avoid allocations
+         * @param pool 
+         */
+        inline
+        void computePairs (std::vector<Pair>& pairs, ThreadPool& pool = getGlobalThreadPool());
+
+        /**
+         * @brief Call functor(userData1, userData2) for each pair of computePairs : only pairs with a proxy inserted or moved since the last call.
+         * It's not the full candidate set : callers must keep the pairs of previous calls that still overlap to test them with the narrow phase
+         * 
+         * @tparam TFunctor : void(const TUserData&, const TUserData&)
+         * @param functor 
+         * @param pool 
+         */
+        template <typename TFunctor>
+        inline
+        void forEachPair (TFunctor&& functor, ThreadPool& pool = getGlobalThreadPool());
+
+        /**
+         * @brief Rebuild the whole tree top down. Usefull after teleporting many proxies or after the first insertion of a scene.
+         * Proxy ids and fat boxes are kept.
+         */
+        inline
+        void rebuild ();
+
+        /**
+         * @brief Remove all proxies. The memory is kept
+         */
+        inline
+        void clear () noexcept;
+
+        /**
+         * @brief Reserve nodes for proxyCount proxies
+         */
+        inline
+        void reserve (size_t proxyCount);
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        const BoundingBox3<TType>& getFatBox (size_t proxy) const noexcept;
+
+        [[nodiscard]] inline
+        const TUserData& getUserData (size_t proxy) const noexcept;
+
+        [[nodiscard]] inline
+        size_t getProxyCount () const noexcept;
+
+        /**
+         * @brief Height of the root. 0 for one proxy, -1 if the tree is empty
+         */
+        [[nodiscard]] inline
+        int getHeight () const noexcept;
+
+        [[nodiscard]] inline
+        TType getMargin () const noexcept;
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        /**
+         * @brief Set the margin used by the next insert and update
+         */
+        inline
+        void setMargin (TType margin) noexcept;
+
+        inline
+        void setUserData (size_t proxy, const TUserData& userData) noexcept;
+
+        #pragma endregion //!mutator
+    };
+
+    #include "DynamicAABBTree.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,639 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType, typename TUserData>
+inline
+size_t DynamicAABBTree<TType, TUserData>::allocateNode ()
+{
+    if (m_freeList == nullProxy)
+    {
+        m_nodes.emplace_back();
+        m_nodes.back().height = 0;
+        return m_nodes.size() - 1;
+    }
+
+    const size_t node = m_freeList;
+    m_freeList = m_nodes[node].parent;
+    m_nodes[node] = Node{};
+    m_nodes[node].height = 0;
+    return node;
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::freeNode (size_t node) noexcept
+{
+    m_nodes[node].parent = m_freeList;
+    m_nodes[node].child1 = nullProxy;
+    m_nodes[node].child2 = nullProxy;
+    m_nodes[node].height = -1;
+    m_nodes[node].moved  = false;
+    m_freeList = node;
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::refit (size_t node) noexcept
+{
+    Node& current = m_nodes[node];
+    const Node& child1 = m_nodes[current.child1];
+    const Node& child2 = m_nodes[current.child2];
+
+    current.box    = BoundingBox3<TType>::merge(child1.box, child2.box);
+    current.height = 1 + std::max(child1.height, child2.height);
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::refitAncestors (size_t node) noexcept
+{
+    while (node != nullProxy)
+    {
+        node = balance(node);
+        refit(node);
+        node = m_nodes[node].parent;
+    }
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::insertLeaf (size_t leaf) noexcept
+{
+    if (m_root == nullProxy)
+    {
+        m_root = leaf;
+        m_nodes[leaf].parent = nullProxy;
+        return;
+    }
+
+    /*Find the best sibling with the surface area heuristic : the cost of a sibling is the area of the new parent plus the area added to its ancestors*/
+    const BoundingBox3<TType> leafBox = m_nodes[leaf].box;
+    size_t index = m_root;
+
+    while (!m_nodes[index].isLeaf())
+    {
+        const Node& node = m_nodes[index];
+        const TType area = node.box.getSurfaceArea();
+        const TType combinedArea = BoundingBox3<TType>::merge(node.box, leafBox).getSurfaceArea();
+
+        /*Cost to create a new parent for this node and the leaf*/
+        const TType cost = static_cast<TType>(2) * combinedArea;
+
+        /*Minimum cost to push the leaf further down the tree*/
+        const TType inheritanceCost = static_cast<TType>(2) * (combinedArea - area);
+
+        const auto getDescentCost = [&](size_t child) noexcept
+        {
+            const Node& childNode = m_nodes[child];
+            const TType childCombinedArea = BoundingBox3<TType>::merge(childNode.box, leafBox).getSurfaceArea();
+            return childNode.isLeaf() ? childCombinedArea + inheritanceCost : childCombinedArea - childNode.box.getSurfaceArea() + inheritanceCost;
+        };
+
+        const TType cost1 = getDescentCost(node.child1);
+        const TType cost2 = getDescentCost(node.child2);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        index = (cost1 < cost2) ? node.child1 : node.child2;
+    }
+
+    /*insert reserve this node and update reuse the parent freed by removeLeaf : allocateNode take it from the free list and cannot throw here*/
+    const size_t sibling   = index;
+    const size_t oldParent = m_nodes[sibling].parent;
+    const size_t newParent = allocateNode();
+
+    Node& parentNode  = m_nodes[newParent];
+    parentNode.parent = oldParent;
+    parentNode.box    = BoundingBox3<TType>::merge(leafBox, m_nodes[sibling].box);
+    parentNode.height = m_nodes[sibling].height + 1;
+    parentNode.child1 = sibling;
+    parentNode.child2 = leaf;
+
+    if (oldParent != nullProxy)
+    {
+        if (m_nodes[oldParent].child1 == sibling)
+            m_nodes[oldParent].child1 = newParent;
+        else
+            m_nodes[oldParent].child2 = newParent;
+    }
+    else
+    {
+        m_root = newParent;
+    }
+
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent    = newParent;
+
+    refitAncestors(m_nodes[leaf].parent);
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::removeLeaf (size_t leaf) noexcept
+{
+    if (leaf == m_root)
+    {
+        m_root = nullProxy;
+        return;
+    }
+
+    const size_t parent      = m_nodes[leaf].parent;
+    const size_t grandParent = m_nodes[parent].parent;
+    const size_t sibling     = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    freeNode(parent);
+
+    if (grandParent != nullProxy)
+    {
+        if (m_nodes[grandParent].child1 == parent)
+            m_nodes[grandParent].child1 = sibling;
+        else
+            m_nodes[grandParent].child2 = sibling;
+
+        m_nodes[sibling].parent = grandParent;
+        refitAncestors(grandParent);
+    }
+    else
+    {
+        m_root = sibling;
+        m_nodes[sibling].parent = nullProxy;
+    }
+}
+
+template <typename TType, typename TUserData>
+inline
+size_t DynamicAABBTree<TType, TUserData>::balance (size_t iA) noexcept
+{
+    Node& A = m_nodes[iA];
+
+    if (A.isLeaf() || A.height < 2)
+        return iA;
+
+    const size_t iB = A.child1;
+    const size_t iC = A.child2;
+    Node& B = m_nodes[iB];
+    Node& C = m_nodes[iC];
+
+    const int balanceFactor = C.height - B.height;
+
+    /*Rotate C up*/
+    if (balanceFactor > 1)
+    {
+        const size_t iF = C.child1;
+        const size_t iG = C.child2;
+        Node& F = m_nodes[iF];
+        Node& G = m_nodes[iG];
+
+        C.child1 = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+
+        if (C.parent != nullProxy)
+        {
+            if (m_nodes[C.parent].child1 == iA)
+                m_nodes[C.parent].child1 = iC;
+            else
+                m_nodes[C.parent].child2 = iC;
+        }
+        else
+        {
+            m_root = iC;
+        }
+
+        /*The highest child of C stay under C, the other one replace C under A*/
+        if (F.height > G.height)
+        {
+            C.child2 = iF;
+            A.child2 = iG;
+            G.parent = iA;
+            A.box    = BoundingBox3<TType>::merge(B.box, G.box);
+            C.box    = BoundingBox3<TType>::merge(A.box, F.box);
+            A.height = 1 + std::max(B.height, G.height);
+            C.height = 1 + std::max(A.height, F.height);
+        }
+        else
+        {
+            C.child2 = iG;
+            A.child2 = iF;
+            F.parent = iA;
+            A.box    = BoundingBox3<TType>::merge(B.box, F.box);
+            C.box    = BoundingBox3<TType>::merge(A.box, G.box);
+            A.height = 1 + std::max(B.height, F.height);
+            C.height = 1 + std::max(A.height, G.height);
+        }
+
+        return iC;
+    }
+
+    /*Rotate B up*/
+    if (balanceFactor < -1)
+    {
+        const size_t iD = B.child1;
+        const size_t iE = B.child2;
+        Node& D = m_nodes[iD];
+        Node& E = m_nodes[iE];
+
+        B.child1 = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+
+        if (B.parent != nullProxy)
+        {
+            if (m_nodes[B.parent].child1 == iA)
+                m_nodes[B.parent].child1 = iB;
+            else
+                m_nodes[B.parent].child2 = iB;
+        }
+        else
+        {
+            m_root = iB;
+        }
+
+        if (D.height > E.height)
+        {
+            B.child2 = iD;
+            A.child1 = iE;
+            E.parent = iA;
+            A.box    = BoundingBox3<TType>::merge(C.box, E.box);
+            B.box    = BoundingBox3<TType>::merge(A.box, D.box);
+            A.height = 1 + std::max(C.height, E.height);
+            B.height = 1 + std::max(A.height, D.height);
+        }
+        else
+        {
+            B.child2 = iE;
+            A.child1 = iD;
+            D.parent = iA;
+            A.box    = BoundingBox3<TType>::merge(C.box, D.box);
+            B.box    = BoundingBox3<TType>::merge(A.box, E.box);
+            A.height = 1 + std::max(C.height, D.height);
+            B.height = 1 + std::max(A.height, E.height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+template <typename TType, typename TUserData>
+inline
+size_t DynamicAABBTree<TType, TUserData>::build (size_t* begin, size_t* end)
+{
+    const size_t count = static_cast<size_t>(end - begin);
+
+    if (count == 1)
+        return *begin;
+
+    /*Split along the largest axis of the centers bounds*/
+    BoundingBox3<TType> centerBounds {m_nodes[*begin].box.getCenter(), m_nodes[*begin].box.getCenter()};
+    for (size_t* it = begin + 1; it != end; ++it)
+    {
+        const Vector3<TType> center = m_nodes[*it].box.getCenter();
+        centerBounds = BoundingBox3<TType>::merge(centerBounds, BoundingBox3<TType>{center, center});
+    }
+
+    const Vector3<TType> size = centerBounds.max - centerBounds.min;
+    const size_t axis = (size.getX() >= size.getY() && size.getX() >= size.getZ()) ? 0 : (size.getY() >= size.getZ()) ? 1 : 2;
+
+    size_t* middle = begin + count / 2;
+    std::nth_element(begin, middle, end, [&](size_t lhs, size_t rhs) noexcept
+    {
+        /*Sum of min and max is twice the center and cost no multiplication*/
+        return m_nodes[lhs].box.min.getData()[axis] + m_nodes[lhs].box.max.getData()[axis] <
+               m_nodes[rhs].box.min.getData()[axis] + m_nodes[rhs].box.max.getData()[axis];
+    });
+
+    const size_t child1 = build(begin, middle);
+    const size_t child2 = build(middle, end);
+    const size_t node   = allocateNode();
+
+    m_nodes[node].child1  = child1;
+    m_nodes[node].child2  = child2;
+    m_nodes[child1].parent = node;
+    m_nodes[child2].parent = node;
+    refit(node);
+
+    return node;
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::markMoved (size_t leaf)
+{
+    if (!m_nodes[leaf].moved)
+    {
+        m_nodes[leaf].moved = true;
+        m_movedProxies.push_back(leaf);
+    }
+}
+
+template <typename TType, typename TUserData>
+DynamicAABBTree<TType, TUserData>::DynamicAABBTree (TType margin, TType displacementMultiplier) noexcept
+    :   m_margin                    {margin},
+        m_displacementMultiplier    {displacementMultiplier}
+{}
+
+template <typename TType, typename TUserData>
+inline
+size_t DynamicAABBTree<TType, TUserData>::insert (const BoundingBox3<TType>& box, const TUserData& userData)
+{
+    const size_t proxy = allocateNode();
+
+    m_nodes[proxy].box      = box.getFattened(m_margin);
+    m_nodes[proxy].userData = userData;
+
+    /*Reserve the parent node now : removeLeaf and insertLeaf never allocate*/
+    freeNode(allocateNode());
+
+    insertLeaf(proxy);
+    markMoved(proxy);
+    ++m_proxyCount;
+
+    return proxy;
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::remove (size_t proxy) noexcept
+{
+    assert(proxy < m_nodes.size() && m_nodes[proxy].height == 0 && "Proxy is not a leaf of the tree");
+
+    if (m_nodes[proxy].moved)
+    {
+        /*Same linear search than the move buffer of Box2D : removing a proxy that just moved is rare*/
+        const auto it = std::find(m_movedProxies.begin(), m_movedProxies.end(), proxy);
+        *it = m_movedProxies.back();
+        m_movedProxies.pop_back();
+    }
+
+    removeLeaf(proxy);
+    freeNode(proxy);
+    --m_proxyCount;
+}
+
+template <typename TType, typename TUserData>
+inline
+bool DynamicAABBTree<TType, TUserData>::update (size_t proxy, const BoundingBox3<TType>& box, const Vector3<TType>& displacement)
+{
+    assert(proxy < m_nodes.size() && m_nodes[proxy].height == 0 && "Proxy is not a leaf of the tree");
+
+    BoundingBox3<TType> fatBox = box.getFattened(m_margin);
+
+    /*Extend the fat box in the direction of the predicted displacement*/
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const TType predicted = displacement.getData()[i] * m_displacementMultiplier;
+
+        if (predicted < static_cast<TType>(0))
+            fatBox.min.getData()[i] += predicted;
+        else
+            fatBox.max.getData()[i] += predicted;
+    }
+
+    /*Keep the current fat box if it contains the box and is not much larger than the new fat box (proxy slowing down after a fast move)*/
+    const BoundingBox3<TType>& treeBox = m_nodes[proxy].box;
+    if (treeBox.contains(box) && fatBox.getFattened(static_cast<TType>(4) * m_margin).contains(treeBox))
+        return false;
+
+    removeLeaf(proxy);
+    m_nodes[proxy].box = fatBox;
+    insertLeaf(proxy);
+    markMoved(proxy);
+
+    return true;
+}
+
+template <typename TType, typename TUserData>
+template <typename TFunctor>
+inline
+void DynamicAABBTree<TType, TUserData>::query (const BoundingBox3<TType>& box, TFunctor&& functor) const
+{
+    if (m_root == nullProxy)
+        return;
+
+    std::array<size_t, inlineStackSize> inlineStack;
+    std::vector<size_t> heapStack;
+    size_t* stack = inlineStack.data();
+    size_t stackCapacity = inlineStackSize;
+    size_t stackSize = 0;
+    stack[stackSize++] = m_root;
+
+    while (stackSize != 0)
+    {
+        const Node& node = m_nodes[stack[--stackSize]];
+
+        if (!node.box.overlaps(box))
+            continue;
+
+        if (node.isLeaf())
+        {
+            if (!functor(static_cast<size_t>(&node - m_nodes.data())))
+                return;
+        }
+        else
+        {
+            if (stackSize + 2 > stackCapacity) [[unlikely]]
+            {
+                /*Tree is too high for the inline stack : continue on the heap*/
+                stackCapacity *= 2;
+                heapStack.resize(stackCapacity);
+
+                if (stack == inlineStack.data())
+                    std::copy(inlineStack.begin(), inlineStack.begin() + stackSize, heapStack.begin());
+
+                stack = heapStack.data();
+            }
+
+            stack[stackSize++] = node.child1;
+            stack[stackSize++] = node.child2;
+        }
+    }
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::computePairs (std::vector<Pair>& pairs, ThreadPool& pool)
+{
+    pairs.clear();
+
+    const size_t movedCount = m_movedProxies.size();
+    const size_t chunkCount = (movedCount + pairChunkSize - 1) / pairChunkSize;
+
+    if (m_chunkPairs.size() < chunkCount)
+        m_chunkPairs.resize(chunkCount);
+
+    /*Each task write in its own chunk : tree is read only during the queries*/
+    pool.parallelFor(chunkCount, pairParallelGrain, [&](size_t chunkBegin, size_t chunkEnd)
+    {
+        for (size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk)
+        {
+            std::vector<Pair>& chunkPairs = m_chunkPairs[chunk];
+            chunkPairs.clear();
+
+            const size_t end = std::min(movedCount, (chunk + 1) * pairChunkSize);
+            for (size_t i = chunk * pairChunkSize; i < end; ++i)
+            {
+                const size_t proxy = m_movedProxies[i];
+
+                query(m_nodes[proxy].box, [&](size_t other) noexcept
+                {
+                    /*A pair of moved proxies is reported by the smallest id only*/
+                    if (other == proxy || (other < proxy && m_nodes[other].moved))
+                        return true;
+
+                    chunkPairs.push_back(Pair{std::min(proxy, other), std::max(proxy, other)});
+                    return true;
+                });
+            }
+        }
+    });
+
+    size_t pairCount = 0;
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        pairCount += m_chunkPairs[chunk].size();
+
+    pairs.reserve(pairCount);
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        pairs.insert(pairs.end(), m_chunkPairs[chunk].begin(), m_chunkPairs[chunk].end());
+
+    for (size_t proxy : m_movedProxies)
+        m_nodes[proxy].moved = false;
+
+    m_movedProxies.clear();
+}
+
+template <typename TType, typename TUserData>
+template <typename TFunctor>
+inline
+void DynamicAABBTree<TType, TUserData>::forEachPair (TFunctor&& functor, ThreadPool& pool)
+{
+    std::vector<Pair> pairs;
+    computePairs(pairs, pool);
+
+    for (const Pair& pair : pairs)
+        functor(m_nodes[pair.first].userData, m_nodes[pair.second].userData);
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::rebuild ()
+{
+    if (m_proxyCount < 2)
+        return;
+
+    std::vector<size_t> leaves;
+    leaves.reserve(m_proxyCount);
+
+    for (size_t node = 0; node < m_nodes.size(); ++node)
+    {
+        if (m_nodes[node].height == 0)
+            leaves.push_back(node);
+        else if (m_nodes[node].height > 0)
+            freeNode(node);
+    }
+
+    m_root = build(leaves.data(), leaves.data() + leaves.size());
+    m_nodes[m_root].parent = nullProxy;
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::clear () noexcept
+{
+    m_nodes.clear();
+    m_movedProxies.clear();
+    m_root       = nullProxy;
+    m_freeList   = nullProxy;
+    m_proxyCount = 0;
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::reserve (size_t proxyCount)
+{
+    /*A tree of n leaves has n - 1 internal nodes*/
+    m_nodes.reserve(2 * proxyCount);
+    m_movedProxies.reserve(proxyCount);
+}
+
+template <typename TType, typename TUserData>
+inline
+const BoundingBox3<TType>& DynamicAABBTree<TType, TUserData>::getFatBox (size_t proxy) const noexcept
+{
+    assert(proxy < m_nodes.size() && m_nodes[proxy].height == 0 && "Proxy is not a leaf of the tree");
+    return m_nodes[proxy].box;
+}
+
+template <typename TType, typename TUserData>
+inline
+const TUserData& DynamicAABBTree<TType, TUserData>::getUserData (size_t proxy) const noexcept
+{
+    assert(proxy < m_nodes.size() && m_nodes[proxy].height == 0 && "Proxy is not a leaf of the tree");
+    return m_nodes[proxy].userData;
+}
+
+template <typename TType, typename TUserData>
+inline
+size_t DynamicAABBTree<TType, TUserData>::getProxyCount () const noexcept
+{
+    return m_proxyCount;
+}
+
+template <typename TType, typename TUserData>
+inline
+int DynamicAABBTree<TType, TUserData>::getHeight () const noexcept
+{
+    return (m_root == nullProxy) ? -1 : m_nodes[m_root].height;
+}
+
+template <typename TType, typename TUserData>
+inline
+TType DynamicAABBTree<TType, TUserData>::getMargin () const noexcept
+{
+    return m_margin;
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::setMargin (TType margin) noexcept
+{
+    m_margin = margin;
+}
+
+template <typename TType, typename TUserData>
+inline
+void DynamicAABBTree<TType, TUserData>::setUserData (size_t proxy, const TUserData& userData) noexcept
+{
+    assert(proxy < m_nodes.size() && m_nodes[proxy].height == 0 && "Proxy is not a leaf of the tree");
+    m_nodes[proxy].userData = userData;
+}
@@ -0,0 +1,203 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Collision/Contact.hpp" //Contact
+#include "Thread/ThreadPool.hpp" //ThreadPool, getGlobalThreadPool
+
+#include <vector> //std::vector
+#include <array> //std::array
+#include <tuple> //std::tuple, std::get, std::tuple_element_t
+#include <utility> //std::index_sequence, std::declval
+#include <type_traits> //std::true_type, std::void_t, std::is_same_v
+#include <algorithm> //std::upper_bound, std::min
+#include <assert.h> //assert
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /**
+     * @brief Reference to a shape of the narrow phase : index of its shape type in the dispatcher and index of the shape in the array of this type.
+     * Usually stored as user data of the broad phase proxies.
+     */
+    struct ShapeHandle
+    {
+        size_t type;
+        size_t index;
+    };
+
+    /**
+     * @brief Narrow phase of heterogeneous shapes without virtual call. Shapes are stored by type in arrays (one std::vector by type of TShapes).
+     * dispatch bucket the candidate pairs by pair of shape types with a counting sort, then each bucket run in a tight loop the collide overload of TTests
+     * for its two types, chosen at compile time in a table of bucketCount functions. Buckets are split across threads.
+     * Contacts are written in a buffer kept by the dispatcher and compacted in the output : a frame does not allocate once buffers reached their size.
+     * A pair of types without collide overload (in any order) never collide.
+     * @example
+     * `using Dispatcher = NarrowPhaseDispatcher<float, NarrowPhaseTests<float>, BoundingSphere<float>, BoundingBox3<float>>;`
+     * `tree.insert(sphere.getBoundingBox(), Dispatcher::createHandle<BoundingSphere<float>>(sphereIndex));`
+     * `dispatcher.dispatch(candidatePairs, contacts, spheres, boxes);`
+     * 
+     * @tparam TType 
+     * @tparam TTests : class with static bool collide(const TShape1&, const TShape2&, Contact<TType>&) overloads like NarrowPhaseTests
+     * @tparam TShapes : shape types. The index of a type in TShapes is its ShapeHandle type
+     */
+    template <typename TType, typename TTests, typename... TShapes>
+    class NarrowPhaseDispatcher
+    {
+        public:
+
+        /**
+         * @brief Pair given by the broad phase
+         */
+        struct CandidatePair
+        {
+            ShapeHandle first;
+            ShapeHandle second;
+        };
+
+        static constexpr size_t shapeTypeCount  = sizeof...(TShapes);
+        static constexpr size_t bucketCount     = shapeTypeCount * shapeTypeCount;
+
+        private:
+
+        using ShapeArrays = std::tuple<const TShapes*...>;
+
+        /**
+         * @brief Minimum number of pairs by thread
+         */
+        static constexpr size_t parallelGrain = 1 << 11;
+
+        protected:
+
+        /**
+         * @brief Candidate pair ordered by shape type (first.type <= second.type)
+         */
+        struct SortedPair
+        {
+            ShapeHandle first;
+            ShapeHandle second;
+            size_t      pairIndex;
+            bool        isSwapped;
+        };
+
+        using BucketKernel = void (*)(const SortedPair* pairs, size_t begin, size_t end, const ShapeArrays& shapes, Contact<TType>* contacts, unsigned char* hits) noexcept;
+
+        template <typename TFirst, typename TSecond, typename = void>
+        struct HasCollide : std::false_type {};
+
+        template <typename TFirst, typename TSecond>
+        struct HasCollide<TFirst, TSecond, std::void_t<decltype(TTests::collide(std::declval<const TFirst&>(), std::declval<const TSecond&>(), std::declval<Contact<TType>&>()))>> 
+            : std::true_type {};
+
+        #pragma region attribut
+
+        std::vector<SortedPair>                 m_sortedPairs   {};
+        std::vector<Contact<TType>>             m_contacts      {};
+        std::vector<unsigned char>              m_hits          {};
+        std::array<size_t, bucketCount + 1>     m_bucketOffsets {};
+
+        #pragma endregion //!attribut
+
+        #pragma region static methods
+
+        /**
+         * @brief Collide the pairs [begin, end) of the bucket of shape types TFirst and TSecond
+         */
+        template <size_t TFirst, size_t TSecond>
+        static inline
+        void runBucket (const SortedPair* pairs, size_t begin, size_t end, const ShapeArrays& shapes, Contact<TType>* contacts, unsigned char* hits) noexcept;
+
+        template <size_t... TIndices>
+        [[nodiscard]] static inline constexpr
+        std::array<BucketKernel, bucketCount> createKernels (std::index_sequence<TIndices...>) noexcept;
+
+        #pragma endregion //!static methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        NarrowPhaseDispatcher ()					                                    = default;
+        NarrowPhaseDispatcher (const NarrowPhaseDispatcher& other)			            = default;
+        NarrowPhaseDispatcher (NarrowPhaseDispatcher&& other)				            = default;
+        ~NarrowPhaseDispatcher ()				                                        = default;
+        NarrowPhaseDispatcher& operator=(NarrowPhaseDispatcher const& other)            = default;
+        NarrowPhaseDispatcher& operator=(NarrowPhaseDispatcher && other)		        = default;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region static methods
+
+        /**
+         * @brief Index of TShape in TShapes
+         */
+        template <typename TShape>
+        [[nodiscard]] static inline constexpr
+        size_t getShapeType () noexcept;
+
+        template <typename TShape>
+        [[nodiscard]] static inline constexpr
+        ShapeHandle createHandle (size_t index) noexcept;
+
+        #pragma endregion //!static methods
+
+        #pragma region methods
+
+        /**
+         * @brief Collide all candidate pairs and write a contact for each colliding pair. Contacts are grouped by pair of shape types,
+         * Contact::pairIndex give the index of the pair in pairs and the normal points from the first shape of the pair to the second one.
+         * 
+         * @param pairs : candidate pairs, for example the user data of DynamicAABBTree or SweepAndPrune pairs
+         * @param contacts : cleared then filled. Keep it between frames to avoid allocations
+         * @param shapes : one array by type of TShapes, in the same order
+         */
+        inline
+        void dispatch (const std::vector<CandidatePair>& pairs, std::vector<Contact<TType>>& contacts, const std::vector<TShapes>&... shapes);
+
+        /**
+         * @brief Same as dispatch but the sorted pairs are split across the workers of pool
+         * 
+         * @param pool 
+         */
+        inline
+        void dispatch (ThreadPool& pool, const std::vector<CandidatePair>& pairs, std::vector<Contact<TType>>& contacts, const std::vector<TShapes>&... shapes);
+
+        /**
+         * @brief Reserve buffers for pairCount candidate pairs
+         */
+        inline
+        void reserve (size_t pairCount);
+
+        #pragma endregion //!methods
+    };
+
+    #include "NarrowPhaseDispatcher.inl"
+
+} /*namespace FoxMath*/
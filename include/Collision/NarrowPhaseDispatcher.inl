@@ -0,0 +1,185 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType, typename TTests, typename... TShapes>
+template <size_t TFirst, size_t TSecond>
+inline
+void NarrowPhaseDispatcher<TType, TTests, TShapes...>::runBucket (const SortedPair* pairs, size_t begin, size_t end, const ShapeArrays& shapes, Contact<TType>* contacts, unsigned char* hits) noexcept
+{
+    using First  = std::tuple_element_t<TFirst, std::tuple<TShapes...>>;
+    using Second = std::tuple_element_t<TSecond, std::tuple<TShapes...>>;
+
+    const First*  firsts  = std::get<TFirst>(shapes);
+    const Second* seconds = std::get<TSecond>(shapes);
+
+    if constexpr (HasCollide<First, Second>::value)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            hits[i] = TTests::collide(firsts[pairs[i].first.index], seconds[pairs[i].second.index], contacts[i]);
+            contacts[i].pairIndex = pairs[i].pairIndex;
+        }
+    }
+    else if constexpr (HasCollide<Second, First>::value)
+    {
+        /*Test written for the other order : the normal is reversed*/
+        for (size_t i = begin; i < end; ++i)
+        {
+            hits[i] = TTests::collide(seconds[pairs[i].second.index], firsts[pairs[i].first.index], contacts[i]);
+            contacts[i].normal    = -contacts[i].normal;
+            contacts[i].pairIndex = pairs[i].pairIndex;
+        }
+    }
+    else
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            hits[i] = false;
+        }
+    }
+}
+
+template <typename TType, typename TTests, typename... TShapes>
+template <size_t... TIndices>
+inline constexpr
+std::array<typename NarrowPhaseDispatcher<TType, TTests, TShapes...>::BucketKernel, NarrowPhaseDispatcher<TType, TTests, TShapes...>::bucketCount> 
+    NarrowPhaseDispatcher<TType, TTests, TShapes...>::createKernels (std::index_sequence<TIndices...>) noexcept
+{
+    return {&runBucket<TIndices / shapeTypeCount, TIndices % shapeTypeCount>...};
+}
+
+template <typename TType, typename TTests, typename... TShapes>
+template <typename TShape>
+inline constexpr
+size_t NarrowPhaseDispatcher<TType, TTests, TShapes...>::getShapeType () noexcept
+{
+    constexpr bool isSameType[] = {std::is_same_v<TShape, TShapes>...};
+
+    for (size_t type = 0; type < shapeTypeCount; ++type)
+    {
+        if (isSameType[type])
+            return type;
+    }
+
+    return shapeTypeCount;
+}
+
+template <typename TType, typename TTests, typename... TShapes>
+template <typename TShape>
+inline constexpr
+ShapeHandle NarrowPhaseDispatcher<TType, TTests, TShapes...>::createHandle (size_t index) noexcept
+{
+    static_assert(getShapeType<TShape>() < shapeTypeCount, "TShape is not a shape type of the dispatcher");
+    return ShapeHandle{getShapeType<TShape>(), index};
+}
+
+template <typename TType, typename TTests, typename... TShapes>
+inline
+void NarrowPhaseDispatcher<TType, TTests, TShapes...>::dispatch (const std::vector<CandidatePair>& pairs, std::vector<Contact<TType>>& contacts, const std::vector<TShapes>&... shapes)
+{
+    dispatch(getGlobalThreadPool(), pairs, contacts, shapes...);
+}
+
+template <typename TType, typename TTests, typename... TShapes>
+inline
+void NarrowPhaseDispatcher<TType, TTests, TShapes...>::dispatch (ThreadPool& pool, const std::vector<CandidatePair>& pairs, std::vector<Contact<TType>>& contacts, const std::vector<TShapes>&... shapes)
+{
+    constexpr std::array<BucketKernel, bucketCount> kernels = createKernels(std::make_index_sequence<bucketCount>{});
+
+    const size_t count = pairs.size();
+
+    /*Counting sort of the pairs by bucket*/
+    m_bucketOffsets.fill(0);
+    for (const CandidatePair& pair : pairs)
+    {
+        assert(pair.first.type < shapeTypeCount && pair.second.type < shapeTypeCount && "Shape type is not a type of the dispatcher");
+        ++m_bucketOffsets[std::min(pair.first.type, pair.second.type) * shapeTypeCount + std::max(pair.first.type, pair.second.type) + 1];
+    }
+
+    for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+        m_bucketOffsets[bucket + 1] += m_bucketOffsets[bucket];
+
+    std::array<size_t, bucketCount> cursors;
+    std::copy(m_bucketOffsets.begin(), m_bucketOffsets.end() - 1, cursors.begin());
+
+    m_sortedPairs.resize(count);
+    m_contacts.resize(count);
+    m_hits.resize(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const CandidatePair& pair = pairs[i];
+        const bool isSwapped = pair.first.type > pair.second.type;
+        const size_t bucket = isSwapped ? pair.second.type * shapeTypeCount + pair.first.type : pair.first.type * shapeTypeCount + pair.second.type;
+
+        m_sortedPairs[cursors[bucket]++] = isSwapped ? SortedPair{pair.second, pair.first, i, true} : SortedPair{pair.first, pair.second, i, false};
+    }
+
+    /*Threads receive contiguous ranges of sorted pairs : a range run the kernel of each bucket it overlaps*/
+    const ShapeArrays shapeArrays {shapes.data()...};
+
+    pool.parallelFor(count, parallelGrain, [&](size_t begin, size_t end) noexcept
+    {
+        size_t bucket = static_cast<size_t>(std::upper_bound(m_bucketOffsets.begin(), m_bucketOffsets.end(), begin) - m_bucketOffsets.begin()) - 1;
+
+        while (begin < end)
+        {
+            const size_t bucketEnd = std::min(end, m_bucketOffsets[bucket + 1]);
+
+            if (bucketEnd > begin)
+                kernels[bucket](m_sortedPairs.data(), begin, bucketEnd, shapeArrays, m_contacts.data(), m_hits.data());
+
+            begin = bucketEnd;
+            ++bucket;
+        }
+    });
+
+    contacts.clear();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!m_hits[i])
+            continue;
+
+        contacts.push_back(m_contacts[i]);
+
+        if (m_sortedPairs[i].isSwapped)
+            contacts.back().normal = -contacts.back().normal;
+    }
+}
+
+template <typename TType, typename TTests, typename... TShapes>
+inline
+void NarrowPhaseDispatcher<TType, TTests, TShapes...>::reserve (size_t pairCount)
+{
+    m_sortedPairs.reserve(pairCount);
+    m_contacts.reserve(pairCount);
+    m_hits.reserve(pairCount);
+}
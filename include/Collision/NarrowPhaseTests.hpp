@@ -0,0 +1,104 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Collision/BoundingBox3.hpp" //BoundingBox3
+#include "Collision/BoundingSphere.hpp" //BoundingSphere
+#include "Collision/OrientedBox3.hpp" //OrientedBox3
+#include "Collision/Contact.hpp" //Contact
+#include "Vector/Vector3.hpp" //Vector3<TType>
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <cmath> //std::sqrt
+#include <algorithm> //std::min, std::max
+#include <limits> //std::numeric_limits
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class NarrowPhaseTests;
+
+    /**
+     * @brief Contact generation between the Collision shapes. Each collide overload test a pair of shape types, return true and fill contact
+     * if shapes overlap. Used as the test table of NarrowPhaseDispatcher : add a shape type with a class providing the same collide overloads.
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class NarrowPhaseTests<TType>
+    {
+        public:
+
+        #pragma region constructor/destructor
+
+        NarrowPhaseTests ()					                            = delete;
+        NarrowPhaseTests (const NarrowPhaseTests& other)			    = delete;
+        NarrowPhaseTests (NarrowPhaseTests&& other)				        = delete;
+        ~NarrowPhaseTests ()				                            = delete;
+        NarrowPhaseTests& operator=(NarrowPhaseTests const& other)      = delete;
+        NarrowPhaseTests& operator=(NarrowPhaseTests && other)		    = delete;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region static methods
+
+        /**
+         * @brief Contact point is the middle of the overlap along the normal
+         */
+        static inline
+        bool collide (const BoundingSphere<TType>& sphere1, const BoundingSphere<TType>& sphere2, Contact<TType>& contact) noexcept;
+
+        /**
+         * @brief Contact point is the point of the box closest to the sphere center, or the sphere center if it is inside the box
+         */
+        static inline
+        bool collide (const BoundingSphere<TType>& sphere, const BoundingBox3<TType>& box, Contact<TType>& contact) noexcept;
+
+        /**
+         * @brief Normal is the axis of smallest separating translation and contact point the center of the overlap region
+         */
+        static inline
+        bool collide (const BoundingBox3<TType>& box1, const BoundingBox3<TType>& box2, Contact<TType>& contact) noexcept;
+
+        /**
+         * @brief Separating axis test on the 15 axes (faces of both boxes and cross products of their edges). Normal is the axis of
+         * smallest penetration and contact point the vertex of box2 deepest in box1, moved back by half the penetration.
+         * @note Single contact point : a face against face contact give one of the vertices of the face, not the contact manifold
+         */
+        static inline
+        bool collide (const OrientedBox3<TType>& box1, const OrientedBox3<TType>& box2, Contact<TType>& contact) noexcept;
+
+        #pragma endregion //!static methods
+    };
+
+    #include "NarrowPhaseTests.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,253 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+inline
+bool NarrowPhaseTests<TType>::collide (const BoundingSphere<TType>& sphere1, const BoundingSphere<TType>& sphere2, Contact<TType>& contact) noexcept
+{
+    const Vector3<TType> delta = sphere2.center - sphere1.center;
+    const TType radiusSum = sphere1.radius + sphere2.radius;
+    const TType squareDistance = delta.squareLength();
+
+    if (squareDistance > radiusSum * radiusSum)
+        return false;
+
+    const TType distance = static_cast<TType>(std::sqrt(squareDistance));
+
+    /*Concentric spheres : any direction separate them*/
+    contact.normal      = (distance > static_cast<TType>(0)) ? Vector3<TType>(delta / distance) : Vector3<TType>{static_cast<TType>(0), static_cast<TType>(1), static_cast<TType>(0)};
+    contact.penetration = radiusSum - distance;
+    contact.point       = sphere1.center + contact.normal * (sphere1.radius - contact.penetration / static_cast<TType>(2));
+    return true;
+}
+
+template <typename TType>
+inline
+bool NarrowPhaseTests<TType>::collide (const BoundingSphere<TType>& sphere, const BoundingBox3<TType>& box, Contact<TType>& contact) noexcept
+{
+    Vector3<TType> closest;
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        closest.getData()[axis] = std::min(std::max(sphere.center.getData()[axis], box.min.getData()[axis]), box.max.getData()[axis]);
+    }
+
+    const Vector3<TType> delta = closest - sphere.center;
+    const TType squareDistance = delta.squareLength();
+
+    if (squareDistance > sphere.radius * sphere.radius)
+        return false;
+
+    if (squareDistance > static_cast<TType>(0))
+    {
+        const TType distance = static_cast<TType>(std::sqrt(squareDistance));
+
+        contact.normal      = delta / distance;
+        contact.penetration = sphere.radius - distance;
+        contact.point       = closest;
+        return true;
+    }
+
+    /*Center inside the box : the sphere leave the box by the nearest face, so the box is pushed the opposite way*/
+    size_t bestAxis = 0;
+    TType bestDistance = std::numeric_limits<TType>::max();
+    TType bestSign = static_cast<TType>(1);
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const TType toMin = sphere.center.getData()[axis] - box.min.getData()[axis];
+        const TType toMax = box.max.getData()[axis] - sphere.center.getData()[axis];
+
+        if (toMin < bestDistance)
+        {
+            bestDistance = toMin;
+            bestAxis = axis;
+            bestSign = static_cast<TType>(1);
+        }
+
+        if (toMax < bestDistance)
+        {
+            bestDistance = toMax;
+            bestAxis = axis;
+            bestSign = static_cast<TType>(-1);
+        }
+    }
+
+    contact.normal = Vector3<TType>{};
+    contact.normal.getData()[bestAxis] = bestSign;
+    contact.penetration = sphere.radius + bestDistance;
+    contact.point       = sphere.center;
+    return true;
+}
+
+template <typename TType>
+inline
+bool NarrowPhaseTests<TType>::collide (const BoundingBox3<TType>& box1, const BoundingBox3<TType>& box2, Contact<TType>& contact) noexcept
+{
+    size_t bestAxis = 0;
+    TType bestPenetration = std::numeric_limits<TType>::max();
+    TType bestSign = static_cast<TType>(1);
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        /*Translation of box2 along +axis and -axis that separate the boxes*/
+        const TType positivePush = box1.max.getData()[axis] - box2.min.getData()[axis];
+        const TType negativePush = box2.max.getData()[axis] - box1.min.getData()[axis];
+
+        if (positivePush < static_cast<TType>(0) || negativePush < static_cast<TType>(0))
+            return false;
+
+        if (positivePush < bestPenetration)
+        {
+            bestPenetration = positivePush;
+            bestAxis = axis;
+            bestSign = static_cast<TType>(1);
+        }
+
+        if (negativePush < bestPenetration)
+        {
+            bestPenetration = negativePush;
+            bestAxis = axis;
+            bestSign = static_cast<TType>(-1);
+        }
+
+        contact.point.getData()[axis] = (std::max(box1.min.getData()[axis], box2.min.getData()[axis]) + std::min(box1.max.getData()[axis], box2.max.getData()[axis])) / static_cast<TType>(2);
+    }
+
+    contact.normal = Vector3<TType>{};
+    contact.normal.getData()[bestAxis] = bestSign;
+    contact.penetration = bestPenetration;
+    return true;
+}
+
+template <typename TType>
+inline
+bool NarrowPhaseTests<TType>::collide (const OrientedBox3<TType>& box1, const OrientedBox3<TType>& box2, Contact<TType>& contact) noexcept
+{
+    /*Cross product of nearly parallel edges is not a valid axis, the face axes already cover this case*/
+    constexpr TType parallelEpsilon = static_cast<TType>(1e-6);
+
+    /*Rotation of box2 in the frame of box1 : R[i][j] = box1 axis i . box2 axis j*/
+    TType R[3][3];
+    TType absR[3][3];
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            R[i][j]    = box1.axes[i].dot(box2.axes[j]);
+            absR[i][j] = std::abs(R[i][j]) + parallelEpsilon;
+        }
+    }
+
+    const Vector3<TType> translation = box2.center - box1.center;
+    const TType t[3] = {translation.dot(box1.axes[0]), translation.dot(box1.axes[1]), translation.dot(box1.axes[2])};
+    const TType* const a = box1.extents.getData().data();
+    const TType* const b = box2.extents.getData().data();
+
+    /*Best axis in the frame of box1, oriented from box1 to box2*/
+    TType bestAxis[3] = {static_cast<TType>(1), static_cast<TType>(0), static_cast<TType>(0)};
+    TType bestPenetration = std::numeric_limits<TType>::max();
+
+    /*Return false if axis separate the boxes, else keep it if its penetration is the smallest one*/
+    const auto testAxis = [&](const TType (&axis)[3], TType distance, TType radius) noexcept
+    {
+        const TType overlap = radius - std::abs(distance);
+
+        if (overlap < static_cast<TType>(0))
+            return false;
+
+        const TType length = static_cast<TType>(std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]));
+
+        if (length > parallelEpsilon && overlap < bestPenetration * length)
+        {
+            const TType sign = (distance < static_cast<TType>(0)) ? static_cast<TType>(-1) : static_cast<TType>(1);
+            bestPenetration = overlap / length;
+
+            for (size_t k = 0; k < 3; ++k)
+                bestAxis[k] = axis[k] * sign / length;
+        }
+
+        return true;
+    };
+
+    /*Face axes of box1*/
+    for (size_t i = 0; i < 3; ++i)
+    {
+        TType axis[3] = {};
+        axis[i] = static_cast<TType>(1);
+
+        if (!testAxis(axis, t[i], a[i] + b[0] * absR[i][0] + b[1] * absR[i][1] + b[2] * absR[i][2]))
+            return false;
+    }
+
+    /*Face axes of box2*/
+    for (size_t j = 0; j < 3; ++j)
+    {
+        const TType axis[3] = {R[0][j], R[1][j], R[2][j]};
+
+        if (!testAxis(axis, t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j], a[0] * absR[0][j] + a[1] * absR[1][j] + a[2] * absR[2][j] + b[j]))
+            return false;
+    }
+
+    /*Cross products of axis i of box1 and axis j of box2*/
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const size_t i1 = (i + 1) % 3;
+        const size_t i2 = (i + 2) % 3;
+
+        for (size_t j = 0; j < 3; ++j)
+        {
+            const size_t j1 = (j + 1) % 3;
+            const size_t j2 = (j + 2) % 3;
+
+            TType axis[3] = {};
+            axis[i1] = -R[i2][j];
+            axis[i2] = R[i1][j];
+
+            if (!testAxis(axis, t[i2] * R[i1][j] - t[i1] * R[i2][j], a[i1] * absR[i2][j] + a[i2] * absR[i1][j] + b[j1] * absR[i][j2] + b[j2] * absR[i][j1]))
+                return false;
+        }
+    }
+
+    contact.normal      = box1.axes[0] * bestAxis[0] + box1.axes[1] * bestAxis[1] + box1.axes[2] * bestAxis[2];
+    contact.penetration = bestPenetration;
+
+    /*Vertex of box2 the furthest along -normal*/
+    Vector3<TType> deepest = box2.center;
+    for (size_t j = 0; j < 3; ++j)
+    {
+        const TType sign = (contact.normal.dot(box2.axes[j]) > static_cast<TType>(0)) ? static_cast<TType>(-1) : static_cast<TType>(1);
+        deepest += box2.axes[j] * (sign * b[j]);
+    }
+
+    contact.point = deepest + contact.normal * (bestPenetration / static_cast<TType>(2));
+    return true;
+}
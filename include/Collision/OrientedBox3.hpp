@@ -0,0 +1,85 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 19 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Collision/BoundingBox3.hpp" //BoundingBox3
+#include "Vector/Vector3.hpp" //Vector3<TType>
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <array> //std::array
+#include <cmath> //std::abs
+#include <iostream> //std::ostream
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    struct OrientedBox3;
+
+    /**
+     * @brief Oriented box stored by its center, its three unit orthogonal axes and its half extents along each axis.
+     * Same layout than Shape3D OrientedBox (referential origin, unitI, unitJ, unitK and extI, extJ, extK).
+     * @example `OrientedBox3<float> box {center, {unitI, unitJ, unitK}, Vec3f{1.f, 0.5f, 2.f}};`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    struct OrientedBox3<TType>
+    {
+        #pragma region attribut
+
+        Vector3<TType>                  center  {};
+        std::array<Vector3<TType>, 3>   axes    {};
+        Vector3<TType>                  extents {};
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        /**
+         * @brief Box containing the oriented box, used to insert it in a broad phase. Same as Shape3D OrientedBox::getAABB
+         */
+        [[nodiscard]] inline
+        BoundingBox3<TType> getBoundingBox () const noexcept;
+
+        #pragma endregion //!methods
+    };
+
+    #pragma region stream operators
+
+    template <typename TType>
+    inline
+    std::ostream& 	operator<<		(std::ostream& out, const OrientedBox3<TType>& box) noexcept;
+
+    #pragma endregion //!stream operators
+
+    #include "OrientedBox3.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,54 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 19 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+inline
+BoundingBox3<TType> OrientedBox3<TType>::getBoundingBox () const noexcept
+{
+    TType halfSize[3];
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        halfSize[axis] = std::abs(axes[0].getData()[axis]) * extents.getX() + 
+                         std::abs(axes[1].getData()[axis]) * extents.getY() + 
+                         std::abs(axes[2].getData()[axis]) * extents.getZ();
+    }
+
+    return BoundingBox3<TType>::createFromCenterExtents(center, halfSize[0], halfSize[1], halfSize[2]);
+}
+
+template <typename TType>
+inline
+std::ostream& 	operator<<		(std::ostream& out, const OrientedBox3<TType>& box) noexcept
+{
+    out << "center : " << box.center << " axes : " << box.axes[0] << box.axes[1] << box.axes[2] << " extents : " << box.extents;
+    return out;
+}
@@ -0,0 +1,120 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 19 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Collision/OrientedBox3.hpp" //OrientedBox3
+#include "Vector/VectorBatch.hpp" //VectorBatch
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <cassert> //assert
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /*Define default template arg and apply template condition*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class OrientedBoxBatch;
+
+    /**
+     * @brief Structure of arrays container of oriented boxes : 15 streams for the center (0 to 2), the axes I (3 to 5), J (6 to 8), K (9 to 11)
+     * and the half extents (12 to 14). Used by OrientedBoxSAT to test one box against Packet::size boxes at once.
+     * @example `FoxMath::OrientedBoxBatch<float> boxes (obbs.data(), obbs.size());`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class OrientedBoxBatch<TType> : public VectorBatch<15, TType>
+    {
+        private:
+
+        using Parent = VectorBatch<15, TType>;
+
+        public:
+
+        #pragma region static attribut
+
+        static constexpr size_t centerStream    = 0;
+        static constexpr size_t axesStream      = 3; /*Axis i component c is in stream axesStream + 3 * i + c*/
+        static constexpr size_t extentsStream   = 12;
+
+        #pragma endregion //! static attribut
+
+        #pragma region constructor/destructor
+
+        OrientedBoxBatch ()                                             = default;
+        OrientedBoxBatch (const OrientedBoxBatch& other)			    = default;
+        OrientedBoxBatch (OrientedBoxBatch&& other) noexcept	        = default;
+        ~OrientedBoxBatch ()				                            = default;
+        OrientedBoxBatch& operator=(OrientedBoxBatch const& other)      = default;
+        OrientedBoxBatch& operator=(OrientedBoxBatch && other)          = default;
+
+        /**
+         * @brief Gather count oriented boxes
+         * 
+         * @param boxes 
+         * @param count 
+         */
+        explicit inline
+        OrientedBoxBatch (const OrientedBox3<TType>* boxes, size_t count);
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Gather count oriented boxes from array of structure in the batch from index offset. The batch grows if needed.
+         * 
+         * @param boxes 
+         * @param count 
+         * @param offset 
+         */
+        inline
+        void gather (const OrientedBox3<TType>* boxes, size_t count, size_t offset = 0);
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        OrientedBox3<TType> getBox (size_t index) const noexcept;
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        inline
+        void setBox (size_t index, const OrientedBox3<TType>& box) noexcept;
+
+        #pragma endregion //!mutator
+    };
+
+    #include "OrientedBoxBatch.inl"
+
+} /*namespace FoxMath*/
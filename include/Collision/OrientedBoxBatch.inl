@@ -0,0 +1,90 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 19 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+inline
+OrientedBoxBatch<TType>::OrientedBoxBatch (const OrientedBox3<TType>* boxes, size_t count)
+{
+    gather(boxes, count);
+}
+
+template <typename TType>
+inline
+void OrientedBoxBatch<TType>::gather (const OrientedBox3<TType>* boxes, size_t count, size_t offset)
+{
+    if (offset + count > this->size())
+        this->resize(offset + count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        setBox(offset + i, boxes[i]);
+    }
+}
+
+template <typename TType>
+inline
+OrientedBox3<TType> OrientedBoxBatch<TType>::getBox (size_t index) const noexcept
+{
+    assert(index < this->size() && "Index out of range");
+
+    OrientedBox3<TType> box;
+
+    for (size_t component = 0; component < 3; component++)
+    {
+        box.center.getData()[component]  = this->m_streams[centerStream + component][index];
+        box.extents.getData()[component] = this->m_streams[extentsStream + component][index];
+
+        for (size_t axis = 0; axis < 3; axis++)
+        {
+            box.axes[axis].getData()[component] = this->m_streams[axesStream + 3 * axis + component][index];
+        }
+    }
+
+    return box;
+}
+
+template <typename TType>
+inline
+void OrientedBoxBatch<TType>::setBox (size_t index, const OrientedBox3<TType>& box) noexcept
+{
+    assert(index < this->size() && "Index out of range");
+
+    for (size_t component = 0; component < 3; component++)
+    {
+        this->m_streams[centerStream + component][index]  = box.center.getData()[component];
+        this->m_streams[extentsStream + component][index] = box.extents.getData()[component];
+
+        for (size_t axis = 0; axis < 3; axis++)
+        {
+            this->m_streams[axesStream + 3 * axis + component][index] = box.axes[axis].getData()[component];
+        }
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 19 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Collision/OrientedBox3.hpp" //OrientedBox3
+#include "Collision/OrientedBoxBatch.hpp" //OrientedBoxBatch
+#include "Numeric/SIMD.hpp" //SIMD::Packet
+#include "Thread/ThreadPool.hpp" //ThreadPool, getGlobalThreadPool
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <cmath> //std::abs
+#include <algorithm> //std::min
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class OrientedBoxSAT;
+
+    /**
+     * @brief Separating axis test between oriented boxes in projected radius form (Ericson, Real-Time Collision Detection 4.4.1).
+     * The rotation R of the second box in the frame of the first one and |R| + epsilon are computed once, then each of the 15 axes
+     * (3 face axes of each box and the 9 cross products of their axes) compare the distance between centers to the sum of the projected half extents.
+     * No box corner is evaluated. The epsilon added to |R| keeps the degenerate cross axes of parallel edges from reporting a false separation.
+     * The batch test evaluate one box against Packet::size boxes at once and skip the 9 cross axes when all lanes are separated by a face axis.
+     * @example `bool isColliding = OrientedBoxSAT<float>::isOverlapping(box1, box2);`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class OrientedBoxSAT<TType>
+    {
+        private:
+
+        using Packet = SIMD::Packet<TType>;
+        using PacketType = typename Packet::Type;
+
+        /**
+         * @brief Minimum number of boxes by thread for the batch test
+         */
+        static constexpr size_t parallelGrain = 1 << 12;
+
+        public:
+
+        #pragma region static attribut
+
+        /**
+         * @brief Added to the absolute value of the relative rotation terms
+         */
+        static constexpr TType parallelEpsilon = static_cast<TType>(1e-6);
+
+        #pragma endregion //! static attribut
+
+        protected:
+
+        #pragma region static methods
+
+        /**
+         * @brief Bit i is set if box overlap the box index + i of boxes
+         */
+        [[nodiscard]] static inline
+        unsigned int overlapMask (const OrientedBox3<TType>& box, const OrientedBoxBatch<TType>& boxes, size_t index) noexcept;
+
+        #pragma endregion //!static methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        OrientedBoxSAT ()					                        = delete;
+        OrientedBoxSAT (const OrientedBoxSAT& other)			    = delete;
+        OrientedBoxSAT (OrientedBoxSAT&& other)				        = delete;
+        ~OrientedBoxSAT ()				                            = delete;
+        OrientedBoxSAT& operator=(OrientedBoxSAT const& other)      = delete;
+        OrientedBoxSAT& operator=(OrientedBoxSAT && other)		    = delete;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region static methods
+
+        /**
+         * @brief True if both boxes overlap or touch. Return as soon as a separating axis is found
+         */
+        [[nodiscard]] static inline
+        bool isOverlapping (const OrientedBox3<TType>& box1, const OrientedBox3<TType>& box2) noexcept;
+
+        /**
+         * @brief Test box against each box of boxes. Big batches are split across the threads of the pool
+         * 
+         * @param box 
+         * @param boxes 
+         * @param results : boxes.size() booleans, true if box overlap boxes[i]
+         * @param pool 
+         */
+        static inline
+        void isOverlapping (const OrientedBox3<TType>& box, const OrientedBoxBatch<TType>& boxes, bool* results, ThreadPool& pool = getGlobalThreadPool()) noexcept;
+
+        #pragma endregion //!static methods
+    };
+
+    #include "OrientedBoxSAT.inl"
+
+} /*namespace FoxMath*/
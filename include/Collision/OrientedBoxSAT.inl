@@ -0,0 +1,195 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 19 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+inline
+unsigned int OrientedBoxSAT<TType>::overlapMask (const OrientedBox3<TType>& box, const OrientedBoxBatch<TType>& boxes, size_t index) noexcept
+{
+    using Batch = OrientedBoxBatch<TType>;
+
+    const PacketType epsilon = Packet::set1(parallelEpsilon);
+
+    /*Axes and center of the boxes of the packet*/
+    PacketType axesB[3][3];
+    PacketType translation[3];
+    PacketType b[3];
+
+    for (size_t component = 0; component < 3; ++component)
+    {
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            axesB[axis][component] = Packet::load(boxes.getStream(Batch::axesStream + 3 * axis + component) + index);
+        }
+
+        translation[component] = Packet::sub(Packet::load(boxes.getStream(Batch::centerStream + component) + index), Packet::set1(box.center.getData()[component]));
+        b[component] = Packet::load(boxes.getStream(Batch::extentsStream + component) + index);
+    }
+
+    /*Rotation of the boxes in the frame of box, translation in the frame of box*/
+    PacketType R[3][3];
+    PacketType absR[3][3];
+    PacketType t[3];
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const PacketType axisA[3] = {Packet::set1(box.axes[i].getX()), Packet::set1(box.axes[i].getY()), Packet::set1(box.axes[i].getZ())};
+
+        for (size_t j = 0; j < 3; ++j)
+        {
+            R[i][j]    = Packet::mulAdd(Packet::mulAdd(Packet::mul(axisA[0], axesB[j][0]), axisA[1], axesB[j][1]), axisA[2], axesB[j][2]);
+            absR[i][j] = Packet::add(Packet::abs(R[i][j]), epsilon);
+        }
+
+        t[i] = Packet::mulAdd(Packet::mulAdd(Packet::mul(axisA[0], translation[0]), axisA[1], translation[1]), axisA[2], translation[2]);
+    }
+
+    const PacketType a[3] = {Packet::set1(box.extents.getX()), Packet::set1(box.extents.getY()), Packet::set1(box.extents.getZ())};
+    unsigned int overlap = ~0u;
+
+    /*Face axes of box*/
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const PacketType radiusB = Packet::mulAdd(Packet::mulAdd(Packet::mul(b[0], absR[i][0]), b[1], absR[i][1]), b[2], absR[i][2]);
+        overlap &= Packet::lessEqualMask(Packet::abs(t[i]), Packet::add(a[i], radiusB));
+    }
+
+    /*Face axes of the packet boxes*/
+    for (size_t j = 0; j < 3; ++j)
+    {
+        const PacketType radiusA  = Packet::mulAdd(Packet::mulAdd(Packet::mul(a[0], absR[0][j]), a[1], absR[1][j]), a[2], absR[2][j]);
+        const PacketType distance = Packet::mulAdd(Packet::mulAdd(Packet::mul(t[0], R[0][j]), t[1], R[1][j]), t[2], R[2][j]);
+        overlap &= Packet::lessEqualMask(Packet::abs(distance), Packet::add(radiusA, b[j]));
+    }
+
+    constexpr unsigned int laneMask = (1u << Packet::size) - 1u;
+
+    /*Most pairs are separated by a face axis*/
+    if ((overlap & laneMask) == 0)
+        return 0;
+
+    /*Cross products of axis i of box and axis j of the packet boxes*/
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const size_t i1 = (i + 1) % 3;
+        const size_t i2 = (i + 2) % 3;
+
+        for (size_t j = 0; j < 3; ++j)
+        {
+            const size_t j1 = (j + 1) % 3;
+            const size_t j2 = (j + 2) % 3;
+
+            const PacketType radiusA  = Packet::mulAdd(Packet::mul(a[i1], absR[i2][j]), a[i2], absR[i1][j]);
+            const PacketType radiusB  = Packet::mulAdd(Packet::mul(b[j1], absR[i][j2]), b[j2], absR[i][j1]);
+            const PacketType distance = Packet::sub(Packet::mul(t[i2], R[i1][j]), Packet::mul(t[i1], R[i2][j]));
+            overlap &= Packet::lessEqualMask(Packet::abs(distance), Packet::add(radiusA, radiusB));
+        }
+    }
+
+    return overlap & laneMask;
+}
+
+template <typename TType>
+inline
+bool OrientedBoxSAT<TType>::isOverlapping (const OrientedBox3<TType>& box1, const OrientedBox3<TType>& box2) noexcept
+{
+    /*Rotation of box2 in the frame of box1 : R[i][j] = box1 axis i . box2 axis j*/
+    TType R[3][3];
+    TType absR[3][3];
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            R[i][j]    = box1.axes[i].dot(box2.axes[j]);
+            absR[i][j] = std::abs(R[i][j]) + parallelEpsilon;
+        }
+    }
+
+    const Vector3<TType> translation = box2.center - box1.center;
+    const TType t[3] = {translation.dot(box1.axes[0]), translation.dot(box1.axes[1]), translation.dot(box1.axes[2])};
+    const TType* const a = box1.extents.getData().data();
+    const TType* const b = box2.extents.getData().data();
+
+    /*Face axes of box1*/
+    for (size_t i = 0; i < 3; ++i)
+    {
+        if (std::abs(t[i]) > a[i] + b[0] * absR[i][0] + b[1] * absR[i][1] + b[2] * absR[i][2])
+            return false;
+    }
+
+    /*Face axes of box2*/
+    for (size_t j = 0; j < 3; ++j)
+    {
+        if (std::abs(t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j]) > a[0] * absR[0][j] + a[1] * absR[1][j] + a[2] * absR[2][j] + b[j])
+            return false;
+    }
+
+    /*Cross products of axis i of box1 and axis j of box2*/
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const size_t i1 = (i + 1) % 3;
+        const size_t i2 = (i + 2) % 3;
+
+        for (size_t j = 0; j < 3; ++j)
+        {
+            const size_t j1 = (j + 1) % 3;
+            const size_t j2 = (j + 2) % 3;
+
+            if (std::abs(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > a[i1] * absR[i2][j] + a[i2] * absR[i1][j] + b[j1] * absR[i][j2] + b[j2] * absR[i][j1])
+                return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename TType>
+inline
+void OrientedBoxSAT<TType>::isOverlapping (const OrientedBox3<TType>& box, const OrientedBoxBatch<TType>& boxes, bool* results, ThreadPool& pool) noexcept
+{
+    const size_t count       = boxes.size();
+    const size_t packetCount = (count + Packet::size - 1) / Packet::size;
+
+    pool.parallelFor(packetCount, parallelGrain / Packet::size, [&](size_t begin, size_t end)
+    {
+        for (size_t packet = begin; packet < end; ++packet)
+        {
+            const size_t index = packet * Packet::size;
+            const unsigned int mask = overlapMask(box, boxes, index);
+            const size_t laneCount = std::min(Packet::size, count - index);
+
+            for (size_t lane = 0; lane < laneCount; ++lane)
+            {
+                results[index + lane] = (mask >> lane) & 1u;
+            }
+        }
+    });
+}
@@ -0,0 +1,127 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 21 h 45
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Vector/Vector3.hpp" //Vector3<TType>
+#include "Vector/VectorBatch.hpp" //VectorBatch
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <algorithm> //std::fill
+#include <limits> //std::numeric_limits
+#include <cassert> //assert
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /*Define default template arg and apply template condition*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class SegmentBatch;
+
+    /**
+     * @brief Structure of arrays container of segments [pt1, pt2] : 9 streams for pt1 (0 to 2), the direction pt2 - pt1 (3 to 5)
+     * and the inverse of the direction (6 to 8). Inverse directions are computed once when segments are set, so the slab test of SegmentSlabTest
+     * only multiply. A null direction component has an inverse of +/- max value instead of infinity : the slab test never compute 0 * infinity.
+     * @example `FoxMath::SegmentBatch<float> rays (rayCount); rays.setSegment(i, eyePosition, target);`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class SegmentBatch<TType> : public VectorBatch<9, TType>
+    {
+        private:
+
+        using Parent = VectorBatch<9, TType>;
+
+        public:
+
+        #pragma region static attribut
+
+        static constexpr size_t originStream            = 0;
+        static constexpr size_t directionStream         = 3;
+        static constexpr size_t inverseDirectionStream  = 6;
+
+        #pragma endregion //! static attribut
+
+        #pragma region static methods
+
+        /**
+         * @brief 1 / direction, or +/- max value if direction is 0
+         */
+        [[nodiscard]] static inline
+        TType getInverseDirection (TType direction) noexcept;
+
+        #pragma endregion //!static methods
+
+        #pragma region constructor/destructor
+
+        SegmentBatch ()                                         = default;
+        SegmentBatch (const SegmentBatch& other)			    = default;
+        SegmentBatch (SegmentBatch&& other) noexcept	        = default;
+        ~SegmentBatch ()				                        = default;
+        SegmentBatch& operator=(SegmentBatch const& other)      = default;
+        SegmentBatch& operator=(SegmentBatch && other)          = default;
+
+        /**
+         * @brief Construct batch of size null segments
+         * 
+         * @param size 
+         */
+        explicit inline
+        SegmentBatch (size_t size);
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        Vector3<TType> getPt1 (size_t index) const noexcept;
+
+        [[nodiscard]] inline
+        Vector3<TType> getPt2 (size_t index) const noexcept;
+
+        /**
+         * @brief pt2 - pt1
+         */
+        [[nodiscard]] inline
+        Vector3<TType> getDirection (size_t index) const noexcept;
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        inline
+        void setSegment (size_t index, const Vector3<TType>& pt1, const Vector3<TType>& pt2) noexcept;
+
+        #pragma endregion //!mutator
+    };
+
+    #include "SegmentBatch.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,93 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 21 h 45
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+inline
+TType SegmentBatch<TType>::getInverseDirection (TType direction) noexcept
+{
+    if (direction == static_cast<TType>(0))
+        return std::numeric_limits<TType>::max();
+
+    return static_cast<TType>(1) / direction;
+}
+
+template <typename TType>
+inline
+SegmentBatch<TType>::SegmentBatch (size_t size)
+    : Parent (size)
+{
+    /*Null direction*/
+    for (size_t component = 0; component < 3; component++)
+    {
+        std::fill(this->m_streams[inverseDirectionStream + component].begin(), this->m_streams[inverseDirectionStream + component].end(), std::numeric_limits<TType>::max());
+    }
+}
+
+template <typename TType>
+inline
+Vector3<TType> SegmentBatch<TType>::getPt1 (size_t index) const noexcept
+{
+    assert(index < this->size() && "Index out of range");
+
+    return Vector3<TType>{this->m_streams[originStream][index], this->m_streams[originStream + 1][index], this->m_streams[originStream + 2][index]};
+}
+
+template <typename TType>
+inline
+Vector3<TType> SegmentBatch<TType>::getPt2 (size_t index) const noexcept
+{
+    return getPt1(index) + getDirection(index);
+}
+
+template <typename TType>
+inline
+Vector3<TType> SegmentBatch<TType>::getDirection (size_t index) const noexcept
+{
+    assert(index < this->size() && "Index out of range");
+
+    return Vector3<TType>{this->m_streams[directionStream][index], this->m_streams[directionStream + 1][index], this->m_streams[directionStream + 2][index]};
+}
+
+template <typename TType>
+inline
+void SegmentBatch<TType>::setSegment (size_t index, const Vector3<TType>& pt1, const Vector3<TType>& pt2) noexcept
+{
+    assert(index < this->size() && "Index out of range");
+
+    for (size_t component = 0; component < 3; component++)
+    {
+        const TType direction = pt2.getData()[component] - pt1.getData()[component];
+
+        this->m_streams[originStream + component][index]            = pt1.getData()[component];
+        this->m_streams[directionStream + component][index]         = direction;
+        this->m_streams[inverseDirectionStream + component][index]  = getInverseDirection(direction);
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 21 h 45
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Collision/BoundingBox3.hpp" //BoundingBox3
+#include "Collision/BoundingBoxBatch.hpp" //BoundingBoxBatch
+#include "Collision/SegmentBatch.hpp" //SegmentBatch
+#include "Vector/Vector3.hpp" //Vector3<TType>
+#include "Numeric/SIMD.hpp" //SIMD::Packet
+#include "Thread/ThreadPool.hpp" //ThreadPool, getGlobalThreadPool
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <algorithm> //std::min
+#include <cassert> //assert
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    struct SlabHit;
+
+    /**
+     * @brief Result of the slab test of a segment [pt1, pt2] against a box. Parameters t are along pt1 + t * (pt2 - pt1) and are not clamped :
+     * tEnter < 0 if pt1 is inside the box and tExit > 1 if pt2 is inside the box.
+     * Faces are indexed 0 : +x (right), 1 : -x (left), 2 : +y (up), 3 : -y (down), 4 : +z (forward), 5 : -z (backward)
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    struct SlabHit<TType>
+    {
+        TType           tEnter      {static_cast<TType>(0)};
+        TType           tExit       {static_cast<TType>(0)};
+        unsigned char   enterFace   {0};
+        unsigned char   exitFace    {0};
+        bool            isHit       {false};
+    };
+
+    /*Use of IsArithmetic*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class SegmentSlabTest;
+
+    /**
+     * @brief Branchless slab test between segments and axis aligned boxes (Kay-Kajiya). For each axis the parameters of the two slab planes
+     * are (min - pt1) / direction and (max - pt1) / direction, the segment enter the box at the greatest near parameter and exit at the smallest far parameter.
+     * The packet tests evaluate Packet::size segments against one box or one segment against Packet::size boxes with min/max and precomputed
+     * inverse directions : no division and no branch by axis or by lane.
+     * @example `SegmentSlabTest<float>::intersect(rays, box, hits.data());`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class SegmentSlabTest<TType>
+    {
+        private:
+
+        using Packet = SIMD::Packet<TType>;
+        using PacketType = typename Packet::Type;
+
+        /**
+         * @brief Minimum number of tests by thread for the batch test
+         */
+        static constexpr size_t parallelGrain = 1 << 12;
+
+        protected:
+
+        #pragma region static methods
+
+        /**
+         * @brief Slab test of each lane. Bit i of the result is set if lane i hit
+         * 
+         * @tparam TPacket : SIMD::Packet for the batch tests, SIMD::ScalarPacket for the single test
+         * @param origin : pt1 by axis
+         * @param inverseDirection : 1 / (pt2 - pt1) by axis
+         * @param boxMin : min corner by axis
+         * @param boxMax : max corner by axis
+         * @param tEnter, tExit, enterFace, exitFace : outputs, faces are stored as TType
+         */
+        template <typename TPacket, typename TPacketType = typename TPacket::Type>
+        [[nodiscard]] static inline
+        unsigned int hitMask (const TPacketType (&origin)[3], const TPacketType (&inverseDirection)[3], const TPacketType (&boxMin)[3], const TPacketType (&boxMax)[3],
+                              TPacketType& tEnter, TPacketType& tExit, TPacketType& enterFace, TPacketType& exitFace) noexcept;
+
+        /**
+         * @brief Store the laneCount first lanes in hits
+         */
+        static inline
+        void storeHits (unsigned int mask, PacketType tEnter, PacketType tExit, PacketType enterFace, PacketType exitFace, size_t laneCount, SlabHit<TType>* hits) noexcept;
+
+        #pragma endregion //!static methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        SegmentSlabTest ()					                        = delete;
+        SegmentSlabTest (const SegmentSlabTest& other)			    = delete;
+        SegmentSlabTest (SegmentSlabTest&& other)				    = delete;
+        ~SegmentSlabTest ()				                            = delete;
+        SegmentSlabTest& operator=(SegmentSlabTest const& other)    = delete;
+        SegmentSlabTest& operator=(SegmentSlabTest && other)		= delete;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region static methods
+
+        /**
+         * @brief Outward normal of the face index of SlabHit
+         */
+        [[nodiscard]] static inline
+        Vector3<TType> getFaceNormal (unsigned char face) noexcept;
+
+        /**
+         * @brief Slab test of the segment [pt1, pt2] against box
+         * 
+         * @return true if the segment touch the box
+         */
+        static inline
+        bool intersect (const Vector3<TType>& pt1, const Vector3<TType>& pt2, const BoundingBox3<TType>& box, SlabHit<TType>& hit) noexcept;
+
+        /**
+         * @brief Test each segment of segments against box, Packet::size segments at once. Big batches are split across the threads of the pool
+         * 
+         * @param segments 
+         * @param box 
+         * @param hits : segments.size() results
+         * @param pool 
+         */
+        static inline
+        void intersect (const SegmentBatch<TType>& segments, const BoundingBox3<TType>& box, SlabHit<TType>* hits, ThreadPool& pool = getGlobalThreadPool()) noexcept;
+
+        /**
+         * @brief Test the segment [pt1, pt2] against each box of boxes, Packet::size boxes at once. Big batches are split across the threads of the pool
+         * 
+         * @param pt1 
+         * @param pt2 
+         * @param boxes 
+         * @param hits : boxes.size() results
+         * @param pool 
+         */
+        static inline
+        void intersect (const Vector3<TType>& pt1, const Vector3<TType>& pt2, const BoundingBoxBatch<TType>& boxes, SlabHit<TType>* hits, ThreadPool& pool = getGlobalThreadPool()) noexcept;
+
+        /**
+         * @brief Fill an intersection with the points and the face normals of hit, in the form of the ShapeRelation intersections :
+         * two points if the segment cross the box, one point if pt1 or pt2 is inside, infinite if the segment is inside the box.
+         * 
+         * @tparam TIntersection : type with setOneIntersection, setTwoIntersection, setInifitIntersection, normalI1 and normalI2
+         * @return true if hit is a hit
+         */
+        template <typename TIntersection>
+        static inline
+        bool fillIntersection (const SlabHit<TType>& hit, const Vector3<TType>& pt1, const Vector3<TType>& pt2, TIntersection& intersection) noexcept;
+
+        #pragma endregion //!static methods
+    };
+
+    #include "SegmentSlabTest.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,260 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 21 h 45
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+template <typename TPacket, typename TPacketType>
+inline
+unsigned int SegmentSlabTest<TType>::hitMask (const TPacketType (&origin)[3], const TPacketType (&inverseDirection)[3], const TPacketType (&boxMin)[3], const TPacketType (&boxMax)[3],
+                                              TPacketType& tEnter, TPacketType& tExit, TPacketType& enterFace, TPacketType& exitFace) noexcept
+{
+    const TPacketType zero = TPacket::set1(static_cast<TType>(0));
+    const TPacketType one  = TPacket::set1(static_cast<TType>(1));
+
+    TPacketType tNear[3];
+    TPacketType tFar[3];
+    TPacketType axisEnterFace[3];
+    TPacketType axisExitFace[3];
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const TPacketType t1 = TPacket::mul(TPacket::sub(boxMin[axis], origin[axis]), inverseDirection[axis]);
+        const TPacketType t2 = TPacket::mul(TPacket::sub(boxMax[axis], origin[axis]), inverseDirection[axis]);
+        tNear[axis] = TPacket::min(t1, t2);
+        tFar[axis]  = TPacket::max(t1, t2);
+
+        /*A segment going toward +axis enter by the min face (-axis) and exit by the max face (+axis)*/
+        const TPacketType positiveFace = TPacket::set1(static_cast<TType>(2 * axis));
+        const TPacketType negativeFace = TPacket::set1(static_cast<TType>(2 * axis + 1));
+        axisEnterFace[axis] = TPacket::selectIfLess(inverseDirection[axis], zero, positiveFace, negativeFace);
+        axisExitFace[axis]  = TPacket::selectIfLess(inverseDirection[axis], zero, negativeFace, positiveFace);
+    }
+
+    /*Enter at the greatest near parameter and exit at the smallest far parameter*/
+    tEnter    = tNear[0];
+    tExit     = tFar[0];
+    enterFace = axisEnterFace[0];
+    exitFace  = axisExitFace[0];
+
+    for (size_t axis = 1; axis < 3; ++axis)
+    {
+        enterFace = TPacket::selectIfLess(tEnter, tNear[axis], axisEnterFace[axis], enterFace);
+        exitFace  = TPacket::selectIfLess(tFar[axis], tExit, axisExitFace[axis], exitFace);
+        tEnter    = TPacket::max(tEnter, tNear[axis]);
+        tExit     = TPacket::min(tExit, tFar[axis]);
+    }
+
+    return TPacket::lessEqualMask(tEnter, tExit) & TPacket::lessEqualMask(tEnter, one) & TPacket::lessEqualMask(zero, tExit);
+}
+
+template <typename TType>
+inline
+void SegmentSlabTest<TType>::storeHits (unsigned int mask, PacketType tEnter, PacketType tExit, PacketType enterFace, PacketType exitFace, size_t laneCount, SlabHit<TType>* hits) noexcept
+{
+    alignas(64) TType tEnterLanes[Packet::size];
+    alignas(64) TType tExitLanes[Packet::size];
+    alignas(64) TType enterFaceLanes[Packet::size];
+    alignas(64) TType exitFaceLanes[Packet::size];
+
+    Packet::store(tEnterLanes, tEnter);
+    Packet::store(tExitLanes, tExit);
+    Packet::store(enterFaceLanes, enterFace);
+    Packet::store(exitFaceLanes, exitFace);
+
+    for (size_t lane = 0; lane < laneCount; ++lane)
+    {
+        SlabHit<TType>& hit = hits[lane];
+
+        hit.tEnter    = tEnterLanes[lane];
+        hit.tExit     = tExitLanes[lane];
+        hit.enterFace = static_cast<unsigned char>(enterFaceLanes[lane]);
+        hit.exitFace  = static_cast<unsigned char>(exitFaceLanes[lane]);
+        hit.isHit     = (mask >> lane) & 1u;
+    }
+}
+
+template <typename TType>
+inline
+Vector3<TType> SegmentSlabTest<TType>::getFaceNormal (unsigned char face) noexcept
+{
+    assert(face < 6 && "Face index out of range");
+
+    const TType sign = (face & 1u) ? static_cast<TType>(-1) : static_cast<TType>(1);
+    Vector3<TType> normal {static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(0)};
+    normal.getData()[face >> 1u] = sign;
+
+    return normal;
+}
+
+template <typename TType>
+inline
+bool SegmentSlabTest<TType>::intersect (const Vector3<TType>& pt1, const Vector3<TType>& pt2, const BoundingBox3<TType>& box, SlabHit<TType>& hit) noexcept
+{
+    TType origin[3];
+    TType inverseDirection[3];
+    TType boxMin[3];
+    TType boxMax[3];
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        origin[axis]           = pt1.getData()[axis];
+        inverseDirection[axis] = SegmentBatch<TType>::getInverseDirection(pt2.getData()[axis] - pt1.getData()[axis]);
+        boxMin[axis]           = box.min.getData()[axis];
+        boxMax[axis]           = box.max.getData()[axis];
+    }
+
+    const TType zero = static_cast<TType>(0);
+    TType enterFace = zero;
+    TType exitFace  = zero;
+
+    /*Same kernel as the packet tests with one lane*/
+    hit.isHit = hitMask<SIMD::ScalarPacket<TType>>(origin, inverseDirection, boxMin, boxMax, hit.tEnter, hit.tExit, enterFace, exitFace);
+    hit.enterFace = static_cast<unsigned char>(enterFace);
+    hit.exitFace  = static_cast<unsigned char>(exitFace);
+
+    return hit.isHit;
+}
+
+template <typename TType>
+inline
+void SegmentSlabTest<TType>::intersect (const SegmentBatch<TType>& segments, const BoundingBox3<TType>& box, SlabHit<TType>* hits, ThreadPool& pool) noexcept
+{
+    using Batch = SegmentBatch<TType>;
+
+    const size_t count       = segments.size();
+    const size_t packetCount = (count + Packet::size - 1) / Packet::size;
+
+    const PacketType boxMin[3] = {Packet::set1(box.min.getX()), Packet::set1(box.min.getY()), Packet::set1(box.min.getZ())};
+    const PacketType boxMax[3] = {Packet::set1(box.max.getX()), Packet::set1(box.max.getY()), Packet::set1(box.max.getZ())};
+
+    pool.parallelFor(packetCount, parallelGrain / Packet::size, [&](size_t begin, size_t end)
+    {
+        for (size_t packet = begin; packet < end; ++packet)
+        {
+            const size_t index = packet * Packet::size;
+
+            PacketType origin[3];
+            PacketType inverseDirection[3];
+
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                origin[axis]           = Packet::load(segments.getStream(Batch::originStream + axis) + index);
+                inverseDirection[axis] = Packet::load(segments.getStream(Batch::inverseDirectionStream + axis) + index);
+            }
+
+            PacketType tEnter, tExit, enterFace, exitFace;
+            const unsigned int mask = hitMask<Packet>(origin, inverseDirection, boxMin, boxMax, tEnter, tExit, enterFace, exitFace);
+
+            storeHits(mask, tEnter, tExit, enterFace, exitFace, std::min(Packet::size, count - index), hits + index);
+        }
+    });
+}
+
+template <typename TType>
+inline
+void SegmentSlabTest<TType>::intersect (const Vector3<TType>& pt1, const Vector3<TType>& pt2, const BoundingBoxBatch<TType>& boxes, SlabHit<TType>* hits, ThreadPool& pool) noexcept
+{
+    using Batch = BoundingBoxBatch<TType>;
+
+    const size_t count       = boxes.size();
+    const size_t packetCount = (count + Packet::size - 1) / Packet::size;
+
+    PacketType origin[3];
+    PacketType inverseDirection[3];
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        origin[axis]           = Packet::set1(pt1.getData()[axis]);
+        inverseDirection[axis] = Packet::set1(SegmentBatch<TType>::getInverseDirection(pt2.getData()[axis] - pt1.getData()[axis]));
+    }
+
+    pool.parallelFor(packetCount, parallelGrain / Packet::size, [&](size_t begin, size_t end)
+    {
+        for (size_t packet = begin; packet < end; ++packet)
+        {
+            const size_t index = packet * Packet::size;
+
+            PacketType boxMin[3];
+            PacketType boxMax[3];
+
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                boxMin[axis] = Packet::load(boxes.getStream(Batch::minStream + axis) + index);
+                boxMax[axis] = Packet::load(boxes.getStream(Batch::maxStream + axis) + index);
+            }
+
+            PacketType tEnter, tExit, enterFace, exitFace;
+            const unsigned int mask = hitMask<Packet>(origin, inverseDirection, boxMin, boxMax, tEnter, tExit, enterFace, exitFace);
+
+            storeHits(mask, tEnter, tExit, enterFace, exitFace, std::min(Packet::size, count - index), hits + index);
+        }
+    });
+}
+
+template <typename TType>
+template <typename TIntersection>
+inline
+bool SegmentSlabTest<TType>::fillIntersection (const SlabHit<TType>& hit, const Vector3<TType>& pt1, const Vector3<TType>& pt2, TIntersection& intersection) noexcept
+{
+    if (!hit.isHit)
+    {
+        intersection.setNotIntersection();
+        return false;
+    }
+
+    const TType zero = static_cast<TType>(0);
+    const TType one  = static_cast<TType>(1);
+    const Vector3<TType> direction = pt2 - pt1;
+    const bool isEnterOnSegment = hit.tEnter >= zero;
+    const bool isExitOnSegment  = hit.tExit <= one;
+
+    if (isEnterOnSegment && isExitOnSegment)
+    {
+        intersection.setTwoIntersection(pt1 + direction * hit.tEnter, pt1 + direction * hit.tExit);
+        intersection.normalI1 = getFaceNormal(hit.enterFace);
+        intersection.normalI2 = getFaceNormal(hit.exitFace);
+    }
+    else if (isEnterOnSegment)
+    {
+        intersection.setOneIntersection(pt1 + direction * hit.tEnter);
+        intersection.normalI1 = getFaceNormal(hit.enterFace);
+    }
+    else if (isExitOnSegment)
+    {
+        intersection.setOneIntersection(pt1 + direction * hit.tExit);
+        intersection.normalI1 = getFaceNormal(hit.exitFace);
+    }
+    else
+    {
+        intersection.setInifitIntersection();
+    }
+
+    return true;
+}
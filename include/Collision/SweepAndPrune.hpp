@@ -0,0 +1,255 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Collision/BoundingBox3.hpp" //BoundingBox3
+#include "Vector/VectorBatch.hpp" //VectorBatch
+#include "Numeric/SIMD.hpp" //SIMD::Packet
+#include "Thread/ThreadPool.hpp" //ThreadPool, getGlobalThreadPool
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <vector> //std::vector
+#include <limits> //std::numeric_limits
+#include <algorithm> //std::sort, std::set_difference
+#include <iterator> //std::back_inserter
+#include <assert.h> //assert
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, typename TUserData = size_t, IsArithmetic<TType> = true>
+    class SweepAndPrune;
+
+    /**
+     * @brief Sweep and prune broad phase for scenes with high temporal coherence. Proxies are kept sorted by the min of their box along the sweep axis
+     * with an insertion sort : when boxes move a little between two updates, sorting cost a few swaps by proxy.
+     * Bounds are then copied in sorted order in structure of arrays and each box is swept against the next boxes while they overlap on the sweep axis.
+     * The two remaining axes are tested on Packet::size boxes at once (SIMD::Packet).
+     * update report the pairs that start and stop overlapping since the previous update instead of the whole pair list.
+     * @note Only the sweep axis keep an endpoint array : overlaps on the other axes are tested by SIMD in the sweep, which is cheaper than maintaining two more
+     * sorted arrays and their pair counters. Choose the axis where boxes are the most spread with setSweepAxis or chooseSweepAxis.
+     * @example
+     * `SweepAndPrune<float> sap;`
+     * `size_t proxy = sap.insert(box, shapeIndex);`
+     * `sap.setBox(proxy, newBox);`
+     * `sap.update(addedPairs, removedPairs);`
+     * 
+     * @tparam TType 
+     * @tparam TUserData : copiable and default constructible data associated to each proxy
+     */
+    template <typename TType, typename TUserData>
+    class SweepAndPrune<TType, TUserData>
+    {
+        public:
+
+        /**
+         * @brief Pair of proxy ids with first < second
+         */
+        struct Pair
+        {
+            size_t first;
+            size_t second;
+
+            [[nodiscard]] inline
+            bool operator< (const Pair& other) const noexcept { return (first < other.first) || (first == other.first && second < other.second); }
+
+            [[nodiscard]] inline
+            bool operator== (const Pair& other) const noexcept { return first == other.first && second == other.second; }
+        };
+
+        private:
+
+        using Packet = SIMD::Packet<TType>;
+        using PacketType = typename Packet::Type;
+
+        /**
+         * @brief Number of sorted boxes swept by task
+         */
+        static constexpr size_t sweepChunkSize = 1024;
+        static constexpr size_t sweepParallelGrain = 4;
+
+        protected:
+
+        struct Proxy
+        {
+            BoundingBox3<TType> box {};
+            TUserData           userData {};
+            bool                isAlive {false};
+        };
+
+        /**
+         * @brief Min of a proxy box along the sweep axis
+         */
+        struct Endpoint
+        {
+            TType   value;
+            size_t  proxy;
+        };
+
+        #pragma region attribut
+
+        std::vector<Proxy>              m_proxies       {};
+        std::vector<size_t>             m_freeProxies   {};
+        std::vector<size_t>             m_removedProxies{}; /*Freed after the next update : their pairs must be reported as removed first*/
+        std::vector<Endpoint>           m_endpoints     {};
+        VectorBatch<3, TType>           m_sortedMins    {};
+        VectorBatch<3, TType>           m_sortedMaxs    {};
+        std::vector<std::vector<Pair>>  m_chunkPairs    {};
+        std::vector<Pair>               m_pairs         {};
+        std::vector<Pair>               m_previousPairs {};
+        size_t                          m_insertedCount {0}; /*Proxies inserted since the last update*/
+        size_t                          m_proxyCount    {0};
+        size_t                          m_sweepAxis;
+        bool                            m_isFullSortNeeded {false};
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        /**
+         * @brief Refresh endpoint values, drop removed proxies and sort endpoints. Insertion sort is used unless many proxies were inserted
+         */
+        inline
+        void sortEndpoints ();
+
+        /**
+         * @brief Copy the bounds in sorted order. Streams are padded with empty boxes (min = +inf, max = -inf) for unaligned loads of the last boxes
+         */
+        inline
+        void gatherSortedBounds ();
+
+        /**
+         * @brief Append the overlapping pairs of sorted boxes [begin, end) with the next boxes to pairs
+         */
+        inline
+        void sweep (size_t begin, size_t end, std::vector<Pair>& pairs) const;
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Construct a new empty sweep and prune
+         * 
+         * @param sweepAxis : 0 for X, 1 for Y and 2 for Z
+         */
+        explicit SweepAndPrune (size_t sweepAxis = 0) noexcept;
+
+        SweepAndPrune (const SweepAndPrune& other)			    = default;
+        SweepAndPrune (SweepAndPrune&& other)				    = default;
+        ~SweepAndPrune ()				                        = default;
+        SweepAndPrune& operator=(SweepAndPrune const& other)    = default;
+        SweepAndPrune& operator=(SweepAndPrune && other)	    = default;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Insert a proxy and return its id. Its pairs are reported as added by the next update
+         */
+        inline
+        size_t insert (const BoundingBox3<TType>& box, const TUserData& userData);
+
+        /**
+         * @brief Remove the proxy. Its pairs are reported as removed by the next update, then its id can be reused
+         */
+        inline
+        void remove (size_t proxy);
+
+        /**
+         * @brief Sort the proxies, find the overlapping pairs and report the differences with the previous update. Sorted boxes are swept in chunks by the workers of pool
+         * 
+         * @param addedPairs : cleared then filled with pairs that start overlapping, sorted
+         * @param removedPairs : cleared then filled with pairs that stop overlapping or lost a proxy, sorted
+         * @param pool 
+         */
+        inline
+        void update (std::vector<Pair>& addedPairs, std::vector<Pair>& removedPairs, ThreadPool& pool = getGlobalThreadPool());
+
+        /**
+         * @brief Set the sweep axis to the axis with the largest variance of box centers
+         */
+        inline
+        void chooseSweepAxis () noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        /**
+         * @brief Overlapping pairs found by the last update, sorted
+         */
+        [[nodiscard]] inline
+        const std::vector<Pair>& getPairs () const noexcept;
+
+        [[nodiscard]] inline
+        const BoundingBox3<TType>& getBox (size_t proxy) const noexcept;
+
+        /**
+         * @brief User data of the proxy. Still valid for a removed proxy until the next insert, to process removed pairs
+         */
+        [[nodiscard]] inline
+        const TUserData& getUserData (size_t proxy) const noexcept;
+
+        [[nodiscard]] inline
+        size_t getProxyCount () const noexcept;
+
+        [[nodiscard]] inline
+        size_t getSweepAxis () const noexcept;
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        /**
+         * @brief Set the box of the proxy. Sorting and pair finding are done by the next update
+         */
+        inline
+        void setBox (size_t proxy, const BoundingBox3<TType>& box) noexcept;
+
+        inline
+        void setUserData (size_t proxy, const TUserData& userData) noexcept;
+
+        /**
+         * @brief Set the sweep axis. The next update sort all proxies
+         */
+        inline
+        void setSweepAxis (size_t sweepAxis) noexcept;
+
+        #pragma endregion //!mutator
+    };
+
+    #include "SweepAndPrune.inl"
+
+} /*namespace FoxMath*/
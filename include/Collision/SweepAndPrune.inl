@@ -0,0 +1,350 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType, typename TUserData>
+inline
+void SweepAndPrune<TType, TUserData>::sortEndpoints ()
+{
+    /*Refresh values in sorted order and drop removed proxies*/
+    size_t count = 0;
+    for (const Endpoint& endpoint : m_endpoints)
+    {
+        const Proxy& proxy = m_proxies[endpoint.proxy];
+
+        if (proxy.isAlive)
+            m_endpoints[count++] = Endpoint{proxy.box.min.getData()[m_sweepAxis], endpoint.proxy};
+    }
+    m_endpoints.resize(count);
+
+    /*Insertion sort cost one swap by crossing of endpoints : new proxies appended at the end would cross most of them*/
+    if (m_isFullSortNeeded || m_insertedCount * 8 > count)
+    {
+        std::sort(m_endpoints.begin(), m_endpoints.end(), [](const Endpoint& lhs, const Endpoint& rhs) noexcept { return lhs.value < rhs.value; });
+    }
+    else
+    {
+        for (size_t i = 1; i < count; ++i)
+        {
+            const Endpoint endpoint = m_endpoints[i];
+            size_t j = i;
+
+            for (; j > 0 && endpoint.value < m_endpoints[j - 1].value; --j)
+            {
+                m_endpoints[j] = m_endpoints[j - 1];
+            }
+
+            m_endpoints[j] = endpoint;
+        }
+    }
+
+    m_insertedCount     = 0;
+    m_isFullSortNeeded  = false;
+}
+
+template <typename TType, typename TUserData>
+inline
+void SweepAndPrune<TType, TUserData>::gatherSortedBounds ()
+{
+    const size_t count       = m_endpoints.size();
+    const size_t paddedCount = count + Packet::size;
+
+    if (m_sortedMins.size() != paddedCount)
+    {
+        m_sortedMins.resize(paddedCount);
+        m_sortedMaxs.resize(paddedCount);
+    }
+
+    constexpr TType emptyMin = std::numeric_limits<TType>::has_infinity ? std::numeric_limits<TType>::infinity() : std::numeric_limits<TType>::max();
+    constexpr TType emptyMax = std::numeric_limits<TType>::has_infinity ? -std::numeric_limits<TType>::infinity() : std::numeric_limits<TType>::lowest();
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        TType* mins = m_sortedMins.getStream(axis);
+        TType* maxs = m_sortedMaxs.getStream(axis);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const BoundingBox3<TType>& box = m_proxies[m_endpoints[i].proxy].box;
+            mins[i] = box.min.getData()[axis];
+            maxs[i] = box.max.getData()[axis];
+        }
+
+        for (size_t i = count; i < paddedCount; ++i)
+        {
+            mins[i] = emptyMin;
+            maxs[i] = emptyMax;
+        }
+    }
+}
+
+template <typename TType, typename TUserData>
+inline
+void SweepAndPrune<TType, TUserData>::sweep (size_t begin, size_t end, std::vector<Pair>& pairs) const
+{
+    const size_t axisB = (m_sweepAxis + 1) % 3;
+    const size_t axisC = (m_sweepAxis + 2) % 3;
+
+    const TType* minA = m_sortedMins.getStream(m_sweepAxis);
+    const TType* maxA = m_sortedMaxs.getStream(m_sweepAxis);
+    const TType* minB = m_sortedMins.getStream(axisB);
+    const TType* maxB = m_sortedMaxs.getStream(axisB);
+    const TType* minC = m_sortedMins.getStream(axisC);
+    const TType* maxC = m_sortedMaxs.getStream(axisC);
+
+    constexpr unsigned int fullMask = (1u << Packet::size) - 1u;
+    const size_t count = m_endpoints.size();
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        const PacketType maxAi = Packet::set1(maxA[i]);
+        const PacketType minBi = Packet::set1(minB[i]);
+        const PacketType maxBi = Packet::set1(maxB[i]);
+        const PacketType minCi = Packet::set1(minC[i]);
+        const PacketType maxCi = Packet::set1(maxC[i]);
+
+        /*Next boxes have a greater min on the sweep axis : they overlap on this axis while their min is under the max of box i.
+          Lanes after the last box are masked : padding boxes would pass the test of a box with an infinite max*/
+        for (size_t j = i + 1; j < count; j += Packet::size)
+        {
+            const unsigned int validMask = (count - j < Packet::size) ? (1u << (count - j)) - 1u : fullMask;
+            const unsigned int sweepMask = Packet::lessEqualMask(Packet::loadUnaligned(minA + j), maxAi) & validMask;
+
+            unsigned int overlapMask = sweepMask &
+                                       Packet::lessEqualMask(Packet::loadUnaligned(minB + j), maxBi) & Packet::lessEqualMask(minBi, Packet::loadUnaligned(maxB + j)) &
+                                       Packet::lessEqualMask(Packet::loadUnaligned(minC + j), maxCi) & Packet::lessEqualMask(minCi, Packet::loadUnaligned(maxC + j));
+
+            for (size_t lane = 0; overlapMask != 0; ++lane, overlapMask >>= 1)
+            {
+                if (overlapMask & 1u)
+                {
+                    const size_t proxy1 = m_endpoints[i].proxy;
+                    const size_t proxy2 = m_endpoints[j + lane].proxy;
+                    pairs.push_back(Pair{std::min(proxy1, proxy2), std::max(proxy1, proxy2)});
+                }
+            }
+
+            if (sweepMask != fullMask)
+                break;
+        }
+    }
+}
+
+template <typename TType, typename TUserData>
+SweepAndPrune<TType, TUserData>::SweepAndPrune (size_t sweepAxis) noexcept
+    :   m_sweepAxis {sweepAxis}
+{
+    assert(sweepAxis < 3 && "Sweep axis must be 0 (X), 1 (Y) or 2 (Z)");
+}
+
+template <typename TType, typename TUserData>
+inline
+size_t SweepAndPrune<TType, TUserData>::insert (const BoundingBox3<TType>& box, const TUserData& userData)
+{
+    size_t proxy;
+
+    if (m_freeProxies.empty())
+    {
+        proxy = m_proxies.size();
+        m_proxies.emplace_back();
+    }
+    else
+    {
+        proxy = m_freeProxies.back();
+        m_freeProxies.pop_back();
+    }
+
+    m_proxies[proxy] = Proxy{box, userData, true};
+    m_endpoints.push_back(Endpoint{box.min.getData()[m_sweepAxis], proxy});
+    ++m_insertedCount;
+    ++m_proxyCount;
+
+    return proxy;
+}
+
+template <typename TType, typename TUserData>
+inline
+void SweepAndPrune<TType, TUserData>::remove (size_t proxy)
+{
+    assert(proxy < m_proxies.size() && m_proxies[proxy].isAlive && "Proxy is not in the sweep and prune");
+
+    m_proxies[proxy].isAlive = false;
+    m_removedProxies.push_back(proxy);
+    --m_proxyCount;
+}
+
+template <typename TType, typename TUserData>
+inline
+void SweepAndPrune<TType, TUserData>::update (std::vector<Pair>& addedPairs, std::vector<Pair>& removedPairs, ThreadPool& pool)
+{
+    sortEndpoints();
+    gatherSortedBounds();
+
+    const size_t count      = m_endpoints.size();
+    const size_t chunkCount = (count + sweepChunkSize - 1) / sweepChunkSize;
+
+    if (m_chunkPairs.size() < chunkCount)
+        m_chunkPairs.resize(chunkCount);
+
+    /*Each task write in its own chunk : proxies and streams are read only during the sweep*/
+    pool.parallelFor(chunkCount, sweepParallelGrain, [&](size_t chunkBegin, size_t chunkEnd)
+    {
+        for (size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk)
+        {
+            m_chunkPairs[chunk].clear();
+            sweep(chunk * sweepChunkSize, std::min(count, (chunk + 1) * sweepChunkSize), m_chunkPairs[chunk]);
+        }
+    });
+
+    std::swap(m_pairs, m_previousPairs);
+    m_pairs.clear();
+
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        m_pairs.insert(m_pairs.end(), m_chunkPairs[chunk].begin(), m_chunkPairs[chunk].end());
+
+    std::sort(m_pairs.begin(), m_pairs.end());
+
+    addedPairs.clear();
+    removedPairs.clear();
+    std::set_difference(m_pairs.begin(), m_pairs.end(), m_previousPairs.begin(), m_previousPairs.end(), std::back_inserter(addedPairs));
+    std::set_difference(m_previousPairs.begin(), m_previousPairs.end(), m_pairs.begin(), m_pairs.end(), std::back_inserter(removedPairs));
+
+    /*Pairs of removed proxies are reported : their ids can be reused*/
+    m_freeProxies.insert(m_freeProxies.end(), m_removedProxies.begin(), m_removedProxies.end());
+    m_removedProxies.clear();
+}
+
+template <typename TType, typename TUserData>
+inline
+void SweepAndPrune<TType, TUserData>::chooseSweepAxis () noexcept
+{
+    if (m_proxyCount == 0)
+        return;
+
+    TType sum[3]        = {};
+    TType squareSum[3]  = {};
+
+    for (const Proxy& proxy : m_proxies)
+    {
+        if (!proxy.isAlive)
+            continue;
+
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const TType center = (proxy.box.min.getData()[axis] + proxy.box.max.getData()[axis]) / static_cast<TType>(2);
+            sum[axis]       += center;
+            squareSum[axis] += center * center;
+        }
+    }
+
+    /*count * variance = sum(x²) - sum(x)² / count*/
+    const TType count = static_cast<TType>(m_proxyCount);
+    size_t bestAxis = 0;
+    TType bestVariance = std::numeric_limits<TType>::lowest();
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const TType variance = squareSum[axis] - sum[axis] * sum[axis] / count;
+
+        if (variance > bestVariance)
+        {
+            bestVariance = variance;
+            bestAxis = axis;
+        }
+    }
+
+    setSweepAxis(bestAxis);
+}
+
+template <typename TType, typename TUserData>
+inline
+const std::vector<typename SweepAndPrune<TType, TUserData>::Pair>& SweepAndPrune<TType, TUserData>::getPairs () const noexcept
+{
+    return m_pairs;
+}
+
+template <typename TType, typename TUserData>
+inline
+const BoundingBox3<TType>& SweepAndPrune<TType, TUserData>::getBox (size_t proxy) const noexcept
+{
+    assert(proxy < m_proxies.size() && m_proxies[proxy].isAlive && "Proxy is not in the sweep and prune");
+    return m_proxies[proxy].box;
+}
+
+template <typename TType, typename TUserData>
+inline
+const TUserData& SweepAndPrune<TType, TUserData>::getUserData (size_t proxy) const noexcept
+{
+    assert(proxy < m_proxies.size() && "Proxy is not in the sweep and prune");
+    return m_proxies[proxy].userData;
+}
+
+template <typename TType, typename TUserData>
+inline
+size_t SweepAndPrune<TType, TUserData>::getProxyCount () const noexcept
+{
+    return m_proxyCount;
+}
+
+template <typename TType, typename TUserData>
+inline
+size_t SweepAndPrune<TType, TUserData>::getSweepAxis () const noexcept
+{
+    return m_sweepAxis;
+}
+
+template <typename TType, typename TUserData>
+inline
+void SweepAndPrune<TType, TUserData>::setBox (size_t proxy, const BoundingBox3<TType>& box) noexcept
+{
+    assert(proxy < m_proxies.size() && m_proxies[proxy].isAlive && "Proxy is not in the sweep and prune");
+    m_proxies[proxy].box = box;
+}
+
+template <typename TType, typename TUserData>
+inline
+void SweepAndPrune<TType, TUserData>::setUserData (size_t proxy, const TUserData& userData) noexcept
+{
+    assert(proxy < m_proxies.size() && m_proxies[proxy].isAlive && "Proxy is not in the sweep and prune");
+    m_proxies[proxy].userData = userData;
+}
+
+template <typename TType, typename TUserData>
+inline
+void SweepAndPrune<TType, TUserData>::setSweepAxis (size_t sweepAxis) noexcept
+{
+    assert(sweepAxis < 3 && "Sweep axis must be 0 (X), 1 (Y) or 2 (Z)");
+
+    if (sweepAxis != m_sweepAxis)
+    {
+        m_sweepAxis         = sweepAxis;
+        m_isFullSortNeeded  = true;
+    }
+}
@@ -0,0 +1,497 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 12 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Matrix/DynamicMatrixView.hpp" //DynamicMatrixView
+#include "Matrix/EMatrixConvention.hpp" //EMatrixConvention
+#include "Matrix/MatrixKernel.hpp" //MatrixKernel::multiply
+#include "Vector/DynamicVector.hpp" //DynamicVector, DynamicVectorView
+#include "Memory/AlignedAllocator.hpp" //AlignedAllocator
+#include "Memory/ArenaAllocator.hpp" //ArenaAllocator
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+#include "Types/Implicit.hpp" //implicit
+
+#include <vector> //std::vector
+#include <stddef.h> //sizt_t
+#include <iostream> //ostream
+#include <type_traits> //std::is_same_v, std::remove_const_t
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor, typename TAllocator = AlignedAllocator<TType>,
+                IsArithmetic<TType> = true>
+    class DynamicMatrix;
+
+    /**
+     * @brief Matrix with runtime size stored on the heap. Used for solver and regression workloads where the dimension is unknown at compile time.
+     * Storage is aligned by the allocator (64 bytes by default) and ordered vector by vector in function of the matrix convention, like GenericMatrix.
+     * Use ArenaAllocator for per frame scratch matrix.
+     * @note Size mismatch between operands is checked with assert
+     * @example `FoxMath::DynamicMatrix<float> normal = A.getTransposed() * A;`
+     * 
+     * @tparam TType 
+     * @tparam TMatrixConvention 
+     * @tparam TAllocator 
+     */
+    template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+    class DynamicMatrix<TType, TMatrixConvention, TAllocator>
+    {
+        public:
+
+        using View      = DynamicMatrixView<TType, TMatrixConvention>;
+        using ConstView = DynamicMatrixView<const TType, TMatrixConvention>;
+        using Vector    = DynamicVector<TType, TAllocator>;
+
+        protected:
+
+        #pragma region attribut
+
+        std::vector<TType, TAllocator>  m_data;
+        size_t                          m_rowSize       {0};
+        size_t                          m_columnSize    {0};
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region static attribut
+
+        [[nodiscard]] static inline constexpr
+		EMatrixConvention 	    getMatrixConvention	() noexcept
+        {   
+            return TMatrixConvention;
+        }
+
+        /**
+         * @brief return matrix init with zero
+         * 
+         * @param rowSize 
+         * @param columnSize 
+         * @param allocator 
+         * @return DynamicMatrix 
+         */
+        [[nodiscard]] static inline
+        DynamicMatrix zero (size_t rowSize, size_t columnSize, const TAllocator& allocator = TAllocator())
+        {
+            return DynamicMatrix(rowSize, columnSize, allocator);
+        }
+
+        /**
+         * @brief return identity matrix of size * size
+         * 
+         * @param size 
+         * @param allocator 
+         * @return DynamicMatrix 
+         */
+        [[nodiscard]] static inline
+        DynamicMatrix identity (size_t size, const TAllocator& allocator = TAllocator());
+
+        #pragma endregion //! static attribut
+
+        #pragma region constructor/destructor
+
+        inline
+        DynamicMatrix ()                                                = default;
+
+        inline
+        DynamicMatrix (const DynamicMatrix& other)                      = default;
+
+        inline
+        DynamicMatrix (DynamicMatrix&& other) noexcept                  = default;
+
+        inline
+        ~DynamicMatrix ()                                               = default;
+
+        inline
+        DynamicMatrix& operator=(const DynamicMatrix& other)            = default;
+
+        inline
+        DynamicMatrix& operator=(DynamicMatrix&& other) noexcept        = default;
+
+        /**
+         * @brief Construct matrix of rowSize * columnSize elements init to zero
+         * 
+         * @param rowSize 
+         * @param columnSize 
+         * @param allocator 
+         */
+        inline
+        DynamicMatrix (size_t rowSize, size_t columnSize, const TAllocator& allocator = TAllocator());
+
+        /**
+         * @brief Construct matrix of rowSize * columnSize elements init to scalar
+         * 
+         * @param rowSize 
+         * @param columnSize 
+         * @param scalar 
+         * @param allocator 
+         */
+        inline
+        DynamicMatrix (size_t rowSize, size_t columnSize, TType scalar, const TAllocator& allocator = TAllocator());
+
+        /**
+         * @brief Copy viewed data (GenericMatrix, DynamicMatrixView...)
+         * 
+         * @param other 
+         * @param allocator 
+         */
+        explicit inline
+        DynamicMatrix (ConstView other, const TAllocator& allocator = TAllocator());
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Resize the matrix. All elements are reset to zero
+         * 
+         * @param rowSize 
+         * @param columnSize 
+         * @return DynamicMatrix& 
+         */
+        inline
+        DynamicMatrix& resize (size_t rowSize, size_t columnSize);
+
+        inline
+        DynamicMatrix& fill (TType scalar) noexcept;
+
+        [[nodiscard]] inline
+        DynamicMatrix getTransposed () const;
+
+        [[nodiscard]] inline
+        size_t vectorLength () const noexcept
+        {
+            return getView().vectorLength();
+        }
+
+        [[nodiscard]] inline
+        size_t numberOfInternalVector () const noexcept
+        {
+            return getView().numberOfInternalVector();
+        }
+
+        [[nodiscard]] inline
+        size_t numberOfData () const noexcept
+        {
+            return m_data.size();
+        }
+
+        [[nodiscard]] inline
+        bool isSquare () const noexcept
+        {
+            return m_rowSize == m_columnSize;
+        }
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        size_t getRowSize () const noexcept
+        {
+            return m_rowSize;
+        }
+
+        [[nodiscard]] inline
+        size_t getColumnSize () const noexcept
+        {
+            return m_columnSize;
+        }
+
+        /**
+         * @brief Returns a pointer to the flat storage. Data are ordered vector by vector in function of the matrix convention.
+         * 
+         * @return TType* 
+         */
+        [[nodiscard]] inline
+        TType* getData () noexcept
+        {
+            return m_data.data();
+        }
+
+        [[nodiscard]] inline
+        const TType* getData () const noexcept
+        {
+            return m_data.data();
+        }
+
+        [[nodiscard]] inline
+        TType& getData (size_t index) noexcept
+        {
+            assert(index < m_data.size());
+            return m_data[index];
+        }
+
+        [[nodiscard]] inline
+        const TType& getData (size_t index) const noexcept
+        {
+            assert(index < m_data.size());
+            return m_data[index];
+        }
+
+        /**
+         * @brief Returns a reference to the data j of the internal vector i (row i in row major, column i in column major)
+         * 
+         * @param i 
+         * @param j 
+         * @return TType& 
+         */
+        [[nodiscard]] inline
+        TType& getData (size_t i, size_t j) noexcept
+        {
+            return getData(i * vectorLength() + j);
+        }
+
+        [[nodiscard]] inline
+        const TType& getData (size_t i, size_t j) const noexcept
+        {
+            return getData(i * vectorLength() + j);
+        }
+
+        [[nodiscard]] inline
+        const TType& getDataAt (size_t index) const
+        {
+            return getView().getDataAt(index);
+        }
+
+        [[nodiscard]] inline
+        TAllocator getAllocator () const noexcept
+        {
+            return m_data.get_allocator();
+        }
+
+        [[nodiscard]] inline
+        View getView () noexcept
+        {
+            return View(m_data.data(), m_rowSize, m_columnSize);
+        }
+
+        [[nodiscard]] inline
+        ConstView getView () const noexcept
+        {
+            return ConstView(m_data.data(), m_rowSize, m_columnSize);
+        }
+
+        #pragma endregion //!accessor
+
+        #pragma region operator
+        #pragma region convertor
+
+        implicit inline
+        operator View () noexcept
+        {
+            return getView();
+        }
+
+        implicit inline
+        operator ConstView () const noexcept
+        {
+            return getView();
+        }
+
+        #pragma endregion //!convertor
+        #pragma region assignment operators
+
+        /**
+         * @brief Copy viewed data. Matrix is resized to the size of other
+         * 
+         * @param other 
+         * @return DynamicMatrix& 
+         */
+        inline
+        DynamicMatrix& operator=(ConstView other);
+
+        inline
+        DynamicMatrix& operator+=(ConstView other) noexcept;
+
+        inline
+        DynamicMatrix& operator-=(ConstView other) noexcept;
+
+        inline
+        DynamicMatrix& operator*=(TType scalar) noexcept;
+
+        /**
+         * @brief Matrix product. lhs column size must be equal to rhs row size
+         * 
+         * @param other 
+         * @return DynamicMatrix& 
+         */
+        inline
+        DynamicMatrix& operator*=(ConstView other);
+
+        inline
+        DynamicMatrix& operator/=(TType scalar) noexcept;
+
+        #pragma endregion //!assignment operators
+        #pragma region arithmetic operators
+
+        /*Hidden friends : operands are converted to view (GenericMatrix, DynamicMatrix...) so they are not template*/
+
+        [[nodiscard]] friend inline
+        DynamicMatrix operator+(DynamicMatrix mat) noexcept
+        {
+            return mat;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicMatrix operator-(DynamicMatrix mat) noexcept
+        {
+            return mat *= static_cast<TType>(-1);
+        }
+
+        [[nodiscard]] friend inline
+        DynamicMatrix operator+(DynamicMatrix lhs, ConstView rhs) noexcept
+        {
+            return lhs += rhs;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicMatrix operator-(DynamicMatrix lhs, ConstView rhs) noexcept
+        {
+            return lhs -= rhs;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicMatrix operator*(DynamicMatrix mat, TType scalar) noexcept
+        {
+            return mat *= scalar;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicMatrix operator*(TType scalar, DynamicMatrix mat) noexcept
+        {
+            return mat *= scalar;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicMatrix operator/(DynamicMatrix mat, TType scalar) noexcept
+        {
+            return mat /= scalar;
+        }
+
+        /**
+         * @brief Matrix product. lhs column size must be equal to rhs row size
+         * 
+         * @param lhs 
+         * @param rhs 
+         * @return DynamicMatrix 
+         */
+        [[nodiscard]] friend inline
+        DynamicMatrix operator*(const DynamicMatrix& lhs, ConstView rhs)
+        {
+            DynamicMatrix rst (lhs.getRowSize(), rhs.getColumnSize(), lhs.getAllocator());
+            multiply(lhs.getView(), rhs, rst.getView());
+            return rst;
+        }
+
+        /**
+         * @brief Matrix vector product. Matrix column size must be equal to vector size
+         * 
+         * @param mat 
+         * @param vec 
+         * @return Vector 
+         */
+        [[nodiscard]] friend inline
+        Vector operator*(const DynamicMatrix& mat, DynamicVectorView<const TType> vec)
+        {
+            Vector rst (mat.getRowSize(), mat.getAllocator());
+            multiply(mat.getView(), vec, rst.getView());
+            return rst;
+        }
+
+        #pragma endregion //!arithmetic operators
+        #pragma region comparison operators
+
+        [[nodiscard]] friend inline
+        bool operator==(const DynamicMatrix& lhs, ConstView rhs) noexcept
+        {
+            return lhs.getView() == rhs;
+        }
+
+        [[nodiscard]] friend inline
+        bool operator!=(const DynamicMatrix& lhs, ConstView rhs) noexcept
+        {
+            return lhs.getView() != rhs;
+        }
+
+        #pragma endregion //!comparison operators
+        #pragma endregion //!operator
+    };
+
+    /**
+     * @brief out = lhs * rhs without allocation. Used to write in preallocated or arena storage
+     * @note out must not alias lhs or rhs
+     * 
+     * @tparam TLhsType : TType or const TType
+     * @tparam TRhsType : TType or const TType
+     * @tparam TType 
+     * @tparam TMatrixConvention 
+     * @param lhs 
+     * @param rhs 
+     * @param out : lhs row size * rhs column size
+     */
+    template <typename TLhsType, typename TRhsType, typename TType, EMatrixConvention TMatrixConvention>
+    inline
+    void multiply (DynamicMatrixView<TLhsType, TMatrixConvention> lhs, DynamicMatrixView<TRhsType, TMatrixConvention> rhs, DynamicMatrixView<TType, TMatrixConvention> out) noexcept;
+
+    /**
+     * @brief out = mat * vec without allocation. Used to write in preallocated or arena storage
+     * @note out must not alias mat or vec
+     * 
+     * @tparam TMatType : TType or const TType
+     * @tparam TVecType : TType or const TType
+     * @tparam TType 
+     * @tparam TMatrixConvention 
+     * @param mat 
+     * @param vec 
+     * @param out : mat row size
+     */
+    template <typename TMatType, typename TVecType, typename TType, EMatrixConvention TMatrixConvention>
+    inline
+    void multiply (DynamicMatrixView<TMatType, TMatrixConvention> mat, DynamicVectorView<TVecType> vec, DynamicVectorView<TType> out) noexcept;
+
+    /**
+     * @brief output stream
+     * 
+     */
+    template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+    inline
+    std::ostream& 	operator<<		(std::ostream& out, const DynamicMatrix<TType, TMatrixConvention, TAllocator>& mat) noexcept
+    {
+        return out << mat.getView();
+    }
+
+    #include "DynamicMatrix.inl"
+
+    template <typename TType = float, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+    using DynamicMatrixArena = DynamicMatrix<TType, TMatrixConvention, ArenaAllocator<TType>>;
+
+} /*namespace FoxMath*/
@@ -0,0 +1,188 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 12 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator> DynamicMatrix<TType, TMatrixConvention, TAllocator>::identity (size_t size, const TAllocator& allocator)
+{
+    DynamicMatrix rst (size, size, allocator);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        rst.getData(i, i) = static_cast<TType>(1);
+    }
+
+    return rst;
+}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>::DynamicMatrix (size_t rowSize, size_t columnSize, const TAllocator& allocator)
+    : m_data (rowSize * columnSize, static_cast<TType>(0), allocator), m_rowSize {rowSize}, m_columnSize {columnSize}
+{}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>::DynamicMatrix (size_t rowSize, size_t columnSize, TType scalar, const TAllocator& allocator)
+    : m_data (rowSize * columnSize, scalar, allocator), m_rowSize {rowSize}, m_columnSize {columnSize}
+{}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>::DynamicMatrix (ConstView other, const TAllocator& allocator)
+    : m_data (other.getData(), other.getData() + other.numberOfData(), allocator), m_rowSize {other.getRowSize()}, m_columnSize {other.getColumnSize()}
+{}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>& DynamicMatrix<TType, TMatrixConvention, TAllocator>::resize (size_t rowSize, size_t columnSize)
+{
+    m_data.assign(rowSize * columnSize, static_cast<TType>(0));
+    m_rowSize       = rowSize;
+    m_columnSize    = columnSize;
+    return *this;
+}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>& DynamicMatrix<TType, TMatrixConvention, TAllocator>::fill (TType scalar) noexcept
+{
+    getView().fill(scalar);
+    return *this;
+}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator> DynamicMatrix<TType, TMatrixConvention, TAllocator>::getTransposed () const
+{
+    DynamicMatrix rst (m_columnSize, m_rowSize, getAllocator());
+
+    for (size_t i = 0; i < numberOfInternalVector(); i++)
+    {
+        for (size_t j = 0; j < vectorLength(); j++)
+        {
+            rst.getData(j, i) = getData(i, j);
+        }
+    }
+
+    return rst;
+}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>& DynamicMatrix<TType, TMatrixConvention, TAllocator>::operator=(ConstView other)
+{
+    m_data.assign(other.getData(), other.getData() + other.numberOfData());
+    m_rowSize       = other.getRowSize();
+    m_columnSize    = other.getColumnSize();
+    return *this;
+}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>& DynamicMatrix<TType, TMatrixConvention, TAllocator>::operator+=(ConstView other) noexcept
+{
+    getView() += other;
+    return *this;
+}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>& DynamicMatrix<TType, TMatrixConvention, TAllocator>::operator-=(ConstView other) noexcept
+{
+    getView() -= other;
+    return *this;
+}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>& DynamicMatrix<TType, TMatrixConvention, TAllocator>::operator*=(TType scalar) noexcept
+{
+    getView() *= scalar;
+    return *this;
+}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>& DynamicMatrix<TType, TMatrixConvention, TAllocator>::operator*=(ConstView other)
+{
+    return *this = *this * other;
+}
+
+template <typename TType, EMatrixConvention TMatrixConvention, typename TAllocator>
+inline
+DynamicMatrix<TType, TMatrixConvention, TAllocator>& DynamicMatrix<TType, TMatrixConvention, TAllocator>::operator/=(TType scalar) noexcept
+{
+    getView() /= scalar;
+    return *this;
+}
+
+template <typename TLhsType, typename TRhsType, typename TType, EMatrixConvention TMatrixConvention>
+inline
+void multiply (DynamicMatrixView<TLhsType, TMatrixConvention> lhs, DynamicMatrixView<TRhsType, TMatrixConvention> rhs, DynamicMatrixView<TType, TMatrixConvention> out) noexcept
+{
+    static_assert(std::is_same_v<std::remove_const_t<TLhsType>, TType> && std::is_same_v<std::remove_const_t<TRhsType>, TType>, "Operands must have the same type");
+
+    assert(lhs.getColumnSize() == rhs.getRowSize());
+    assert(out.getRowSize() == lhs.getRowSize() && out.getColumnSize() == rhs.getColumnSize());
+
+    /*Column major storage is the transposed matrix : transpose(lhs * rhs) = transpose(rhs) * transpose(lhs)*/
+    if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
+    {
+        MatrixKernel::multiply(rhs.getData(), lhs.getData(), out.getData(), rhs.getColumnSize(), rhs.getRowSize(), lhs.getRowSize());
+    }
+    else
+    {
+        MatrixKernel::multiply(lhs.getData(), rhs.getData(), out.getData(), lhs.getRowSize(), lhs.getColumnSize(), rhs.getColumnSize());
+    }
+}
+
+template <typename TMatType, typename TVecType, typename TType, EMatrixConvention TMatrixConvention>
+inline
+void multiply (DynamicMatrixView<TMatType, TMatrixConvention> mat, DynamicVectorView<TVecType> vec, DynamicVectorView<TType> out) noexcept
+{
+    static_assert(std::is_same_v<std::remove_const_t<TMatType>, TType> && std::is_same_v<std::remove_const_t<TVecType>, TType>, "Operands must have the same type");
+
+    assert(mat.getColumnSize() == vec.getSize() && mat.getRowSize() == out.getSize());
+
+    if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
+    {
+        MatrixKernel::multiplyVectorColumnMajor(mat.getData(), vec.getData(), out.getData(), mat.getRowSize(), mat.getColumnSize());
+    }
+    else
+    {
+        /*Each row is a dot product accumulated in SIMD packets*/
+        for (size_t i = 0; i < mat.getRowSize(); i++)
+        {
+            out[i] = mat.getInternalVector(i).dot(vec);
+        }
+    }
+}
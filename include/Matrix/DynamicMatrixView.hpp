@@ -0,0 +1,363 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 12 h 15
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Matrix/GenericMatrix.hpp" //GenericMatrix
+#include "Matrix/EMatrixConvention.hpp" //EMatrixConvention
+#include "Vector/DynamicVectorView.hpp" //DynamicVectorView
+#include "Numeric/Limits.hpp" //isSame
+
+#include <stddef.h> //sizt_t
+#include <cassert> //assert
+#include <stdexcept> //std::out_of_range
+#include <iostream> //ostream
+#include <type_traits> //std::remove_const_t, std::is_const_v
+
+namespace FoxMath
+{
+    /**
+     * @brief Non owning view of contiguous data seen as a matrix with runtime size. Used to reinterpret GenericMatrix or DynamicMatrix without copy.
+     * Data are ordered vector by vector in function of the matrix convention, like GenericMatrix.
+     * @note The view doesn't extend the lifetime of the viewed data. Constness of the view is the constness of TType (like std::span)
+     * @example `Matrix4<float> fixed; DynamicMatrixView<float> view (fixed); view *= 2.f;`
+     * 
+     * @tparam TType : element type, const for read only view
+     * @tparam TMatrixConvention 
+     */
+    template <typename TType, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+    class DynamicMatrixView
+    {
+        public:
+
+        using Type = std::remove_const_t<TType>;
+
+        protected:
+
+        #pragma region attribut
+
+        TType*  m_data          {nullptr};
+        size_t  m_rowSize       {0};
+        size_t  m_columnSize    {0};
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region static attribut
+
+        [[nodiscard]] static inline constexpr
+		EMatrixConvention 	    getMatrixConvention	() noexcept
+        {   
+            return TMatrixConvention;
+        }
+
+        #pragma endregion //! static attribut
+
+        #pragma region constructor/destructor
+
+        constexpr inline
+        DynamicMatrixView () noexcept                                               = default;
+
+        constexpr inline
+        DynamicMatrixView (const DynamicMatrixView& other) noexcept                 = default;
+
+        constexpr inline
+        DynamicMatrixView& operator=(const DynamicMatrixView& other) noexcept       = default;
+
+        constexpr inline
+        DynamicMatrixView (TType* data, size_t rowSize, size_t columnSize) noexcept
+            : m_data {data}, m_rowSize {rowSize}, m_columnSize {columnSize}
+        {}
+
+        /**
+         * @brief View on a fixed size matrix
+         * 
+         * @tparam TRowSize 
+         * @tparam TColumnSize 
+         * @param mat 
+         */
+        template <size_t TRowSize, size_t TColumnSize>
+        constexpr inline
+        DynamicMatrixView (GenericMatrix<TRowSize, TColumnSize, Type, TMatrixConvention>& mat) noexcept
+            : m_data {mat.getData().data()}, m_rowSize {TRowSize}, m_columnSize {TColumnSize}
+        {}
+
+        /**
+         * @brief Read only view on a fixed size matrix
+         * 
+         * @tparam TRowSize 
+         * @tparam TColumnSize 
+         * @param mat 
+         */
+        template <size_t TRowSize, size_t TColumnSize, typename T = TType, std::enable_if_t<std::is_const_v<T>, bool> = true>
+        constexpr inline
+        DynamicMatrixView (const GenericMatrix<TRowSize, TColumnSize, Type, TMatrixConvention>& mat) noexcept
+            : m_data {mat.getData().data()}, m_rowSize {TRowSize}, m_columnSize {TColumnSize}
+        {}
+
+        /**
+         * @brief Read only view from a mutable view
+         * 
+         * @param other 
+         */
+        template <typename T = TType, std::enable_if_t<std::is_const_v<T>, bool> = true>
+        constexpr inline
+        DynamicMatrixView (const DynamicMatrixView<Type, TMatrixConvention>& other) noexcept
+            : m_data {other.getData()}, m_rowSize {other.getRowSize()}, m_columnSize {other.getColumnSize()}
+        {}
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Return the length if internal vector
+         * 
+         * @return constexpr size_t 
+         */
+        [[nodiscard]] constexpr inline
+        size_t vectorLength () const noexcept
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
+                return m_rowSize;
+            else 
+                return m_columnSize;
+        }
+
+        /**
+         * @brief Return the number of vector inside the matrix
+         * 
+         * @return constexpr size_t 
+         */
+        [[nodiscard]] constexpr inline
+        size_t numberOfInternalVector () const noexcept
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
+                return m_columnSize;
+            else 
+                return m_rowSize;
+        }
+
+        [[nodiscard]] constexpr inline
+        size_t numberOfData () const noexcept
+        {
+            return m_rowSize * m_columnSize;
+        }
+
+        [[nodiscard]] constexpr inline
+        bool isSquare () const noexcept
+        {
+            return m_rowSize == m_columnSize;
+        }
+
+        inline
+        const DynamicMatrixView& fill (Type scalar) const noexcept
+        {
+            getFlatView().fill(scalar);
+            return *this;
+        }
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] constexpr inline
+        size_t getRowSize () const noexcept
+        {
+            return m_rowSize;
+        }
+
+        [[nodiscard]] constexpr inline
+        size_t getColumnSize () const noexcept
+        {
+            return m_columnSize;
+        }
+
+        /**
+         * @brief Returns a pointer to the flat storage. Data are ordered vector by vector in function of the matrix convention.
+         * 
+         * @return TType* 
+         */
+        [[nodiscard]] constexpr inline
+        TType* getData () const noexcept
+        {
+            return m_data;
+        }
+
+        [[nodiscard]] constexpr inline
+        TType& getData (size_t index) const noexcept
+        {
+            assert(index < numberOfData());
+            return m_data[index];
+        }
+
+        /**
+         * @brief Returns a reference to the data j of the internal vector i (row i in row major, column i in column major)
+         * 
+         * @param i 
+         * @param j 
+         * @return TType& 
+         */
+        [[nodiscard]] constexpr inline
+        TType& getData (size_t i, size_t j) const noexcept
+        {
+            return getData(i * vectorLength() + j);
+        }
+
+        [[nodiscard]] inline
+        TType& getDataAt (size_t index) const
+        {
+            if (index < numberOfData()) [[likely]]
+                return m_data[index];
+
+            throw std::out_of_range("DynamicMatrixView::getDataAt : index out of range");
+        }
+
+        /**
+         * @brief Returns a view of the internal vector i (row i in row major, column i in column major)
+         * 
+         * @param i 
+         * @return DynamicVectorView<TType> 
+         */
+        [[nodiscard]] constexpr inline
+        DynamicVectorView<TType> getInternalVector (size_t i) const noexcept
+        {
+            assert(i < numberOfInternalVector());
+            return DynamicVectorView<TType>(m_data + i * vectorLength(), vectorLength());
+        }
+
+        /**
+         * @brief Returns the flat storage as vector view. Used by element-wise operations
+         * 
+         * @return DynamicVectorView<TType> 
+         */
+        [[nodiscard]] constexpr inline
+        DynamicVectorView<TType> getFlatView () const noexcept
+        {
+            return DynamicVectorView<TType>(m_data, numberOfData());
+        }
+
+        #pragma endregion //!accessor
+
+        #pragma region operator
+
+        /**
+         * @brief Copy the data of other in the viewed data
+         * 
+         * @param other : same size
+         * @return const DynamicMatrixView& 
+         */
+        inline
+        const DynamicMatrixView& assign (DynamicMatrixView<const Type, TMatrixConvention> other) const noexcept
+        {
+            assert(m_rowSize == other.getRowSize() && m_columnSize == other.getColumnSize());
+
+            getFlatView().assign(other.getFlatView());
+            return *this;
+        }
+
+        inline
+        const DynamicMatrixView& operator+=(DynamicMatrixView<const Type, TMatrixConvention> other) const noexcept
+        {
+            assert(m_rowSize == other.getRowSize() && m_columnSize == other.getColumnSize());
+
+            getFlatView() += other.getFlatView();
+            return *this;
+        }
+
+        inline
+        const DynamicMatrixView& operator-=(DynamicMatrixView<const Type, TMatrixConvention> other) const noexcept
+        {
+            assert(m_rowSize == other.getRowSize() && m_columnSize == other.getColumnSize());
+
+            getFlatView() -= other.getFlatView();
+            return *this;
+        }
+
+        inline
+        const DynamicMatrixView& operator*=(Type scalar) const noexcept
+        {
+            getFlatView() *= scalar;
+            return *this;
+        }
+
+        inline
+        const DynamicMatrixView& operator/=(Type scalar) const noexcept
+        {
+            getFlatView() /= scalar;
+            return *this;
+        }
+
+        #pragma endregion //!operator
+    };
+
+    /**
+     * @brief Element-wise equality with epsilon comparison
+     * 
+     * @return true if same size and all elements are equal
+     */
+    template <typename TType, typename TTypeOther, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] inline
+    bool operator==(DynamicMatrixView<TType, TMatrixConvention> lhs, DynamicMatrixView<TTypeOther, TMatrixConvention> rhs) noexcept
+    {
+        return lhs.getRowSize() == rhs.getRowSize() && lhs.getFlatView() == rhs.getFlatView();
+    }
+
+    template <typename TType, typename TTypeOther, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] inline
+    bool operator!=(DynamicMatrixView<TType, TMatrixConvention> lhs, DynamicMatrixView<TTypeOther, TMatrixConvention> rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief output stream. Print the matrix in math notation whatever the convention
+     * 
+     */
+    template <typename TType, EMatrixConvention TMatrixConvention>
+    inline
+    std::ostream& 	operator<<		(std::ostream& out, DynamicMatrixView<TType, TMatrixConvention> mat) noexcept
+    {
+        for (size_t iRow = 0; iRow < mat.getRowSize(); iRow++)
+        {
+            for (size_t iColumn = 0; iColumn < mat.getColumnSize(); iColumn++)
+            {
+                if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                    out << mat.getData(iRow, iColumn) << "  ";
+                else
+                    out << mat.getData(iColumn, iRow) << "  ";
+            }
+            out << std::endl;
+        }
+
+        return out;
+    }
+
+} /*namespace FoxMath*/
@@ -0,0 +1,292 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 10
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Numeric/SIMD.hpp" //SIMD::Packet
+#include "Memory/AlignedAllocator.hpp" //AlignedAllocator
+#include "Thread/ThreadPool.hpp" //ThreadPool, getGlobalThreadPool
+
+#include <vector> //std::vector
+#include <stddef.h> //sizt_t
+#include <algorithm> //std::min
+
+/**
+ * @brief General matrix multiplication for large matrices (out = lhs * rhs in row major storage).
+ * Operands are packed in panels sized for the caches (Goto's algorithm) :
+ * - rhs is packed by panel of kc * nc and stripes of nr columns (stay in L2/L3 and stream in L1),
+ * - lhs is packed by block of mc * kc and stripes of mr rows (stay in L2),
+ * - a mr * nr micro kernel keeps the out tile in SIMD registers during the kc loop.
+ * Blocks of lhs rows are split between the threads of the pool.
+ */
+namespace FoxMath::Gemm
+{
+    /**
+     * @brief Register blocking and cache blocking of the kernel for TType
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    struct Blocking
+    {
+        using Packet = SIMD::Packet<TType>;
+
+        /*Rows of the micro kernel. mr * nr / Packet::size accumulators + 2 rhs registers + 1 broadcast fit in 16 registers*/
+        static constexpr size_t mr = (Packet::size == 8) ? 6 : 4;
+
+        /*Columns of the micro kernel : 2 packets (4 scalars for generic packet)*/
+        static constexpr size_t nr = (Packet::size == 1) ? 4 : 2 * Packet::size;
+
+        /*Depth of the panels : a kc * nr stripe of rhs fits in L1*/
+        static constexpr size_t kc = 256;
+
+        /*Rows of lhs block : mc * kc fits in L2*/
+        static constexpr size_t mc = mr * 16;
+
+        /*Columns of rhs panel : kc * nc fits in L3*/
+        static constexpr size_t nc = nr * 128;
+    };
+
+    /*Under this number of multiply-add, the packing cost is not amortized and the blocked kernel of MatrixKernel is used*/
+    inline constexpr size_t minMultiplyAddCount = 48 * 48 * 48;
+
+    /*Under this number of multiply-add by thread, the work is not split*/
+    inline constexpr size_t minMultiplyAddCountByThread = 128 * 128 * 128;
+
+    /**
+     * @brief Pack kc * nc block of rhs by stripes of nr columns : stripe[k * nr + j]. Missing columns are padded with zero
+     * 
+     * @tparam TType 
+     * @param rhs : first element of the block
+     * @param rhsStride : column size of rhs
+     * @param kc 
+     * @param nc 
+     * @param packed 
+     */
+    template <typename TType>
+    inline
+    void packRhs (const TType* rhs, size_t rhsStride, size_t kc, size_t nc, TType* packed) noexcept
+    {
+        constexpr size_t nr = Blocking<TType>::nr;
+
+        for (size_t j0 = 0; j0 < nc; j0 += nr)
+        {
+            const size_t width = std::min(nr, nc - j0);
+
+            for (size_t k = 0; k < kc; k++)
+            {
+                const TType* src = rhs + k * rhsStride + j0;
+
+                for (size_t j = 0; j < width; j++)
+                    packed[j] = src[j];
+
+                for (size_t j = width; j < nr; j++)
+                    packed[j] = static_cast<TType>(0);
+
+                packed += nr;
+            }
+        }
+    }
+
+    /**
+     * @brief Pack mc * kc block of lhs by stripes of mr rows : stripe[k * mr + i]. Missing rows are padded with zero
+     * 
+     * @tparam TType 
+     * @param lhs : first element of the block
+     * @param lhsStride : column size of lhs
+     * @param mc 
+     * @param kc 
+     * @param packed 
+     */
+    template <typename TType>
+    inline
+    void packLhs (const TType* lhs, size_t lhsStride, size_t mc, size_t kc, TType* packed) noexcept
+    {
+        constexpr size_t mr = Blocking<TType>::mr;
+
+        for (size_t i0 = 0; i0 < mc; i0 += mr)
+        {
+            const size_t height = std::min(mr, mc - i0);
+
+            for (size_t k = 0; k < kc; k++)
+            {
+                for (size_t i = 0; i < height; i++)
+                    packed[i] = lhs[(i0 + i) * lhsStride + k];
+
+                for (size_t i = height; i < mr; i++)
+                    packed[i] = static_cast<TType>(0);
+
+                packed += mr;
+            }
+        }
+    }
+
+    /**
+     * @brief out[mr * nr] += packedLhs stripe * packedRhs stripe. Edge tiles (height < mr or width < nr) are computed in full and partially written
+     * 
+     * @tparam TType 
+     * @param kc 
+     * @param packedLhs 
+     * @param packedRhs : aligned on Packet size
+     * @param out 
+     * @param outStride 
+     * @param height 
+     * @param width 
+     */
+    template <typename TType>
+    inline
+    void microKernel (size_t kc, const TType* packedLhs, const TType* packedRhs, TType* out, size_t outStride, size_t height, size_t width) noexcept
+    {
+        using Packet = SIMD::Packet<TType>;
+        constexpr size_t mr             = Blocking<TType>::mr;
+        constexpr size_t nr             = Blocking<TType>::nr;
+        constexpr size_t packetByRow    = nr / Packet::size;
+
+        typename Packet::Type acc[mr][packetByRow];
+
+        for (size_t i = 0; i < mr; i++)
+            for (size_t j = 0; j < packetByRow; j++)
+                acc[i][j] = Packet::set1(static_cast<TType>(0));
+
+        for (size_t k = 0; k < kc; k++)
+        {
+            typename Packet::Type rhsRow[packetByRow];
+
+            for (size_t j = 0; j < packetByRow; j++)
+                rhsRow[j] = Packet::load(packedRhs + j * Packet::size);
+
+            for (size_t i = 0; i < mr; i++)
+            {
+                const typename Packet::Type lhsCoef = Packet::set1(packedLhs[i]);
+
+                for (size_t j = 0; j < packetByRow; j++)
+                    acc[i][j] = Packet::mulAdd(acc[i][j], lhsCoef, rhsRow[j]);
+            }
+
+            packedLhs += mr;
+            packedRhs += nr;
+        }
+
+        if (height == mr && width == nr) [[likely]]
+        {
+            for (size_t i = 0; i < mr; i++)
+            {
+                for (size_t j = 0; j < packetByRow; j++)
+                {
+                    TType* dst = out + i * outStride + j * Packet::size;
+                    Packet::storeUnaligned(dst, Packet::add(Packet::loadUnaligned(dst), acc[i][j]));
+                }
+            }
+        }
+        else
+        {
+            alignas(64) TType tile[mr * nr];
+
+            for (size_t i = 0; i < mr; i++)
+                for (size_t j = 0; j < packetByRow; j++)
+                    Packet::store(tile + i * nr + j * Packet::size, acc[i][j]);
+
+            for (size_t i = 0; i < height; i++)
+                for (size_t j = 0; j < width; j++)
+                    out[i * outStride + j] += tile[i * nr + j];
+        }
+    }
+
+    /**
+     * @brief out = lhs * rhs with lhs rowSize * innerSize and rhs innerSize * columnSize in row major storage.
+     * Blocks of mc rows of out are processed in parallel by the pool if the product is large enough.
+     * @note out must not alias lhs or rhs
+     * 
+     * @tparam TType 
+     * @param lhs 
+     * @param rhs 
+     * @param out 
+     * @param rowSize 
+     * @param innerSize 
+     * @param columnSize 
+     * @param pool 
+     */
+    template <typename TType>
+    inline
+    void multiply (const TType* lhs, const TType* rhs, TType* out, size_t rowSize, size_t innerSize, size_t columnSize, ThreadPool& pool = getGlobalThreadPool()) noexcept
+    {
+        using Block = Blocking<TType>;
+        using Buffer = std::vector<TType, AlignedAllocator<TType>>;
+
+        for (size_t i = 0; i < rowSize * columnSize; i++)
+            out[i] = static_cast<TType>(0);
+
+        const size_t rowBlockCount  = (rowSize + Block::mc - 1) / Block::mc;
+        const size_t workByRowBlock = Block::mc * innerSize * columnSize;
+        const size_t grain          = std::max<size_t>(minMultiplyAddCountByThread / std::max<size_t>(workByRowBlock, 1), 1);
+
+        /*Packed rhs panel is shared by the threads. Packed lhs block is private to each thread*/
+        thread_local Buffer packedRhs;
+        packedRhs.resize(Block::kc * ((std::min(columnSize, Block::nc) + Block::nr - 1) / Block::nr) * Block::nr);
+
+        for (size_t jc = 0; jc < columnSize; jc += Block::nc)
+        {
+            const size_t nc = std::min(Block::nc, columnSize - jc);
+
+            for (size_t pc = 0; pc < innerSize; pc += Block::kc)
+            {
+                const size_t kc = std::min(Block::kc, innerSize - pc);
+
+                packRhs(rhs + pc * columnSize + jc, columnSize, kc, nc, packedRhs.data());
+
+                const TType* packedRhsData = packedRhs.data();
+
+                pool.parallelFor(rowBlockCount, grain, [&](size_t begin, size_t end)
+                {
+                    thread_local Buffer packedLhs;
+                    packedLhs.resize(Block::mc * Block::kc);
+
+                    for (size_t rowBlock = begin; rowBlock < end; rowBlock++)
+                    {
+                        const size_t ic = rowBlock * Block::mc;
+                        const size_t mc = std::min(Block::mc, rowSize - ic);
+
+                        packLhs(lhs + ic * innerSize + pc, innerSize, mc, kc, packedLhs.data());
+
+                        for (size_t jr = 0; jr < nc; jr += Block::nr)
+                        {
+                            for (size_t ir = 0; ir < mc; ir += Block::mr)
+                            {
+                                microKernel(kc, packedLhs.data() + ir * kc, packedRhsData + jr * kc, 
+                                            out + (ic + ir) * columnSize + jc + jr, columnSize,
+                                            std::min(Block::mr, mc - ir), std::min(Block::nr, nc - jr));
+                            }
+                        }
+                    }
+                });
+            }
+        }
+    }
+
+} /*namespace FoxMath::Gemm*/
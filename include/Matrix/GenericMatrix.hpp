@@ -34,6 +34,7 @@
 #include "Vector/GenericVector.hpp" //GenericVector
 #include "Types/Implicit.hpp" //implicit
 #include "Numeric/Limits.hpp" //isSameAsZero
+#include "Matrix/MatrixKernel.hpp" //MatrixKernel::multiply
 
 #include <iostream> //ostream, istream
 #include <array> //std::array
@@ -300,6 +301,28 @@ namespace FoxMath
     
         #pragma region accessor
 
+        /**
+         * @brief Returns a reference to the flat storage of the GenericMatrix. Data are ordered vector by vector in function of the matrix convention.
+         * 
+         * @return constexpr std::array<TType, numberOfData ()>& 
+         */
+        [[nodiscard]] inline constexpr
+		std::array<TType, numberOfData ()>& 	    getData	() noexcept
+        {
+            return m_data;
+        }
+
+        /**
+         * @brief Returns a const reference to the flat storage of the GenericMatrix. Data are ordered vector by vector in function of the matrix convention.
+         * 
+         * @return constexpr const std::array<TType, numberOfData ()>& 
+         */
+        [[nodiscard]] inline constexpr
+		const std::array<TType, numberOfData ()>& 	    getData	() const noexcept
+        {
+            return m_data;
+        }
+
         /**
          * @brief Returns a reference to the data at index in the GenericMatrix
          * 
@@ -982,6 +1005,21 @@ namespace FoxMath
 	[[nodiscard]] inline constexpr
     GenericMatrix<TRowSize, TColumnSizeOther, TType, TMatrixConvention> operator*(const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& lhs, const GenericMatrix<TRowSizeOther, TColumnSizeOther, TType, TMatrixConvention>& rhs) noexcept;
 
+    /**
+     * @brief multiplication of matrix by column vector
+     * 
+     * @tparam TRowSize 
+     * @tparam TColumnSize 
+     * @tparam TType 
+     * @tparam TMatrixConvention 
+     * @param mat 
+     * @param vec 
+     * @return constexpr GenericVector<TRowSize, TType> 
+     */
+	template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+	[[nodiscard]] inline constexpr
+    GenericVector<TRowSize, TType> operator*(const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& mat, const GenericVector<TColumnSize, TType>& vec) noexcept;
+
 
     /**
      * @brief division
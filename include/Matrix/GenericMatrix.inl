@@ -308,21 +308,38 @@ template <size_t TRowSizeOther, size_t TColumnSizeOther, typename TTypeOther, Is
 inline constexpr
 GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>::operator*=(const GenericMatrix<TRowSizeOther, TColumnSizeOther, TTypeOther, TMatrixConvention>& other) noexcept
 {
-    GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention> mRst;
-    mRst.fill(0);
-
-    for ( size_t i = 0; i < TRowSize; i++ )
+    const auto multiply = [this](const std::array<TType, TRowSizeOther * TColumnSizeOther>& rhs) constexpr noexcept
     {
-        for ( size_t j = 0; j < TColumnSize; j++ )
+        std::array<TType, numberOfData ()> rst {};
+
+        /*Column major storage is the transposed matrix : transpose(lhs * rhs) = transpose(rhs) * transpose(lhs)*/
+        if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
         {
-            for ( size_t index = 0; index < TRowSizeOther; index++)
-            {
-                mRst.getData(i * TRowSize + j) += m_data[i * TRowSize + index] * static_cast<TType>(other.getData(index * other.vectorLength() + j));
-            }
+            MatrixKernel::multiply<TColumnSizeOther, TRowSizeOther, TRowSize>(rhs, m_data, rst);
+        }
+        else
+        {
+            MatrixKernel::multiply<TRowSize, TColumnSize, TColumnSizeOther>(m_data, rhs, rst);
         }
+
+        m_data = rst;
+    };
+
+    if constexpr (std::is_same_v<TType, TTypeOther>)
+    {
+        multiply(other.getData());
     }
+    else
+    {
+        std::array<TType, TRowSizeOther * TColumnSizeOther> otherConverted {};
 
-    (*this) = std::move(mRst);
+        for (size_t i = 0; i < otherConverted.size(); i++)
+        {
+            otherConverted[i] = static_cast<TType>(other.getData(i));
+        }
+
+        multiply(otherConverted);
+    }
     
     return *this;
 }
@@ -717,29 +734,51 @@ inline constexpr
 GenericMatrix<TRowSize, TColumnSizeOther, TType, TMatrixConvention> operator*(const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& lhs, const GenericMatrix<TRowSizeOther, TColumnSizeOther, TType, TMatrixConvention>& rhs) noexcept
 {
     GenericMatrix<TRowSize, TColumnSizeOther, TType, TMatrixConvention> mRst;
-    mRst.fill(0);
 
-    for ( size_t i = 0; i < mRst.numberOfInternalVector() ; i++ )
+    /*Column major storage is the transposed matrix : transpose(lhs * rhs) = transpose(rhs) * transpose(lhs)*/
+    if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
     {
-        for ( size_t j = 0; j < mRst.vectorLength(); j++ )
-        {
-            for ( size_t index = 0; index < TRowSizeOther; index++)
-            {
-                if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
-                {
-                    mRst.getData(i, j) += lhs.getData(index, j) * rhs.getData(i, index);
-                }
-                else
-                {
-                    mRst.getData(i, j) += lhs.getData(i, index) * rhs.getData(index, j);         
-                }
-            }
-        }
+        MatrixKernel::multiply<TColumnSizeOther, TRowSizeOther, TRowSize>(rhs.getData(), lhs.getData(), mRst.getData());
+    }
+    else
+    {
+        MatrixKernel::multiply<TRowSize, TRowSizeOther, TColumnSizeOther>(lhs.getData(), rhs.getData(), mRst.getData());
     }
 
     return mRst;
 }
 
+template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+GenericVector<TRowSize, TType> operator*(const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& mat, const GenericVector<TColumnSize, TType>& vec) noexcept
+{
+    std::array<TType, TColumnSize> vecData {};
+    std::array<TType, TRowSize> rstData {};
+
+    for (size_t i = 0; i < TColumnSize; i++)
+    {
+        vecData[i] = vec[i];
+    }
+
+    if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
+    {
+        MatrixKernel::multiplyVectorColumnMajor<TRowSize, TColumnSize>(mat.getData(), vecData, rstData);
+    }
+    else
+    {
+        MatrixKernel::multiplyVectorRowMajor<TRowSize, TColumnSize>(mat.getData(), vecData, rstData);
+    }
+
+    GenericVector<TRowSize, TType> rst;
+
+    for (size_t i = 0; i < TRowSize; i++)
+    {
+        rst.setData(i, rstData[i]);
+    }
+
+    return rst;
+}
+
 template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention, typename TTypeScalar, IsArithmetic<TTypeScalar> = true>
 inline constexpr
 GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention> operator/(GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention> mat, TTypeScalar scalar) noexcept
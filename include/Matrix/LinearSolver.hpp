@@ -0,0 +1,625 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Matrix/SquareMatrix.hpp" //SquareMatrix, GenericMatrix
+#include "Vector/GenericVector.hpp" //GenericVector
+#include "Numeric/Math.hpp" //Math::sqrt, Math::abs
+#include "Thread/ParallelFor.hpp" //parallelFor
+#include "Numeric/SIMD.hpp" //SIMD::Packet
+
+#include <array> //std::array
+#include <limits> //std::numeric_limits
+#include <stddef.h> //sizt_t
+#include <type_traits> //std::is_floating_point_v, std::is_base_of_v
+#include <algorithm> //std::min
+
+namespace FoxMath
+{
+    /**
+     * @brief Common solve interface of the factorization objects. The matrix is factorized once by the constructor of TDerived and
+     * each right-hand side only pay the substitutions (O(n^2) instead of O(n^3) for getReverse followed by a product).
+     * TDerived must provide solveInPlace<TRhsCount>(std::array<TType, TSize * TRhsCount>&) where the right-hand sides are stored row by row :
+     * the data of the row i of all right-hand sides are contiguous, so substitutions are vectorized across right-hand sides.
+     * 
+     * @tparam TDerived : LUDecomposition, CholeskyDecomposition or QRDecomposition
+     * @tparam TSize 
+     * @tparam TType 
+     * @tparam TMatrixConvention 
+     */
+    template <typename TDerived, size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+    class LinearSolver
+    {
+        static_assert(std::is_floating_point_v<TType>, "Factorization needs floating point type");
+
+        protected:
+
+        #pragma region attribut
+
+        std::array<TType, TSize * TSize>    m_factor    {}; //factors stored row by row whatever the matrix convention
+        bool                                m_isValid   {false};
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        /**
+         * @brief Return the coefficient of the row i and the column j of matrix in function of the matrix convention
+         */
+        [[nodiscard]] static inline constexpr
+        TType getCoefficient (const SquareMatrix<TSize, TType, TMatrixConvention>& matrix, size_t i, size_t j) noexcept
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                return matrix.getData(i, j);
+            else
+                return matrix.getData(j, i);
+        }
+
+        /**
+         * @brief Return the tolerance under which a pivot is considered null : n * epsilon * max(|aij|)
+         */
+        [[nodiscard]] static inline constexpr
+        TType getSingularityTolerance (const std::array<TType, TSize * TSize>& data) noexcept
+        {
+            TType maxAbs = static_cast<TType>(0);
+
+            for (size_t i = 0; i < TSize * TSize; i++)
+                maxAbs = Math::abs(data[i]) > maxAbs ? Math::abs(data[i]) : maxAbs;
+
+            return static_cast<TType>(TSize) * std::numeric_limits<TType>::epsilon() * maxAbs;
+        }
+
+        /**
+         * @brief Fill m_factor with the coefficient of matrix stored row by row
+         */
+        inline constexpr
+        void loadMatrix (const SquareMatrix<TSize, TType, TMatrixConvention>& matrix) noexcept
+        {
+            for (size_t i = 0; i < TSize; i++)
+                for (size_t j = 0; j < TSize; j++)
+                    m_factor[i * TSize + j] = getCoefficient(matrix, i, j);
+        }
+
+        /**
+         * @brief Substitution step on the rows of the right-hand sides : row i = (row i - sum of coefficients[j] * row j for j in [begin, end[) * scale.
+         * Row i is accumulated in registers so the substitution doesn't wait the store of the previous step.
+         * Use SIMD packet at runtime if TRhsCount is a multiple of the packet size.
+         * 
+         * @tparam TRhsCount : number of data by row
+         * @param rows : right-hand sides stored row by row
+         * @param i 
+         * @param coefficients : row i of the triangular factor
+         * @param begin 
+         * @param end 
+         * @param scale : reciprocal of the diagonal coefficient
+         */
+        template <size_t TRhsCount>
+        static inline constexpr
+        void substituteRow (TType* rows, size_t i, const TType* coefficients, size_t begin, size_t end, TType scale) noexcept
+        {
+            TType* row = rows + i * TRhsCount;
+
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+            using Packet = SIMD::Packet<TType>;
+
+            if constexpr (Packet::size > 1 && TRhsCount % Packet::size == 0)
+            {
+                if (!FOXMATH_IS_CONSTANT_EVALUATED())
+                {
+                    constexpr size_t packetCount = TRhsCount / Packet::size;
+
+                    typename Packet::Type acc[packetCount];
+
+                    for (size_t p = 0; p < packetCount; p++)
+                        acc[p] = Packet::loadUnaligned(row + p * Packet::size);
+
+                    for (size_t j = begin; j < end; j++)
+                    {
+                        const typename Packet::Type coefficient = Packet::set1(-coefficients[j]);
+
+                        for (size_t p = 0; p < packetCount; p++)
+                            acc[p] = Packet::mulAdd(acc[p], coefficient, Packet::loadUnaligned(rows + j * TRhsCount + p * Packet::size));
+                    }
+
+                    const typename Packet::Type scalePacket = Packet::set1(scale);
+
+                    for (size_t p = 0; p < packetCount; p++)
+                        Packet::storeUnaligned(row + p * Packet::size, Packet::mul(acc[p], scalePacket));
+
+                    return;
+                }
+            }
+#endif
+
+            std::array<TType, TRhsCount> acc {};
+
+            for (size_t r = 0; r < TRhsCount; r++)
+                acc[r] = row[r];
+
+            for (size_t j = begin; j < end; j++)
+                for (size_t r = 0; r < TRhsCount; r++)
+                    acc[r] -= coefficients[j] * rows[j * TRhsCount + r];
+
+            for (size_t r = 0; r < TRhsCount; r++)
+                row[r] = acc[r] * scale;
+        }
+
+        /**
+         * @brief dst -= coefficient * src on TRhsCount contiguous data (one row of the right-hand sides).
+         * Use SIMD packet at runtime if TRhsCount is a multiple of the packet size.
+         */
+        template <size_t TRhsCount>
+        static inline constexpr
+        void subtractScaledRow (TType* dst, TType coefficient, const TType* src) noexcept
+        {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+            using Packet = SIMD::Packet<TType>;
+
+            if constexpr (Packet::size > 1 && TRhsCount % Packet::size == 0)
+            {
+                if (!FOXMATH_IS_CONSTANT_EVALUATED())
+                {
+                    const typename Packet::Type coefficientPacket = Packet::set1(coefficient);
+
+                    for (size_t r = 0; r < TRhsCount; r += Packet::size)
+                        Packet::storeUnaligned(dst + r, Packet::sub(Packet::loadUnaligned(dst + r), Packet::mul(coefficientPacket, Packet::loadUnaligned(src + r))));
+
+                    return;
+                }
+            }
+#endif
+
+            for (size_t r = 0; r < TRhsCount; r++)
+                dst[r] -= coefficient * src[r];
+        }
+
+        /**
+         * @brief dst *= scalar on TRhsCount contiguous data. Use SIMD packet at runtime if TRhsCount is a multiple of the packet size.
+         */
+        template <size_t TRhsCount>
+        static inline constexpr
+        void scaleRow (TType* dst, TType scalar) noexcept
+        {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+            using Packet = SIMD::Packet<TType>;
+
+            if constexpr (Packet::size > 1 && TRhsCount % Packet::size == 0)
+            {
+                if (!FOXMATH_IS_CONSTANT_EVALUATED())
+                {
+                    const typename Packet::Type scalarPacket = Packet::set1(scalar);
+
+                    for (size_t r = 0; r < TRhsCount; r += Packet::size)
+                        Packet::storeUnaligned(dst + r, Packet::mul(Packet::loadUnaligned(dst + r), scalarPacket));
+
+                    return;
+                }
+            }
+#endif
+
+            for (size_t r = 0; r < TRhsCount; r++)
+                dst[r] *= scalar;
+        }
+
+        /**
+         * @brief Solve rhsCount right-hand sides (rhsCount <= TGroupSize) together. Missing right-hand sides are padded with zero.
+         */
+        template <size_t TGroupSize, typename TVector>
+        inline
+        void solveGroup (const TVector* rhs, TVector* solutions, size_t rhsCount) const noexcept
+        {
+            std::array<TType, TSize * TGroupSize> data {};
+
+            for (size_t k = 0; k < rhsCount; k++)
+                for (size_t i = 0; i < TSize; i++)
+                    data[i * TGroupSize + k] = rhs[k][i];
+
+            static_cast<const TDerived*>(this)->template solveInPlace<TGroupSize>(data);
+
+            for (size_t k = 0; k < rhsCount; k++)
+                for (size_t i = 0; i < TSize; i++)
+                    solutions[k].setData(i, data[i * TGroupSize + k]);
+        }
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region methods
+
+        /**
+         * @brief Return false if factorization failed (singular matrix for LU and QR, not symmetric positive definite matrix for Cholesky).
+         * Solve result is undefined if factorization is not valid.
+         * 
+         * @return true 
+         * @return false 
+         */
+        [[nodiscard]] inline constexpr
+        bool isValid () const noexcept
+        {
+            return m_isValid;
+        }
+
+        /**
+         * @brief Solve A * x = rhs
+         * 
+         * @param rhs 
+         * @return GenericVector<TSize, TType> x
+         */
+        [[nodiscard]] inline constexpr
+        GenericVector<TSize, TType> solve (const GenericVector<TSize, TType>& rhs) const noexcept
+        {
+            assert(m_isValid);
+
+            std::array<TType, TSize> data {};
+
+            for (size_t i = 0; i < TSize; i++)
+                data[i] = rhs[i];
+
+            static_cast<const TDerived*>(this)->template solveInPlace<1>(data);
+
+            GenericVector<TSize, TType> rst;
+
+            for (size_t i = 0; i < TSize; i++)
+                rst.setData(i, data[i]);
+
+            return rst;
+        }
+
+        /**
+         * @brief Solve A * X = rhs with each column of rhs as right-hand side. All columns are solved together.
+         * 
+         * @tparam TRhsCount 
+         * @param rhs 
+         * @return GenericMatrix<TSize, TRhsCount, TType, TMatrixConvention> X
+         */
+        template <size_t TRhsCount>
+        [[nodiscard]] inline constexpr
+        GenericMatrix<TSize, TRhsCount, TType, TMatrixConvention> solve (const GenericMatrix<TSize, TRhsCount, TType, TMatrixConvention>& rhs) const noexcept
+        {
+            assert(m_isValid);
+
+            std::array<TType, TSize * TRhsCount> data {};
+
+            /*Row major storage is already ordered row by row*/
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+            {
+                data = rhs.getData();
+            }
+            else
+            {
+                for (size_t i = 0; i < TSize; i++)
+                    for (size_t j = 0; j < TRhsCount; j++)
+                        data[i * TRhsCount + j] = rhs.getData(j, i);
+            }
+
+            static_cast<const TDerived*>(this)->template solveInPlace<TRhsCount>(data);
+
+            GenericMatrix<TSize, TRhsCount, TType, TMatrixConvention> rst;
+
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+            {
+                rst.getData() = data;
+            }
+            else
+            {
+                for (size_t i = 0; i < TSize; i++)
+                    for (size_t j = 0; j < TRhsCount; j++)
+                        rst.getData(j, i) = data[i * TRhsCount + j];
+            }
+
+            return rst;
+        }
+
+        /**
+         * @brief Solve A * x = rhs[i] for count right-hand sides and write x in solutions[i].
+         * Right-hand sides are solved by group of 32 so substitutions run on several independent SIMD packets, and big batches are split across threads.
+         * rhs and solutions can be the same buffer.
+         * 
+         * @tparam TVector : GenericVector<TSize, TType> or child like Vec3
+         * @param rhs 
+         * @param solutions 
+         * @param count 
+         */
+        template <typename TVector>
+        inline
+        void solve (const TVector* rhs, TVector* solutions, size_t count) const noexcept
+        {
+            static_assert(std::is_base_of_v<GenericVector<TSize, TType>, TVector>, "Vector must be a GenericVector with the same size and type than the matrix");
+            assert(m_isValid);
+
+            parallelFor(count, defaultParallelGrain / (TSize * TSize), [&](size_t begin, size_t end)
+            {
+                /*Group sizes are multiple of all packet sizes. Tail is solved by small groups to limit the padding*/
+                size_t index = begin;
+
+                for (; index + 32 <= end; index += 32)
+                    solveGroup<32>(rhs + index, solutions + index, 32);
+
+                for (; index < end; index += 8)
+                    solveGroup<8>(rhs + index, solutions + index, std::min<size_t>(8, end - index));
+            });
+        }
+
+        #pragma endregion //!methods
+    };
+
+    /**
+     * @brief LU decomposition with partial pivoting : P * A = L * U. Works with any invertible matrix.
+     * @example 
+     * ```
+     * const LUDecomposition<6> lu (jacobian);
+     * if (lu.isValid())
+     *     for (size_t iteration = 0; iteration < 8; iteration++)
+     *         lambda = lu.solve(residual);
+     * ```
+     * 
+     * @tparam TSize 
+     * @tparam TType 
+     * @tparam TMatrixConvention 
+     */
+    template <size_t TSize, typename TType = float, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+    class LUDecomposition : public LinearSolver<LUDecomposition<TSize, TType, TMatrixConvention>, TSize, TType, TMatrixConvention>
+    {
+        private:
+
+        using Parent = LinearSolver<LUDecomposition<TSize, TType, TMatrixConvention>, TSize, TType, TMatrixConvention>;
+        friend Parent;
+
+        protected:
+
+        #pragma region attribut
+
+        std::array<size_t, TSize>   m_permutation           {}; //row of A used for the row i of L * U
+        std::array<TType, TSize>    m_diagonalReciprocal    {}; //1 / Uii
+        bool                        m_isPermutationOdd      {false};
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        template <size_t TRhsCount>
+        inline constexpr
+        void solveInPlace (std::array<TType, TSize * TRhsCount>& rhs) const noexcept;
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        constexpr inline
+        LUDecomposition () noexcept                                         = default;
+
+        constexpr inline
+        LUDecomposition (const LUDecomposition& other) noexcept             = default;
+
+        constexpr inline
+        LUDecomposition (LUDecomposition&& other) noexcept                  = default;
+
+        inline
+        ~LUDecomposition () noexcept                                        = default;
+
+        constexpr inline
+        LUDecomposition& operator=(LUDecomposition const& other) noexcept   = default;
+
+        constexpr inline
+        LUDecomposition& operator=(LUDecomposition && other) noexcept       = default;
+
+        /**
+         * @brief Factorize matrix. Use isValid to know if matrix is invertible
+         * 
+         * @param matrix 
+         */
+        explicit constexpr inline
+        LUDecomposition (const SquareMatrix<TSize, TType, TMatrixConvention>& matrix) noexcept;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Return the determinant of the factorized matrix : product of U diagonal signed by the permutation parity
+         * 
+         * @return constexpr TType 
+         */
+        [[nodiscard]] inline constexpr
+        TType getDeterminant () const noexcept;
+
+        /**
+         * @brief Return the reverse of the factorized matrix. Prefer solve if the reverse is only used to multiply vectors
+         * 
+         * @return constexpr SquareMatrix<TSize, TType, TMatrixConvention> 
+         */
+        [[nodiscard]] inline constexpr
+        SquareMatrix<TSize, TType, TMatrixConvention> getReverse () const noexcept;
+
+        #pragma endregion //!methods
+    };
+
+    /**
+     * @brief Cholesky decomposition : A = L * transpose(L). Only for symmetric positive definite matrix (like mass matrix, normal equation or constraint system J * M^-1 * Jt).
+     * Twice faster than LU and stable without pivoting. Only the lower triangle of the matrix is read.
+     * transpose(L) is stored in the upper triangle so both substitutions read the factor row by row.
+     * 
+     * @tparam TSize 
+     * @tparam TType 
+     * @tparam TMatrixConvention 
+     */
+    template <size_t TSize, typename TType = float, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+    class CholeskyDecomposition : public LinearSolver<CholeskyDecomposition<TSize, TType, TMatrixConvention>, TSize, TType, TMatrixConvention>
+    {
+        private:
+
+        using Parent = LinearSolver<CholeskyDecomposition<TSize, TType, TMatrixConvention>, TSize, TType, TMatrixConvention>;
+        friend Parent;
+
+        protected:
+
+        #pragma region attribut
+
+        std::array<TType, TSize>    m_diagonalReciprocal    {}; //1 / Lii
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        template <size_t TRhsCount>
+        inline constexpr
+        void solveInPlace (std::array<TType, TSize * TRhsCount>& rhs) const noexcept;
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        constexpr inline
+        CholeskyDecomposition () noexcept                                               = default;
+
+        constexpr inline
+        CholeskyDecomposition (const CholeskyDecomposition& other) noexcept             = default;
+
+        constexpr inline
+        CholeskyDecomposition (CholeskyDecomposition&& other) noexcept                  = default;
+
+        inline
+        ~CholeskyDecomposition () noexcept                                              = default;
+
+        constexpr inline
+        CholeskyDecomposition& operator=(CholeskyDecomposition const& other) noexcept   = default;
+
+        constexpr inline
+        CholeskyDecomposition& operator=(CholeskyDecomposition && other) noexcept       = default;
+
+        /**
+         * @brief Factorize matrix. isValid return false if matrix is not positive definite
+         * 
+         * @param matrix 
+         */
+        explicit constexpr inline
+        CholeskyDecomposition (const SquareMatrix<TSize, TType, TMatrixConvention>& matrix) noexcept;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Return the determinant of the factorized matrix : square of the product of L diagonal
+         * 
+         * @return constexpr TType 
+         */
+        [[nodiscard]] inline constexpr
+        TType getDeterminant () const noexcept;
+
+        #pragma endregion //!methods
+    };
+
+    /**
+     * @brief Householder QR decomposition : A = Q * R. Slower than LU but more stable for ill conditioned matrix.
+     * Q is not built : Householder reflectors are stored under R diagonal and applied to each right-hand side.
+     * 
+     * @tparam TSize 
+     * @tparam TType 
+     * @tparam TMatrixConvention 
+     */
+    template <size_t TSize, typename TType = float, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+    class QRDecomposition : public LinearSolver<QRDecomposition<TSize, TType, TMatrixConvention>, TSize, TType, TMatrixConvention>
+    {
+        private:
+
+        using Parent = LinearSolver<QRDecomposition<TSize, TType, TMatrixConvention>, TSize, TType, TMatrixConvention>;
+        friend Parent;
+
+        protected:
+
+        #pragma region attribut
+
+        std::array<TType, TSize>    m_diagonalReciprocal    {}; //1 / Rii
+        std::array<TType, TSize>    m_tau                   {}; //reflector k is I - tau * v * vt with v = (1, m_factor[k + 1][k], ..., m_factor[n - 1][k])
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        template <size_t TRhsCount>
+        inline constexpr
+        void solveInPlace (std::array<TType, TSize * TRhsCount>& rhs) const noexcept;
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        constexpr inline
+        QRDecomposition () noexcept                                         = default;
+
+        constexpr inline
+        QRDecomposition (const QRDecomposition& other) noexcept             = default;
+
+        constexpr inline
+        QRDecomposition (QRDecomposition&& other) noexcept                  = default;
+
+        inline
+        ~QRDecomposition () noexcept                                        = default;
+
+        constexpr inline
+        QRDecomposition& operator=(QRDecomposition const& other) noexcept   = default;
+
+        constexpr inline
+        QRDecomposition& operator=(QRDecomposition && other) noexcept       = default;
+
+        /**
+         * @brief Factorize matrix. Use isValid to know if matrix has full rank
+         * 
+         * @param matrix 
+         */
+        explicit constexpr inline
+        QRDecomposition (const SquareMatrix<TSize, TType, TMatrixConvention>& matrix) noexcept;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Return the absolute value of the determinant : product of |Rii|
+         * 
+         * @return constexpr TType 
+         */
+        [[nodiscard]] inline constexpr
+        TType getAbsDeterminant () const noexcept;
+
+        #pragma endregion //!methods
+    };
+
+    #include "Matrix/LinearSolver.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,336 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#pragma region LUDecomposition
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+constexpr inline
+LUDecomposition<TSize, TType, TMatrixConvention>::LUDecomposition (const SquareMatrix<TSize, TType, TMatrixConvention>& matrix) noexcept
+{
+    std::array<TType, TSize * TSize>& a = Parent::m_factor;
+    Parent::loadMatrix(matrix);
+
+    const TType tolerance = Parent::getSingularityTolerance(a);
+
+    for (size_t i = 0; i < TSize; i++)
+        m_permutation[i] = i;
+
+    for (size_t k = 0; k < TSize; k++)
+    {
+        /*Partial pivoting : use the biggest coeficient of the column*/
+        size_t pivot = k;
+        TType pivotAbs = Math::abs(a[k * TSize + k]);
+
+        for (size_t i = k + 1; i < TSize; i++)
+        {
+            const TType coefAbs = Math::abs(a[i * TSize + k]);
+            if (coefAbs > pivotAbs)
+            {
+                pivot = i;
+                pivotAbs = coefAbs;
+            }
+        }
+
+        if (pivotAbs <= tolerance)
+            return;
+
+        if (pivot != k)
+        {
+            for (size_t j = 0; j < TSize; j++)
+            {
+                const TType temp = a[k * TSize + j];
+                a[k * TSize + j] = a[pivot * TSize + j];
+                a[pivot * TSize + j] = temp;
+            }
+
+            const size_t temp = m_permutation[k];
+            m_permutation[k] = m_permutation[pivot];
+            m_permutation[pivot] = temp;
+            m_isPermutationOdd = !m_isPermutationOdd;
+        }
+
+        m_diagonalReciprocal[k] = static_cast<TType>(1) / a[k * TSize + k];
+
+        for (size_t i = k + 1; i < TSize; i++)
+        {
+            /*L coefficient is stored in place of the eliminated coefficient*/
+            const TType factor = a[i * TSize + k] * m_diagonalReciprocal[k];
+            a[i * TSize + k] = factor;
+
+            if (factor == static_cast<TType>(0))
+                continue;
+
+            for (size_t j = k + 1; j < TSize; j++)
+                a[i * TSize + j] -= factor * a[k * TSize + j];
+        }
+    }
+
+    Parent::m_isValid = true;
+}
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+template <size_t TRhsCount>
+inline constexpr
+void LUDecomposition<TSize, TType, TMatrixConvention>::solveInPlace (std::array<TType, TSize * TRhsCount>& rhs) const noexcept
+{
+    const std::array<TType, TSize * TSize>& a = Parent::m_factor;
+
+    /*P * b*/
+    std::array<TType, TSize * TRhsCount> y {};
+
+    for (size_t i = 0; i < TSize; i++)
+        for (size_t r = 0; r < TRhsCount; r++)
+            y[i * TRhsCount + r] = rhs[m_permutation[i] * TRhsCount + r];
+
+    /*L * y = P * b with L unit lower triangular*/
+    for (size_t i = 1; i < TSize; i++)
+        Parent::template substituteRow<TRhsCount>(y.data(), i, a.data() + i * TSize, 0, i, static_cast<TType>(1));
+
+    /*U * x = y*/
+    for (size_t i = TSize; i-- > 0;)
+        Parent::template substituteRow<TRhsCount>(y.data(), i, a.data() + i * TSize, i + 1, TSize, m_diagonalReciprocal[i]);
+
+    rhs = y;
+}
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+TType LUDecomposition<TSize, TType, TMatrixConvention>::getDeterminant () const noexcept
+{
+    if (!Parent::m_isValid)
+        return static_cast<TType>(0);
+
+    TType determinant = m_isPermutationOdd ? static_cast<TType>(-1) : static_cast<TType>(1);
+
+    for (size_t i = 0; i < TSize; i++)
+        determinant *= Parent::m_factor[i * TSize + i];
+
+    return determinant;
+}
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+SquareMatrix<TSize, TType, TMatrixConvention> LUDecomposition<TSize, TType, TMatrixConvention>::getReverse () const noexcept
+{
+    /*Solve A * X = I : identity is symmetric so its storage is the same in both conventions*/
+    SquareMatrix<TSize, TType, TMatrixConvention> identity;
+    identity.generateIdentity();
+
+    return Parent::solve(static_cast<const GenericMatrix<TSize, TSize, TType, TMatrixConvention>&>(identity));
+}
+
+#pragma endregion //!LUDecomposition
+
+#pragma region CholeskyDecomposition
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+constexpr inline
+CholeskyDecomposition<TSize, TType, TMatrixConvention>::CholeskyDecomposition (const SquareMatrix<TSize, TType, TMatrixConvention>& matrix) noexcept
+{
+    std::array<TType, TSize * TSize>& l = Parent::m_factor;
+    Parent::loadMatrix(matrix);
+
+    const TType tolerance = Parent::getSingularityTolerance(l);
+
+    for (size_t j = 0; j < TSize; j++)
+    {
+        TType diagonal = l[j * TSize + j];
+
+        for (size_t k = 0; k < j; k++)
+            diagonal -= l[j * TSize + k] * l[j * TSize + k];
+
+        /*Not positive definite (or singular)*/
+        if (diagonal <= tolerance)
+            return;
+
+        diagonal = Math::sqrt(diagonal);
+        l[j * TSize + j] = diagonal;
+        m_diagonalReciprocal[j] = static_cast<TType>(1) / diagonal;
+
+        for (size_t i = j + 1; i < TSize; i++)
+        {
+            TType sum = l[i * TSize + j];
+
+            for (size_t k = 0; k < j; k++)
+                sum -= l[i * TSize + k] * l[j * TSize + k];
+
+            l[i * TSize + j] = sum * m_diagonalReciprocal[j];
+        }
+    }
+
+    /*Upper triangle store transpose(L) for the backward substitution*/
+    for (size_t i = 0; i < TSize; i++)
+        for (size_t j = i + 1; j < TSize; j++)
+            l[i * TSize + j] = l[j * TSize + i];
+
+    Parent::m_isValid = true;
+}
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+template <size_t TRhsCount>
+inline constexpr
+void CholeskyDecomposition<TSize, TType, TMatrixConvention>::solveInPlace (std::array<TType, TSize * TRhsCount>& rhs) const noexcept
+{
+    const std::array<TType, TSize * TSize>& l = Parent::m_factor;
+
+    /*L * y = b*/
+    for (size_t i = 0; i < TSize; i++)
+        Parent::template substituteRow<TRhsCount>(rhs.data(), i, l.data() + i * TSize, 0, i, m_diagonalReciprocal[i]);
+
+    /*transpose(L) * x = y with transpose(L) stored in the upper triangle*/
+    for (size_t i = TSize; i-- > 0;)
+        Parent::template substituteRow<TRhsCount>(rhs.data(), i, l.data() + i * TSize, i + 1, TSize, m_diagonalReciprocal[i]);
+}
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+TType CholeskyDecomposition<TSize, TType, TMatrixConvention>::getDeterminant () const noexcept
+{
+    if (!Parent::m_isValid)
+        return static_cast<TType>(0);
+
+    TType product = static_cast<TType>(1);
+
+    for (size_t i = 0; i < TSize; i++)
+        product *= Parent::m_factor[i * TSize + i];
+
+    return product * product;
+}
+
+#pragma endregion //!CholeskyDecomposition
+
+#pragma region QRDecomposition
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+constexpr inline
+QRDecomposition<TSize, TType, TMatrixConvention>::QRDecomposition (const SquareMatrix<TSize, TType, TMatrixConvention>& matrix) noexcept
+{
+    std::array<TType, TSize * TSize>& a = Parent::m_factor;
+    Parent::loadMatrix(matrix);
+
+    const TType tolerance = Parent::getSingularityTolerance(a);
+    bool isFullRank = true;
+
+    for (size_t k = 0; k < TSize; k++)
+    {
+        TType squaredNorm = static_cast<TType>(0);
+
+        for (size_t i = k; i < TSize; i++)
+            squaredNorm += a[i * TSize + k] * a[i * TSize + k];
+
+        const TType norm = Math::sqrt(squaredNorm);
+
+        if (norm <= tolerance)
+        {
+            /*Nothing to eliminate : reflector is the identity*/
+            isFullRank = false;
+            m_tau[k] = static_cast<TType>(0);
+            continue;
+        }
+
+        /*Reflect x on alpha * e1 with the sign opposed to x0 to avoid cancellation in x0 - alpha*/
+        const TType x0 = a[k * TSize + k];
+        const TType alpha = x0 > static_cast<TType>(0) ? -norm : norm;
+        const TType v0Reciprocal = static_cast<TType>(1) / (x0 - alpha);
+
+        for (size_t i = k + 1; i < TSize; i++)
+            a[i * TSize + k] *= v0Reciprocal;
+
+        m_tau[k] = (alpha - x0) / alpha;
+        m_diagonalReciprocal[k] = static_cast<TType>(1) / alpha;
+        a[k * TSize + k] = alpha;
+
+        /*Apply reflector to the next columns*/
+        for (size_t j = k + 1; j < TSize; j++)
+        {
+            TType dot = a[k * TSize + j];
+
+            for (size_t i = k + 1; i < TSize; i++)
+                dot += a[i * TSize + k] * a[i * TSize + j];
+
+            dot *= m_tau[k];
+            a[k * TSize + j] -= dot;
+
+            for (size_t i = k + 1; i < TSize; i++)
+                a[i * TSize + j] -= dot * a[i * TSize + k];
+        }
+    }
+
+    Parent::m_isValid = isFullRank;
+}
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+template <size_t TRhsCount>
+inline constexpr
+void QRDecomposition<TSize, TType, TMatrixConvention>::solveInPlace (std::array<TType, TSize * TRhsCount>& rhs) const noexcept
+{
+    const std::array<TType, TSize * TSize>& a = Parent::m_factor;
+
+    /*y = transpose(Q) * b : apply each reflector I - tau * v * vt*/
+    for (size_t k = 0; k < TSize; k++)
+    {
+        if (m_tau[k] == static_cast<TType>(0))
+            continue;
+
+        /*dot = tau * vt * b with v0 = 1*/
+        std::array<TType, TRhsCount> dot {};
+
+        for (size_t r = 0; r < TRhsCount; r++)
+            dot[r] = rhs[k * TRhsCount + r];
+
+        for (size_t i = k + 1; i < TSize; i++)
+            Parent::template subtractScaledRow<TRhsCount>(dot.data(), -a[i * TSize + k], rhs.data() + i * TRhsCount);
+
+        Parent::template scaleRow<TRhsCount>(dot.data(), m_tau[k]);
+        Parent::template subtractScaledRow<TRhsCount>(rhs.data() + k * TRhsCount, static_cast<TType>(1), dot.data());
+
+        for (size_t i = k + 1; i < TSize; i++)
+            Parent::template subtractScaledRow<TRhsCount>(rhs.data() + i * TRhsCount, a[i * TSize + k], dot.data());
+    }
+
+    /*R * x = y*/
+    for (size_t i = TSize; i-- > 0;)
+        Parent::template substituteRow<TRhsCount>(rhs.data(), i, a.data() + i * TSize, i + 1, TSize, m_diagonalReciprocal[i]);
+}
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+TType QRDecomposition<TSize, TType, TMatrixConvention>::getAbsDeterminant () const noexcept
+{
+    TType determinant = static_cast<TType>(1);
+
+    for (size_t i = 0; i < TSize; i++)
+        determinant *= Math::abs(Parent::m_factor[i * TSize + i]);
+
+    return determinant;
+}
+
+#pragma endregion //!QRDecomposition
@@ -39,3 +39,4 @@
 #include "Matrix/Matrix2.hpp"
 #include "Matrix/Matrix3.hpp"
 #include "Matrix/Matrix4.hpp"
+#include "Matrix/Space/Transform.hpp"
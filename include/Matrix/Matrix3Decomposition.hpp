@@ -0,0 +1,670 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Matrix/Matrix3.hpp" //Matrix3
+#include "Vector/Vector3.hpp" //Vector3
+#include "Numeric/SIMD.hpp" //SIMD::Packet, SIMD::ScalarPacket
+#include "Thread/ParallelFor.hpp" //parallelFor
+
+#include <stddef.h> //sizt_t
+#include <limits> //std::numeric_limits
+#include <algorithm> //std::min
+#include <type_traits> //std::is_floating_point_v
+
+/**
+ * @brief Decompositions of 3*3 matrices : symmetric eigen decomposition (cyclic Jacobi), SVD and polar decomposition.
+ * Kernels are branch free with a fixed number of Jacobi sweeps, so the same code evaluate one matrix or a packet of
+ * matrices (SIMD::Packet lanes). Batch functions evaluate Packet::size matrices by step and split big batches across threads.
+ */
+namespace FoxMath
+{
+    /**
+     * @brief A = eigenvectors * diag(eigenvalues) * transpose(eigenvectors).
+     * Eigenvalues are sorted in descending order and eigenvectors are the columns of a rotation matrix.
+     */
+    template <typename TType = float, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+    struct SymmetricEigen3
+    {
+        Vec3<TType>                         eigenvalues;
+        Matrix3<TType, TMatrixConvention>   eigenvectors;
+    };
+
+    /**
+     * @brief A = u * diag(singularValues) * transpose(v) with u and v rotations.
+     * singularValues are sorted by decreasing absolute value. The last one is negative if det(A) < 0 (sign is kept in singular values instead of reflection in u or v).
+     */
+    template <typename TType = float, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+    struct SVD3
+    {
+        Matrix3<TType, TMatrixConvention>   u;
+        Vec3<TType>                         singularValues;
+        Matrix3<TType, TMatrixConvention>   v;
+    };
+
+    /**
+     * @brief A = rotation * stretch with stretch symmetric. Stretch is not positive if det(A) < 0 because rotation is always a rotation.
+     */
+    template <typename TType = float, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+    struct PolarDecomposition3
+    {
+        Matrix3<TType, TMatrixConvention>   rotation;
+        Matrix3<TType, TMatrixConvention>   stretch;
+    };
+
+    /**
+     * @brief Oriented box fitted on a set of points : axes are the columns of a rotation matrix and halfExtents are the half size along each axis
+     */
+    template <typename TType = float, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+    struct OrientedBoxFit3
+    {
+        Vec3<TType>                         center;
+        Matrix3<TType, TMatrixConvention>   axes;
+        Vec3<TType>                         halfExtents;
+    };
+
+    namespace Decomposition3
+    {
+        /**
+         * @brief Number of Jacobi sweeps (3 rotations by sweep). Jacobi converge quadratically so 4 sweeps reach float precision and 6 reach double precision
+         */
+        template <typename TType>
+        inline constexpr size_t defaultSweepCount = sizeof(TType) <= sizeof(float) ? 4 : 6;
+
+        /**
+         * @brief Branch free kernels on registers. a[i][j] is the coefficient of the row i and the column j.
+         * 
+         * @tparam TPacket : SIMD::Packet<TType> or SIMD::ScalarPacket<TType>
+         * @tparam TType 
+         */
+        template <typename TPacket, typename TType>
+        struct Kernel
+        {
+            using Reg = typename TPacket::Type;
+
+            static inline
+            Reg negate (Reg x) noexcept
+            {
+                return TPacket::sub(TPacket::set1(static_cast<TType>(0)), x);
+            }
+
+            /**
+             * @brief Jacobi rotation in the plane (p, q) that zero a[p][q]. a must be symmetric. The rotation is accumulated in the columns of v.
+             * t = tan(theta) is computed with the stable form 2 * apq * sign(d) / (|d| + sqrt(d^2 + 4 * apq^2)) with d = aqq - app. It is null if apq is null.
+             */
+            template <size_t p, size_t q>
+            static inline
+            void rotate (Reg (&a)[3][3], Reg (&v)[3][3]) noexcept
+            {
+                constexpr size_t r = 3 - p - q;
+
+                const Reg zero  = TPacket::set1(static_cast<TType>(0));
+                const Reg one   = TPacket::set1(static_cast<TType>(1));
+                const Reg two   = TPacket::set1(static_cast<TType>(2));
+
+                const Reg apq   = a[p][q];
+                const Reg d     = TPacket::sub(a[q][q], a[p][p]);
+                const Reg sign  = TPacket::selectIfLess(d, zero, negate(one), one);
+                const Reg root  = TPacket::sqrt(TPacket::mulAdd(TPacket::mul(d, d), TPacket::mul(two, two), TPacket::mul(apq, apq)));
+                const Reg denom = TPacket::add(TPacket::add(TPacket::abs(d), root), TPacket::set1(std::numeric_limits<TType>::min()));
+                const Reg t     = TPacket::div(TPacket::mul(TPacket::mul(two, apq), sign), denom);
+                const Reg c     = TPacket::div(one, TPacket::sqrt(TPacket::mulAdd(one, t, t)));
+                const Reg s     = TPacket::mul(t, c);
+
+                a[p][p] = TPacket::sub(a[p][p], TPacket::mul(t, apq));
+                a[q][q] = TPacket::mulAdd(a[q][q], t, apq);
+                a[p][q] = a[q][p] = zero;
+
+                const Reg arp = a[r][p];
+                const Reg arq = a[r][q];
+                a[r][p] = a[p][r] = TPacket::sub(TPacket::mul(c, arp), TPacket::mul(s, arq));
+                a[r][q] = a[q][r] = TPacket::mulAdd(TPacket::mul(c, arq), s, arp);
+
+                for (size_t k = 0; k < 3; k++)
+                {
+                    const Reg vkp = v[k][p];
+                    const Reg vkq = v[k][q];
+                    v[k][p] = TPacket::sub(TPacket::mul(c, vkp), TPacket::mul(s, vkq));
+                    v[k][q] = TPacket::mulAdd(TPacket::mul(c, vkq), s, vkp);
+                }
+            }
+
+            /**
+             * @brief Swap values i and j and columns i and j of v if values[i] < values[j]. Column j is negated to keep det(v) = 1
+             */
+            template <size_t i, size_t j>
+            static inline
+            void sortPair (Reg (&values)[3], Reg (&v)[3][3]) noexcept
+            {
+                const Reg valueI = values[i];
+                const Reg valueJ = values[j];
+                values[i] = TPacket::selectIfLess(valueI, valueJ, valueJ, valueI);
+                values[j] = TPacket::selectIfLess(valueI, valueJ, valueI, valueJ);
+
+                for (size_t k = 0; k < 3; k++)
+                {
+                    const Reg vki = v[k][i];
+                    const Reg vkj = v[k][j];
+                    v[k][i] = TPacket::selectIfLess(valueI, valueJ, vkj, vki);
+                    v[k][j] = TPacket::selectIfLess(valueI, valueJ, negate(vki), vkj);
+                }
+            }
+
+            /**
+             * @brief Eigen decomposition of the symmetric matrix a (only used as input). Eigenvalues are sorted in descending order.
+             */
+            template <size_t TSweepCount>
+            static inline
+            void symmetricEigen (Reg (&a)[3][3], Reg (&values)[3], Reg (&v)[3][3]) noexcept
+            {
+                for (size_t i = 0; i < 3; i++)
+                    for (size_t j = 0; j < 3; j++)
+                        v[i][j] = TPacket::set1(static_cast<TType>(i == j));
+
+                for (size_t sweep = 0; sweep < TSweepCount; sweep++)
+                {
+                    rotate<0, 1>(a, v);
+                    rotate<0, 2>(a, v);
+                    rotate<1, 2>(a, v);
+                }
+
+                for (size_t i = 0; i < 3; i++)
+                    values[i] = a[i][i];
+
+                sortPair<0, 1>(values, v);
+                sortPair<0, 2>(values, v);
+                sortPair<1, 2>(values, v);
+            }
+
+            /**
+             * @brief Givens rotation of the rows j and i of b that zero b[i][j]. The transposed rotation is accumulated in the columns of q so q * b stay constant.
+             */
+            template <size_t j, size_t i>
+            static inline
+            void givens (Reg (&b)[3][3], Reg (&q)[3][3]) noexcept
+            {
+                const Reg x         = b[j][j];
+                const Reg y         = b[i][j];
+                const Reg squared   = TPacket::mulAdd(TPacket::mul(x, x), y, y);
+                const Reg tiny      = TPacket::set1(std::numeric_limits<TType>::min());
+                const Reg inverse   = TPacket::div(TPacket::set1(static_cast<TType>(1)), TPacket::sqrt(TPacket::max(squared, tiny)));
+
+                /*Nothing to zero : identity*/
+                const Reg c = TPacket::selectIfLess(squared, tiny, TPacket::set1(static_cast<TType>(1)), TPacket::mul(x, inverse));
+                const Reg s = TPacket::selectIfLess(squared, tiny, TPacket::set1(static_cast<TType>(0)), TPacket::mul(y, inverse));
+
+                for (size_t k = 0; k < 3; k++)
+                {
+                    const Reg bj = b[j][k];
+                    const Reg bi = b[i][k];
+                    b[j][k] = TPacket::mulAdd(TPacket::mul(c, bj), s, bi);
+                    b[i][k] = TPacket::sub(TPacket::mul(c, bi), TPacket::mul(s, bj));
+
+                    const Reg qj = q[k][j];
+                    const Reg qi = q[k][i];
+                    q[k][j] = TPacket::mulAdd(TPacket::mul(c, qj), s, qi);
+                    q[k][i] = TPacket::sub(TPacket::mul(c, qi), TPacket::mul(s, qj));
+                }
+            }
+
+            /**
+             * @brief SVD of a : v is the eigenvectors of transpose(a) * a, then the Givens QR decomposition of a * v give u and the singular values
+             */
+            template <size_t TSweepCount>
+            static inline
+            void svd (const Reg (&a)[3][3], Reg (&u)[3][3], Reg (&sigma)[3], Reg (&v)[3][3]) noexcept
+            {
+                Reg ata[3][3];
+
+                for (size_t i = 0; i < 3; i++)
+                    for (size_t j = 0; j < 3; j++)
+                        ata[i][j] = TPacket::mulAdd(TPacket::mulAdd(TPacket::mul(a[0][i], a[0][j]), a[1][i], a[1][j]), a[2][i], a[2][j]);
+
+                Reg eigenvalues[3];
+                symmetricEigen<TSweepCount>(ata, eigenvalues, v);
+
+                Reg b[3][3];
+
+                for (size_t i = 0; i < 3; i++)
+                    for (size_t j = 0; j < 3; j++)
+                        b[i][j] = TPacket::mulAdd(TPacket::mulAdd(TPacket::mul(a[i][0], v[0][j]), a[i][1], v[1][j]), a[i][2], v[2][j]);
+
+                for (size_t i = 0; i < 3; i++)
+                    for (size_t j = 0; j < 3; j++)
+                        u[i][j] = TPacket::set1(static_cast<TType>(i == j));
+
+                givens<0, 1>(b, u);
+                givens<0, 2>(b, u);
+                givens<1, 2>(b, u);
+
+                for (size_t i = 0; i < 3; i++)
+                    sigma[i] = b[i][i];
+            }
+
+            /**
+             * @brief rotation = u * transpose(v) and stretch = v * diag(sigma) * transpose(v)
+             */
+            template <size_t TSweepCount>
+            static inline
+            void polar (const Reg (&a)[3][3], Reg (&rotation)[3][3], Reg (&stretch)[3][3]) noexcept
+            {
+                Reg u[3][3], sigma[3], v[3][3];
+                svd<TSweepCount>(a, u, sigma, v);
+
+                for (size_t i = 0; i < 3; i++)
+                {
+                    for (size_t j = 0; j < 3; j++)
+                    {
+                        rotation[i][j] = TPacket::mulAdd(TPacket::mulAdd(TPacket::mul(u[i][0], v[j][0]), u[i][1], v[j][1]), u[i][2], v[j][2]);
+                        stretch[i][j] = TPacket::mulAdd(TPacket::mulAdd(TPacket::mul(TPacket::mul(v[i][0], sigma[0]), v[j][0]),
+                                                                        TPacket::mul(v[i][1], sigma[1]), v[j][1]),
+                                                                        TPacket::mul(v[i][2], sigma[2]), v[j][2]);
+                    }
+                }
+            }
+        };
+
+        /**
+         * @brief Return the coefficient of the row i and the column j in function of the matrix convention
+         */
+        template <typename TType, EMatrixConvention TMatrixConvention>
+        [[nodiscard]] inline constexpr
+        TType getCoefficient (const Matrix3<TType, TMatrixConvention>& matrix, size_t i, size_t j) noexcept
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                return matrix.getData(i, j);
+            else
+                return matrix.getData(j, i);
+        }
+
+        template <typename TType, EMatrixConvention TMatrixConvention>
+        inline constexpr
+        void setCoefficient (Matrix3<TType, TMatrixConvention>& matrix, size_t i, size_t j, TType value) noexcept
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                matrix.getData(i, j) = value;
+            else
+                matrix.getData(j, i) = value;
+        }
+
+        template <typename TType, EMatrixConvention TMatrixConvention>
+        inline
+        void load (const Matrix3<TType, TMatrixConvention>& matrix, TType (&a)[3][3]) noexcept
+        {
+            for (size_t i = 0; i < 3; i++)
+                for (size_t j = 0; j < 3; j++)
+                    a[i][j] = getCoefficient(matrix, i, j);
+        }
+
+        template <typename TType, EMatrixConvention TMatrixConvention>
+        [[nodiscard]] inline
+        Matrix3<TType, TMatrixConvention> toMatrix (const TType (&a)[3][3]) noexcept
+        {
+            Matrix3<TType, TMatrixConvention> rst;
+
+            for (size_t i = 0; i < 3; i++)
+                for (size_t j = 0; j < 3; j++)
+                    setCoefficient(rst, i, j, a[i][j]);
+
+            return rst;
+        }
+
+        /**
+         * @brief Call functor(a, laneCount, index) with the matrices [index, index + Packet::size[ loaded in registers (a[i][j] contain the coefficient i, j of each lane).
+         * Missing lanes of the last packet are filled with identity. Big batches are split across threads.
+         */
+        template <typename TType, EMatrixConvention TMatrixConvention, typename TFunctor>
+        inline
+        void forEachPacket (const Matrix3<TType, TMatrixConvention>* matrices, size_t count, TFunctor&& functor) noexcept
+        {
+            using Packet = SIMD::Packet<TType>;
+
+            parallelFor(count, defaultParallelGrain / 64, [&](size_t begin, size_t end)
+            {
+                for (size_t index = begin; index < end; index += Packet::size)
+                {
+                    const size_t laneCount = std::min(Packet::size, end - index);
+
+                    alignas(64) TType lanes[3][3][Packet::size];
+
+                    for (size_t lane = 0; lane < Packet::size; lane++)
+                        for (size_t i = 0; i < 3; i++)
+                            for (size_t j = 0; j < 3; j++)
+                                lanes[i][j][lane] = (lane < laneCount) ? getCoefficient(matrices[index + lane], i, j) : static_cast<TType>(i == j);
+
+                    typename Packet::Type a[3][3];
+
+                    for (size_t i = 0; i < 3; i++)
+                        for (size_t j = 0; j < 3; j++)
+                            a[i][j] = Packet::load(lanes[i][j]);
+
+                    functor(a, laneCount, index);
+                }
+            });
+        }
+
+        /**
+         * @brief Store the coefficient i, j of each register lane in lanes[i][j]
+         */
+        template <typename TPacket, typename TType>
+        inline
+        void storeLanes (const typename TPacket::Type (&a)[3][3], TType (&lanes)[3][3][TPacket::size]) noexcept
+        {
+            for (size_t i = 0; i < 3; i++)
+                for (size_t j = 0; j < 3; j++)
+                    TPacket::store(lanes[i][j], a[i][j]);
+        }
+
+    } /*namespace FoxMath::Decomposition3*/
+
+    #pragma region single matrix
+
+    /**
+     * @brief Eigen decomposition of symmetric matrix with cyclic Jacobi. Only the symmetric part of matrix is used.
+     * @example `SymmetricEigen3<float> principalAxes = getSymmetricEigen(inertiaTensor);`
+     * 
+     * @tparam TSweepCount : fixed number of Jacobi sweeps
+     * @param matrix : symmetric matrix
+     * @return SymmetricEigen3<TType, TMatrixConvention> 
+     */
+    template <size_t TSweepCount = 0, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] inline
+    SymmetricEigen3<TType, TMatrixConvention> getSymmetricEigen (const Matrix3<TType, TMatrixConvention>& matrix) noexcept
+    {
+        static_assert(std::is_floating_point_v<TType>, "Decomposition needs floating point type");
+        constexpr size_t sweepCount = TSweepCount ? TSweepCount : Decomposition3::defaultSweepCount<TType>;
+
+        TType a[3][3], values[3], v[3][3];
+        Decomposition3::load(matrix, a);
+        Decomposition3::Kernel<SIMD::ScalarPacket<TType>, TType>::template symmetricEigen<sweepCount>(a, values, v);
+
+        return {Vec3<TType>(values[0], values[1], values[2]), Decomposition3::toMatrix<TType, TMatrixConvention>(v)};
+    }
+
+    /**
+     * @brief Singular value decomposition : matrix = u * diag(singularValues) * transpose(v). u and v are rotations.
+     * @note Singular values come from the eigenvalues of transpose(A) * A : relative precision of singular values much smaller than the biggest one is reduced.
+     * 
+     * @tparam TSweepCount : fixed number of Jacobi sweeps
+     * @param matrix 
+     * @return SVD3<TType, TMatrixConvention> 
+     */
+    template <size_t TSweepCount = 0, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] inline
+    SVD3<TType, TMatrixConvention> getSVD (const Matrix3<TType, TMatrixConvention>& matrix) noexcept
+    {
+        static_assert(std::is_floating_point_v<TType>, "Decomposition needs floating point type");
+        constexpr size_t sweepCount = TSweepCount ? TSweepCount : Decomposition3::defaultSweepCount<TType>;
+
+        TType a[3][3], u[3][3], sigma[3], v[3][3];
+        Decomposition3::load(matrix, a);
+        Decomposition3::Kernel<SIMD::ScalarPacket<TType>, TType>::template svd<sweepCount>(a, u, sigma, v);
+
+        return {Decomposition3::toMatrix<TType, TMatrixConvention>(u), Vec3<TType>(sigma[0], sigma[1], sigma[2]), Decomposition3::toMatrix<TType, TMatrixConvention>(v)};
+    }
+
+    /**
+     * @brief Polar decomposition : matrix = rotation * stretch. Used to extract the rotation of a deformation gradient (shape matching, corotational FEM)
+     * 
+     * @tparam TSweepCount : fixed number of Jacobi sweeps
+     * @param matrix 
+     * @return PolarDecomposition3<TType, TMatrixConvention> 
+     */
+    template <size_t TSweepCount = 0, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] inline
+    PolarDecomposition3<TType, TMatrixConvention> getPolarDecomposition (const Matrix3<TType, TMatrixConvention>& matrix) noexcept
+    {
+        static_assert(std::is_floating_point_v<TType>, "Decomposition needs floating point type");
+        constexpr size_t sweepCount = TSweepCount ? TSweepCount : Decomposition3::defaultSweepCount<TType>;
+
+        TType a[3][3], rotation[3][3], stretch[3][3];
+        Decomposition3::load(matrix, a);
+        Decomposition3::Kernel<SIMD::ScalarPacket<TType>, TType>::template polar<sweepCount>(a, rotation, stretch);
+
+        return {Decomposition3::toMatrix<TType, TMatrixConvention>(rotation), Decomposition3::toMatrix<TType, TMatrixConvention>(stretch)};
+    }
+
+    /**
+     * @brief Fit an oriented box on points : axes are the principal axes of the covariance of the points and the box is the bounds of the points projected on them.
+     * @example `OrientedBoxFit3<float> box = fitOrientedBox(vertices.data(), vertices.size());`
+     * 
+     * @param points 
+     * @param count : must be greater than 0
+     * @return OrientedBoxFit3<TType, TMatrixConvention> 
+     */
+    template <EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor, typename TType>
+    [[nodiscard]] inline
+    OrientedBoxFit3<TType, TMatrixConvention> fitOrientedBox (const Vec3<TType>* points, size_t count) noexcept
+    {
+        assert(count > 0);
+
+        TType mean[3] {};
+
+        for (size_t index = 0; index < count; index++)
+            for (size_t i = 0; i < 3; i++)
+                mean[i] += points[index][i];
+
+        for (size_t i = 0; i < 3; i++)
+            mean[i] /= static_cast<TType>(count);
+
+        /*Covariance : scale doesn't change the eigenvectors so it's not divided by count*/
+        TType covariance[3][3] {};
+
+        for (size_t index = 0; index < count; index++)
+        {
+            const TType delta[3] {points[index][0] - mean[0], points[index][1] - mean[1], points[index][2] - mean[2]};
+
+            for (size_t i = 0; i < 3; i++)
+                for (size_t j = i; j < 3; j++)
+                    covariance[i][j] += delta[i] * delta[j];
+        }
+
+        for (size_t i = 0; i < 3; i++)
+            for (size_t j = 0; j < i; j++)
+                covariance[i][j] = covariance[j][i];
+
+        TType values[3], axes[3][3];
+        Decomposition3::Kernel<SIMD::ScalarPacket<TType>, TType>::template symmetricEigen<Decomposition3::defaultSweepCount<TType>>(covariance, values, axes);
+
+        TType minProjection[3], maxProjection[3];
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            minProjection[i] = std::numeric_limits<TType>::max();
+            maxProjection[i] = std::numeric_limits<TType>::lowest();
+        }
+
+        for (size_t index = 0; index < count; index++)
+        {
+            for (size_t i = 0; i < 3; i++)
+            {
+                const TType projection = points[index][0] * axes[0][i] + points[index][1] * axes[1][i] + points[index][2] * axes[2][i];
+                minProjection[i] = std::min(minProjection[i], projection);
+                maxProjection[i] = std::max(maxProjection[i], projection);
+            }
+        }
+
+        TType center[3] {};
+        
+        for (size_t i = 0; i < 3; i++)
+        {
+            const TType middle = (minProjection[i] + maxProjection[i]) * static_cast<TType>(0.5);
+
+            for (size_t k = 0; k < 3; k++)
+                center[k] += axes[k][i] * middle;
+        }
+
+        return {Vec3<TType>(center[0], center[1], center[2]),
+                Decomposition3::toMatrix<TType, TMatrixConvention>(axes),
+                Vec3<TType>((maxProjection[0] - minProjection[0]) * static_cast<TType>(0.5),
+                            (maxProjection[1] - minProjection[1]) * static_cast<TType>(0.5),
+                            (maxProjection[2] - minProjection[2]) * static_cast<TType>(0.5))};
+    }
+
+    #pragma endregion //!single matrix
+
+    #pragma region batch
+
+    /**
+     * @brief Eigen decomposition of count symmetric matrices. Packet::size matrices are evaluated together (4 with SSE/NEON, 8 with AVX)
+     * 
+     * @tparam TSweepCount : fixed number of Jacobi sweeps
+     * @param matrices 
+     * @param rst 
+     * @param count 
+     */
+    template <size_t TSweepCount = 0, typename TType, EMatrixConvention TMatrixConvention>
+    inline
+    void computeSymmetricEigen (const Matrix3<TType, TMatrixConvention>* matrices, SymmetricEigen3<TType, TMatrixConvention>* rst, size_t count) noexcept
+    {
+        static_assert(std::is_floating_point_v<TType>, "Decomposition needs floating point type");
+        constexpr size_t sweepCount = TSweepCount ? TSweepCount : Decomposition3::defaultSweepCount<TType>;
+
+        using Packet = SIMD::Packet<TType>;
+
+        Decomposition3::forEachPacket(matrices, count, [&](typename Packet::Type (&a)[3][3], size_t laneCount, size_t index)
+        {
+            typename Packet::Type values[3], v[3][3];
+            Decomposition3::Kernel<Packet, TType>::template symmetricEigen<sweepCount>(a, values, v);
+
+            alignas(64) TType valueLanes[3][Packet::size];
+            alignas(64) TType vLanes[3][3][Packet::size];
+
+            for (size_t i = 0; i < 3; i++)
+                Packet::store(valueLanes[i], values[i]);
+
+            Decomposition3::storeLanes<Packet>(v, vLanes);
+
+            for (size_t lane = 0; lane < laneCount; lane++)
+            {
+                SymmetricEigen3<TType, TMatrixConvention>& result = rst[index + lane];
+                result.eigenvalues = Vec3<TType>(valueLanes[0][lane], valueLanes[1][lane], valueLanes[2][lane]);
+
+                for (size_t i = 0; i < 3; i++)
+                    for (size_t j = 0; j < 3; j++)
+                        Decomposition3::setCoefficient(result.eigenvectors, i, j, vLanes[i][j][lane]);
+            }
+        });
+    }
+
+    /**
+     * @brief SVD of count matrices. Packet::size matrices are evaluated together (4 with SSE/NEON, 8 with AVX)
+     * 
+     * @tparam TSweepCount : fixed number of Jacobi sweeps
+     * @param matrices 
+     * @param rst 
+     * @param count 
+     */
+    template <size_t TSweepCount = 0, typename TType, EMatrixConvention TMatrixConvention>
+    inline
+    void computeSVD (const Matrix3<TType, TMatrixConvention>* matrices, SVD3<TType, TMatrixConvention>* rst, size_t count) noexcept
+    {
+        static_assert(std::is_floating_point_v<TType>, "Decomposition needs floating point type");
+        constexpr size_t sweepCount = TSweepCount ? TSweepCount : Decomposition3::defaultSweepCount<TType>;
+
+        using Packet = SIMD::Packet<TType>;
+
+        Decomposition3::forEachPacket(matrices, count, [&](typename Packet::Type (&a)[3][3], size_t laneCount, size_t index)
+        {
+            typename Packet::Type u[3][3], sigma[3], v[3][3];
+            Decomposition3::Kernel<Packet, TType>::template svd<sweepCount>(a, u, sigma, v);
+
+            alignas(64) TType uLanes[3][3][Packet::size];
+            alignas(64) TType sigmaLanes[3][Packet::size];
+            alignas(64) TType vLanes[3][3][Packet::size];
+
+            for (size_t i = 0; i < 3; i++)
+                Packet::store(sigmaLanes[i], sigma[i]);
+
+            Decomposition3::storeLanes<Packet>(u, uLanes);
+            Decomposition3::storeLanes<Packet>(v, vLanes);
+
+            for (size_t lane = 0; lane < laneCount; lane++)
+            {
+                SVD3<TType, TMatrixConvention>& result = rst[index + lane];
+                result.singularValues = Vec3<TType>(sigmaLanes[0][lane], sigmaLanes[1][lane], sigmaLanes[2][lane]);
+
+                for (size_t i = 0; i < 3; i++)
+                {
+                    for (size_t j = 0; j < 3; j++)
+                    {
+                        Decomposition3::setCoefficient(result.u, i, j, uLanes[i][j][lane]);
+                        Decomposition3::setCoefficient(result.v, i, j, vLanes[i][j][lane]);
+                    }
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Polar decomposition of count matrices. Packet::size matrices are evaluated together (4 with SSE/NEON, 8 with AVX)
+     * 
+     * @tparam TSweepCount : fixed number of Jacobi sweeps
+     * @param matrices 
+     * @param rst 
+     * @param count 
+     */
+    template <size_t TSweepCount = 0, typename TType, EMatrixConvention TMatrixConvention>
+    inline
+    void computePolarDecomposition (const Matrix3<TType, TMatrixConvention>* matrices, PolarDecomposition3<TType, TMatrixConvention>* rst, size_t count) noexcept
+    {
+        static_assert(std::is_floating_point_v<TType>, "Decomposition needs floating point type");
+        constexpr size_t sweepCount = TSweepCount ? TSweepCount : Decomposition3::defaultSweepCount<TType>;
+
+        using Packet = SIMD::Packet<TType>;
+
+        Decomposition3::forEachPacket(matrices, count, [&](typename Packet::Type (&a)[3][3], size_t laneCount, size_t index)
+        {
+            typename Packet::Type rotation[3][3], stretch[3][3];
+            Decomposition3::Kernel<Packet, TType>::template polar<sweepCount>(a, rotation, stretch);
+
+            alignas(64) TType rotationLanes[3][3][Packet::size];
+            alignas(64) TType stretchLanes[3][3][Packet::size];
+
+            Decomposition3::storeLanes<Packet>(rotation, rotationLanes);
+            Decomposition3::storeLanes<Packet>(stretch, stretchLanes);
+
+            for (size_t lane = 0; lane < laneCount; lane++)
+            {
+                for (size_t i = 0; i < 3; i++)
+                {
+                    for (size_t j = 0; j < 3; j++)
+                    {
+                        Decomposition3::setCoefficient(rst[index + lane].rotation, i, j, rotationLanes[i][j][lane]);
+                        Decomposition3::setCoefficient(rst[index + lane].stretch, i, j, stretchLanes[i][j][lane]);
+                    }
+                }
+            }
+        });
+    }
+
+    #pragma endregion //!batch
+
+} /*namespace FoxMath*/
@@ -33,9 +33,27 @@
 #include "Vector/Vector3.hpp"
 #include "Macro/CrossInheritanceCompatibility.hpp"
 #include "Angle/Angle.hpp"
+#include "Numeric/Math.hpp" //Math::sincos, Math::tan
+#include "Numeric/EPrecision.hpp" //EPrecision
+#include "Matrix/MatrixKernel.hpp" //MatrixKernel::transformVectors, MatrixKernel::decomposeLinear
+#include "Thread/ParallelFor.hpp" //parallelFor
+#include "Quaternion/Quaternion.hpp" //Quaternion::createFromRotationMatrix
+
+#include <type_traits> //std::is_base_of_v
 
 namespace FoxMath
 {
+    /**
+     * @brief Affine matrix = translation * rotation * scale in math notation. See Matrix4::decomposeTRS
+     */
+    template <typename TType = float>
+    struct TRSDecomposition
+    {
+        Vec3<TType>         translation;
+        Quaternion<TType>   rotation    = Quaternion<TType>::identity;
+        Vec3<TType>         scale;
+    };
+
     template <typename TType = float, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
     class Matrix4 :  public SquareMatrix<4, TType, TMatrixConvention>
     {
@@ -49,6 +67,145 @@ namespace FoxMath
         #pragma endregion //!attribut
 
         #pragma region methods
+
+        /**
+         * @brief Return the index in data of the element at row and column in math notation, in function of the matrix convention.
+         * 
+         * @param row 
+         * @param column 
+         * @return constexpr size_t 
+         */
+        [[nodiscard]] static inline constexpr
+        size_t elementIndex (size_t row, size_t column) noexcept
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                return row * 4 + column;
+            else
+                return column * 4 + row;
+        }
+
+        /**
+         * @brief Store the affine matrix made with linear part and translation. Last row is set to (0, 0, 0, 1).
+         * 
+         * @param linear : 3*3 linear part in row major math notation
+         * @param translation 
+         */
+        inline constexpr
+        void setAffine (const std::array<TType, 9>& linear, const std::array<TType, 3>& translation) noexcept
+        {
+            for (size_t row = 0; row < 3; row++)
+            {
+                for (size_t column = 0; column < 3; column++)
+                {
+                    Parent::m_data[elementIndex(row, column)] = linear[row * 3 + column];
+                }
+
+                Parent::m_data[elementIndex(row, 3)] = translation[row];
+                Parent::m_data[elementIndex(3, row)] = static_cast<TType>(0);
+            }
+
+            Parent::m_data[15] = static_cast<TType>(1);
+        }
+
+        /**
+         * @brief Return the 4 columns of the matrix in math notation, one after the other.
+         * 
+         * @return constexpr std::array<TType, 16> 
+         */
+        [[nodiscard]] inline constexpr
+        std::array<TType, 16> getColumns () const noexcept
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
+            {
+                return Parent::m_data;
+            }
+            else
+            {
+                std::array<TType, 16> columns {};
+
+                for (size_t column = 0; column < 4; column++)
+                    for (size_t row = 0; row < 4; row++)
+                        columns[column * 4 + row] = Parent::m_data[row * 4 + column];
+
+                return columns;
+            }
+        }
+
+        /**
+         * @brief Return the columns of the normal matrix : the inverse transpose of the linear part 3*3. Last column and last row are null.
+         * If the linear part is not reversible, all columns are null.
+         * 
+         * @return constexpr std::array<TType, 16> 
+         */
+        [[nodiscard]] inline constexpr
+        std::array<TType, 16> getNormalColumns () const noexcept
+        {
+            const std::array<TType, 16>& m = Parent::m_data;
+
+            const TType a00 = m[elementIndex(0, 0)], a01 = m[elementIndex(0, 1)], a02 = m[elementIndex(0, 2)];
+            const TType a10 = m[elementIndex(1, 0)], a11 = m[elementIndex(1, 1)], a12 = m[elementIndex(1, 2)];
+            const TType a20 = m[elementIndex(2, 0)], a21 = m[elementIndex(2, 1)], a22 = m[elementIndex(2, 2)];
+
+            /*inverse transpose = cofactor matrix / determinant*/
+            std::array<TType, 16> columns {a11 * a22 - a12 * a21, a02 * a21 - a01 * a22, a01 * a12 - a02 * a11, static_cast<TType>(0),
+                                           a12 * a20 - a10 * a22, a00 * a22 - a02 * a20, a02 * a10 - a00 * a12, static_cast<TType>(0),
+                                           a10 * a21 - a11 * a20, a01 * a20 - a00 * a21, a00 * a11 - a01 * a10, static_cast<TType>(0),
+                                           static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(0)};
+
+            const TType determinant = a00 * columns[0] + a01 * columns[4] + a02 * columns[8];
+
+            if (isSameAsZero<TType>(determinant))
+                return {};
+
+            const TType determinantReciprocal = static_cast<TType>(1) / determinant;
+
+            for (TType& coef : columns)
+                coef *= determinantReciprocal;
+
+            return columns;
+        }
+
+        /**
+         * @brief Transform the vectors with MatrixKernel::transformVectors. Big buffers are split across threads with parallelFor.
+         * 
+         * @tparam TInputLength 
+         * @tparam TOutputLength 
+         * @tparam TUseTranslation 
+         * @tparam THomogenize 
+         * @param columns 
+         * @param src 
+         * @param srcStride 
+         * @param dst 
+         * @param dstStride 
+         * @param count 
+         */
+        template <size_t TInputLength, size_t TOutputLength, bool TUseTranslation, bool THomogenize>
+        static inline
+        void transformVectorsParallel (const std::array<TType, 16>& columns, const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) noexcept
+        {
+            parallelFor(count, defaultParallelGrain, [&](size_t begin, size_t end)
+            {
+                MatrixKernel::transformVectors<TInputLength, TOutputLength, TUseTranslation, THomogenize>(columns, src + begin * srcStride, srcStride, dst + begin * dstStride, dstStride, end - begin);
+            });
+        }
+
+        /**
+         * @brief Return the stride in TType of an array of TVector. Check that TVector is a GenericVector of TLength TType without other attribut.
+         * 
+         * @tparam TVector 
+         * @tparam TLength 
+         * @return constexpr size_t 
+         */
+        template <typename TVector, size_t TLength>
+        [[nodiscard]] static inline constexpr
+        size_t vectorStride () noexcept
+        {
+            static_assert(std::is_base_of_v<GenericVector<TLength, TType>, TVector>, "Vector must be a GenericVector with the same type than the matrix");
+            static_assert(sizeof(TVector) % sizeof(TType) == 0 && sizeof(TVector) >= TLength * sizeof(TType), "Vector layout must be an array of TType");
+
+            return sizeof(TVector) / sizeof(TType);
+        }
+
         #pragma endregion //!methods
 
         public:
@@ -78,10 +235,312 @@ namespace FoxMath
         #pragma endregion //!constructor/destructor
 
         #pragma region methods
+
+        /**
+         * @brief Reverse affine matrix (last row equal to (0, 0, 0, 1)) like TRS matrix.
+         * Only the linear part 3*3 is reversed and the translation become -inverse(linear) * translation.
+         * If the linear part is not reversible, matrix is fill with zero.
+         * 
+         * @return constexpr Matrix4& 
+         */
+        inline constexpr
+        Matrix4& affineReverse () noexcept
+        {
+            const std::array<TType, 16>& m = Parent::m_data;
+
+            const TType a00 = m[elementIndex(0, 0)], a01 = m[elementIndex(0, 1)], a02 = m[elementIndex(0, 2)];
+            const TType a10 = m[elementIndex(1, 0)], a11 = m[elementIndex(1, 1)], a12 = m[elementIndex(1, 2)];
+            const TType a20 = m[elementIndex(2, 0)], a21 = m[elementIndex(2, 1)], a22 = m[elementIndex(2, 2)];
+
+            const TType cofactor00 = a11 * a22 - a12 * a21;
+            const TType cofactor01 = a12 * a20 - a10 * a22;
+            const TType cofactor02 = a10 * a21 - a11 * a20;
+
+            const TType determinant = a00 * cofactor00 + a01 * cofactor01 + a02 * cofactor02;
+
+            if (isSameAsZero<TType>(determinant))
+            {
+                Parent::fill(static_cast<TType>(0));
+                return *this;
+            }
+
+            const TType determinantReciprocal = static_cast<TType>(1) / determinant;
+
+            const std::array<TType, 9> linear  {cofactor00 * determinantReciprocal, (a02 * a21 - a01 * a22) * determinantReciprocal, (a01 * a12 - a02 * a11) * determinantReciprocal,
+                                                cofactor01 * determinantReciprocal, (a00 * a22 - a02 * a20) * determinantReciprocal, (a02 * a10 - a00 * a12) * determinantReciprocal,
+                                                cofactor02 * determinantReciprocal, (a01 * a20 - a00 * a21) * determinantReciprocal, (a00 * a11 - a01 * a10) * determinantReciprocal};
+
+            const TType tx = m[elementIndex(0, 3)], ty = m[elementIndex(1, 3)], tz = m[elementIndex(2, 3)];
+
+            setAffine(linear, {-(linear[0] * tx + linear[1] * ty + linear[2] * tz),
+                               -(linear[3] * tx + linear[4] * ty + linear[5] * tz),
+                               -(linear[6] * tx + linear[7] * ty + linear[8] * tz)});
+            return *this;
+        }
+
+        /**
+         * @brief Return the reverse of affine matrix (last row equal to (0, 0, 0, 1)) like TRS matrix. See affineReverse
+         * 
+         * @return constexpr Matrix4 
+         */
+        [[nodiscard]] inline constexpr
+        Matrix4 getAffineReverse () const noexcept
+        {
+            Matrix4 rst (*this);
+            rst.affineReverse();
+            return rst;
+        }
+
+        /**
+         * @brief Reverse rigid matrix (rotation and translation only, without scale).
+         * The rotation part is transposed and the translation become -transpose(rotation) * translation.
+         * 
+         * @return constexpr Matrix4& 
+         */
+        inline constexpr
+        Matrix4& rigidReverse () noexcept
+        {
+            const std::array<TType, 16>& m = Parent::m_data;
+
+            const std::array<TType, 9> linear  {m[elementIndex(0, 0)], m[elementIndex(1, 0)], m[elementIndex(2, 0)],
+                                                m[elementIndex(0, 1)], m[elementIndex(1, 1)], m[elementIndex(2, 1)],
+                                                m[elementIndex(0, 2)], m[elementIndex(1, 2)], m[elementIndex(2, 2)]};
+
+            const TType tx = m[elementIndex(0, 3)], ty = m[elementIndex(1, 3)], tz = m[elementIndex(2, 3)];
+
+            setAffine(linear, {-(linear[0] * tx + linear[1] * ty + linear[2] * tz),
+                               -(linear[3] * tx + linear[4] * ty + linear[5] * tz),
+                               -(linear[6] * tx + linear[7] * ty + linear[8] * tz)});
+            return *this;
+        }
+
+        /**
+         * @brief Return the reverse of rigid matrix (rotation and translation only, without scale). See rigidReverse
+         * 
+         * @return constexpr Matrix4 
+         */
+        [[nodiscard]] inline constexpr
+        Matrix4 getRigidReverse () const noexcept
+        {
+            Matrix4 rst (*this);
+            rst.rigidReverse();
+            return rst;
+        }
+
+        /**
+         * @brief Decompose affine matrix (last row equal to (0, 0, 0, 1)) in translation, rotation and scale : matrix = translation * rotation * scale in math notation,
+         * like createTRSMatrix in row major. Shear is not supported. If the linear part contains a reflection, the scale on x is negative.
+         * If one scale is null, its axis is rebuilt with the cross product of the two others. If more than one scale is null, rotation is identity.
+         * Same result as Transform::decompose (see MatrixKernel::decomposeLinear).
+         * @note rotation.getRotationMatrix() * diag(scale) gives back the linear part.
+         *
+         * @return constexpr TRSDecomposition<TType>
+         */
+        [[nodiscard]] inline constexpr
+        TRSDecomposition<TType> decomposeTRS () const noexcept
+        {
+            const std::array<TType, 16>& m = Parent::m_data;
+
+            TRSDecomposition<TType> rst;
+            rst.translation = Vec3<TType>(m[elementIndex(0, 3)], m[elementIndex(1, 3)], m[elementIndex(2, 3)]);
+
+            /*axes[column][row]*/
+            TType axes[3][3] = {{m[elementIndex(0, 0)], m[elementIndex(1, 0)], m[elementIndex(2, 0)]},
+                                {m[elementIndex(0, 1)], m[elementIndex(1, 1)], m[elementIndex(2, 1)]},
+                                {m[elementIndex(0, 2)], m[elementIndex(1, 2)], m[elementIndex(2, 2)]}};
+            TType scales[3] {};
+            MatrixKernel::decomposeLinear(axes, scales);
+
+            rst.scale = Vec3<TType>(scales[0], scales[1], scales[2]);
+            rst.rotation = Quaternion<TType>::createFromRotationMatrix(axes[0][0], axes[1][0], axes[2][0],
+                                                                       axes[0][1], axes[1][1], axes[2][1],
+                                                                       axes[0][2], axes[1][2], axes[2][2]);
+            return rst;
+        }
+
+        /**
+         * @brief Transform count affine points (implicit w = 1, without division by w). Buffers are read and written with a stride in number of TType.
+         * src and dst can be the same buffer if strides are the same. Big buffers are split across threads.
+         * 
+         * @param src : x, y, z of each point
+         * @param srcStride : number of TType between two consecutive points in src. 3 for tightly packed points
+         * @param dst : x, y, z of each point
+         * @param dstStride : number of TType between two consecutive points in dst
+         * @param count 
+         */
+        inline
+        void transformPoints (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept
+        {
+            transformVectorsParallel<3, 3, true, false>(getColumns(), src, srcStride, dst, dstStride, count);
+        }
+
+        /**
+         * @brief Transform count affine points (implicit w = 1, without division by w). src and dst can be the same buffer.
+         * 
+         * @tparam TVector3 : Vec3 or GenericVector<3, TType>
+         * @param src 
+         * @param dst 
+         * @param count 
+         */
+        template <typename TVector3>
+        inline
+        void transformPoints (const TVector3* src, TVector3* dst, size_t count) const noexcept
+        {
+            constexpr size_t stride = vectorStride<TVector3, 3>();
+            transformPoints(reinterpret_cast<const TType*>(src), stride, reinterpret_cast<TType*>(dst), stride, count);
+        }
+
+        /**
+         * @brief Transform count directions (implicit w = 0 : translation is ignored). Buffers are read and written with a stride in number of TType.
+         * src and dst can be the same buffer if strides are the same. Big buffers are split across threads.
+         * 
+         * @param src : x, y, z of each direction
+         * @param srcStride : number of TType between two consecutive directions in src. 3 for tightly packed directions
+         * @param dst : x, y, z of each direction
+         * @param dstStride : number of TType between two consecutive directions in dst
+         * @param count 
+         */
+        inline
+        void transformDirections (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept
+        {
+            transformVectorsParallel<3, 3, false, false>(getColumns(), src, srcStride, dst, dstStride, count);
+        }
+
+        /**
+         * @brief Transform count directions (implicit w = 0 : translation is ignored). src and dst can be the same buffer.
+         * 
+         * @tparam TVector3 : Vec3 or GenericVector<3, TType>
+         * @param src 
+         * @param dst 
+         * @param count 
+         */
+        template <typename TVector3>
+        inline
+        void transformDirections (const TVector3* src, TVector3* dst, size_t count) const noexcept
+        {
+            constexpr size_t stride = vectorStride<TVector3, 3>();
+            transformDirections(reinterpret_cast<const TType*>(src), stride, reinterpret_cast<TType*>(dst), stride, count);
+        }
+
+        /**
+         * @brief Transform count normals with the inverse transpose of the linear part, computed once for all normals.
+         * Result is not normalized if matrix contains scale. Buffers are read and written with a stride in number of TType.
+         * src and dst can be the same buffer if strides are the same. Big buffers are split across threads.
+         * 
+         * @param src : x, y, z of each normal
+         * @param srcStride : number of TType between two consecutive normals in src. 3 for tightly packed normals
+         * @param dst : x, y, z of each normal
+         * @param dstStride : number of TType between two consecutive normals in dst
+         * @param count 
+         */
+        inline
+        void transformNormals (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept
+        {
+            transformVectorsParallel<3, 3, false, false>(getNormalColumns(), src, srcStride, dst, dstStride, count);
+        }
+
+        /**
+         * @brief Transform count normals with the inverse transpose of the linear part, computed once for all normals. src and dst can be the same buffer.
+         * 
+         * @tparam TVector3 : Vec3 or GenericVector<3, TType>
+         * @param src 
+         * @param dst 
+         * @param count 
+         */
+        template <typename TVector3>
+        inline
+        void transformNormals (const TVector3* src, TVector3* dst, size_t count) const noexcept
+        {
+            constexpr size_t stride = vectorStride<TVector3, 3>();
+            transformNormals(reinterpret_cast<const TType*>(src), stride, reinterpret_cast<TType*>(dst), stride, count);
+        }
+
+        /**
+         * @brief Transform count points with implicit w = 1 and homogenize the result (division by w). Use it with projection matrix.
+         * Buffers are read and written with a stride in number of TType.
+         * src and dst can be the same buffer if strides are the same. Big buffers are split across threads.
+         * 
+         * @param src : x, y, z of each point
+         * @param srcStride : number of TType between two consecutive points in src. 3 for tightly packed points
+         * @param dst : x, y, z of each point
+         * @param dstStride : number of TType between two consecutive points in dst
+         * @param count 
+         */
+        inline
+        void transformProjectivePoints (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept
+        {
+            transformVectorsParallel<3, 3, true, true>(getColumns(), src, srcStride, dst, dstStride, count);
+        }
+
+        /**
+         * @brief Transform count points with implicit w = 1 and homogenize the result (division by w). src and dst can be the same buffer.
+         * 
+         * @tparam TVector3 : Vec3 or GenericVector<3, TType>
+         * @param src 
+         * @param dst 
+         * @param count 
+         */
+        template <typename TVector3>
+        inline
+        void transformProjectivePoints (const TVector3* src, TVector3* dst, size_t count) const noexcept
+        {
+            constexpr size_t stride = vectorStride<TVector3, 3>();
+            transformProjectivePoints(reinterpret_cast<const TType*>(src), stride, reinterpret_cast<TType*>(dst), stride, count);
+        }
+
+        /**
+         * @brief Transform count homogeneous vectors of 4 components, without division by w. Buffers are read and written with a stride in number of TType.
+         * src and dst can be the same buffer if strides are the same. Big buffers are split across threads.
+         * 
+         * @param src : x, y, z, w of each vector
+         * @param srcStride : number of TType between two consecutive vectors in src. 4 for tightly packed vectors
+         * @param dst : x, y, z, w of each vector
+         * @param dstStride : number of TType between two consecutive vectors in dst
+         * @param count 
+         */
+        inline
+        void transformVectors (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept
+        {
+            transformVectorsParallel<4, 4, true, false>(getColumns(), src, srcStride, dst, dstStride, count);
+        }
+
+        /**
+         * @brief Transform count homogeneous vectors of 4 components, without division by w. src and dst can be the same buffer.
+         * 
+         * @tparam TVector4 : Vec4 or GenericVector<4, TType>
+         * @param src 
+         * @param dst 
+         * @param count 
+         */
+        template <typename TVector4>
+        inline
+        void transformVectors (const TVector4* src, TVector4* dst, size_t count) const noexcept
+        {
+            constexpr size_t stride = vectorStride<TVector4, 4>();
+            transformVectors(reinterpret_cast<const TType*>(src), stride, reinterpret_cast<TType*>(dst), stride, count);
+        }
+
         #pragma endregion //!methods
 
         #pragma region static methods
 
+        /**
+         * @brief Decompose each affine matrix in translation, rotation and scale. See decomposeTRS. Big buffers are split across threads.
+         *
+         * @param matrices
+         * @param dst : decomposition of matrices[i] at index i
+         * @param count
+         */
+        static inline
+        void decomposeTRS (const Matrix4* matrices, TRSDecomposition<TType>* dst, size_t count) noexcept
+        {
+            parallelFor(count, defaultParallelGrain, [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; i++)
+                    dst[i] = matrices[i].decomposeTRS();
+            });
+        }
+
         /**
          * @brief Create a Look At View objectreates a viewing matrix derived from an eye point, a reference point indicating the center of the scene, and an UP vector.
          * 
@@ -155,7 +614,7 @@ namespace FoxMath
             const TType one     {static_cast<TType>(1)};
             const TType two     {static_cast<TType>(2)};
 
-            const TType scale = std::tan(static_cast<TType>(fov) / two) * near;
+            const TType scale = Math::tan(static_cast<TType>(fov) / two) * near;
             const TType rigth = aspect * scale;
 
             const TType left   = -rigth;
@@ -199,14 +658,17 @@ namespace FoxMath
         /**
          * @brief Create rotation on X axis only
          * 
+         * @tparam TPrecision : EPrecision::Fast use minimax sin and cos, EPrecision::Table use the shared lookup table of Math::Table
          * @param rotRadz 
          * @return constexpr Matrix4 
          */
+        template <EPrecision TPrecision = EPrecision::Precise>
         [[nodiscard]] static constexpr inline 
         Matrix4 createXRotationMatrix		(Angle<EAngleType::Radian, TType> rotRadx) //rot of axis Y to axis Z arround X
         {
-            const TType cosT = std::cos(static_cast<TType>(rotRadx));
-            const TType sinT = std::sin(static_cast<TType>(rotRadx));
+            const Math::SinCos<Math::Real<TType>> sinCosT = rotRadx.template getSinCos<TPrecision>();
+            const TType cosT = static_cast<TType>(sinCosT.cos);
+            const TType sinT = static_cast<TType>(sinCosT.sin);
             const TType zero  = static_cast<TType>(0);
             const TType one  = static_cast<TType>(1);
 
@@ -219,14 +681,17 @@ namespace FoxMath
         /**
          * @brief Create rotation on Y axis only
          * 
+         * @tparam TPrecision : EPrecision::Fast use minimax sin and cos, EPrecision::Table use the shared lookup table of Math::Table
          * @param rotRadz 
          * @return constexpr Matrix4 
          */
+        template <EPrecision TPrecision = EPrecision::Precise>
         [[nodiscard]] static constexpr inline 
         Matrix4 createYRotationMatrix		(Angle<EAngleType::Radian, TType> rotRady) //rot of axis Z to axis X arround Y
         {
-            const TType cosT = std::cos(static_cast<TType>(rotRady));
-            const TType sinT = std::sin(static_cast<TType>(rotRady));
+            const Math::SinCos<Math::Real<TType>> sinCosT = rotRady.template getSinCos<TPrecision>();
+            const TType cosT = static_cast<TType>(sinCosT.cos);
+            const TType sinT = static_cast<TType>(sinCosT.sin);
             const TType zero  = static_cast<TType>(0);
             const TType one  = static_cast<TType>(1);
 
@@ -239,14 +704,17 @@ namespace FoxMath
         /**
          * @brief Create rotation on Z axis only
          * 
+         * @tparam TPrecision : EPrecision::Fast use minimax sin and cos, EPrecision::Table use the shared lookup table of Math::Table
          * @param rotRadz 
          * @return constexpr Matrix4 
          */
+        template <EPrecision TPrecision = EPrecision::Precise>
         [[nodiscard]] static constexpr inline 
         Matrix4 createZRotationMatrix		(Angle<EAngleType::Radian, TType> rotRadz) //rot of axis X to axis Y arround Z
         {
-            const TType cosT = std::cos(static_cast<TType>(rotRadz));
-            const TType sinT = std::sin(static_cast<TType>(rotRadz));
+            const Math::SinCos<Math::Real<TType>> sinCosT = rotRadz.template getSinCos<TPrecision>();
+            const TType cosT = static_cast<TType>(sinCosT.cos);
+            const TType sinT = static_cast<TType>(sinCosT.sin);
             const TType zero  = static_cast<TType>(0);
             const TType one  = static_cast<TType>(1);
 
@@ -259,18 +727,23 @@ namespace FoxMath
         /**
          * @brief Create a Fixed Angle Euler Rotation Matrix object
          * 
+         * @tparam TPrecision : EPrecision::Fast use minimax sin and cos, EPrecision::Table use the shared lookup table of Math::Table
          * @param rVec 
          * @return constexpr Matrix4 
          */
+        template <EPrecision TPrecision = EPrecision::Precise>
         [[nodiscard]] static constexpr inline //TODO: Transform (space an right and and left hand referential!)
         Matrix4 createFixedAngleEulerRotationMatrix	(const Vec3<TType>& rVec)
         {
-            const TType cosTX = std::cos(static_cast<TType>(rVec.getX()));
-            const TType sinTX = std::sin(static_cast<TType>(rVec.getX()));
-            const TType cosTY = std::cos(static_cast<TType>(rVec.getY()));
-            const TType sinTY = std::sin(static_cast<TType>(rVec.getY()));
-            const TType cosTZ = std::cos(static_cast<TType>(rVec.getZ()));
-            const TType sinTZ = std::sin(static_cast<TType>(rVec.getZ()));
+            const Math::SinCos<Math::Real<TType>> sinCosTX = Math::sincos<TPrecision>(static_cast<TType>(rVec.getX()));
+            const Math::SinCos<Math::Real<TType>> sinCosTY = Math::sincos<TPrecision>(static_cast<TType>(rVec.getY()));
+            const Math::SinCos<Math::Real<TType>> sinCosTZ = Math::sincos<TPrecision>(static_cast<TType>(rVec.getZ()));
+            const TType cosTX = static_cast<TType>(sinCosTX.cos);
+            const TType sinTX = static_cast<TType>(sinCosTX.sin);
+            const TType cosTY = static_cast<TType>(sinCosTY.cos);
+            const TType sinTY = static_cast<TType>(sinCosTY.sin);
+            const TType cosTZ = static_cast<TType>(sinCosTZ.cos);
+            const TType sinTZ = static_cast<TType>(sinCosTZ.sin);
             const TType zero  = static_cast<TType>(0);
             const TType one  = static_cast<TType>(1);
 
@@ -294,23 +767,29 @@ namespace FoxMath
         /**
          * @brief Create TRS matrix based on translation/rotation/Scale step. This matrix is differente than SRT
          * 
+         * @tparam TPrecision : EPrecision::Fast use minimax sin and cos, EPrecision::Table use the shared lookup table of Math::Table
          * @param translVec 
          * @param rotVec 
          * @param scaleVec 
          * @return constexpr Matrix4 
          */
+        template <EPrecision TPrecision = EPrecision::Precise>
         [[nodiscard]] static constexpr inline
         Matrix4 createTRSMatrix(const Vec3<TType>& translVec, const Vec3<TType>& rotVec, const Vec3<TType>& scaleVec)
         {
             if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
             {
-                const TType cosTX = std::cos(static_cast<TType>(rotVec.getX()));
-                const TType cosTY = std::cos(static_cast<TType>(rotVec.getY()));
-                const TType cosTZ = std::cos(static_cast<TType>(rotVec.getZ()));
+                const Math::SinCos<Math::Real<TType>> sinCosTX = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getX()));
+                const Math::SinCos<Math::Real<TType>> sinCosTY = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getY()));
+                const Math::SinCos<Math::Real<TType>> sinCosTZ = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getZ()));
+
+                const TType cosTX = static_cast<TType>(sinCosTX.cos);
+                const TType cosTY = static_cast<TType>(sinCosTY.cos);
+                const TType cosTZ = static_cast<TType>(sinCosTZ.cos);
 
-                const TType sinTX = std::sin(static_cast<TType>(rotVec.getX()));
-                const TType sinTY = std::sin(static_cast<TType>(rotVec.getY()));
-                const TType sinTZ = std::sin(static_cast<TType>(rotVec.getZ()));
+                const TType sinTX = static_cast<TType>(sinCosTX.sin);
+                const TType sinTY = static_cast<TType>(sinCosTY.sin);
+                const TType sinTZ = static_cast<TType>(sinCosTZ.sin);
 
                 const TType zero  = static_cast<TType>(0);
                 const TType one  = static_cast<TType>(1);
@@ -336,13 +815,17 @@ namespace FoxMath
             }
             else
             {
-                const TType cosTX = std::cos(static_cast<TType>(rotVec.getX()));
-                const TType cosTY = std::cos(static_cast<TType>(rotVec.getY()));
-                const TType cosTZ = std::cos(static_cast<TType>(rotVec.getZ()));
+                const Math::SinCos<Math::Real<TType>> sinCosTX = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getX()));
+                const Math::SinCos<Math::Real<TType>> sinCosTY = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getY()));
+                const Math::SinCos<Math::Real<TType>> sinCosTZ = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getZ()));
+
+                const TType cosTX = static_cast<TType>(sinCosTX.cos);
+                const TType cosTY = static_cast<TType>(sinCosTY.cos);
+                const TType cosTZ = static_cast<TType>(sinCosTZ.cos);
 
-                const TType sinTX = std::sin(static_cast<TType>(rotVec.getX()));
-                const TType sinTY = std::sin(static_cast<TType>(rotVec.getY()));
-                const TType sinTZ = std::sin(static_cast<TType>(rotVec.getZ()));
+                const TType sinTX = static_cast<TType>(sinCosTX.sin);
+                const TType sinTY = static_cast<TType>(sinCosTY.sin);
+                const TType sinTZ = static_cast<TType>(sinCosTZ.sin);
 
                 const TType zero  = static_cast<TType>(0);
                 const TType one  = static_cast<TType>(1);
@@ -364,18 +847,23 @@ namespace FoxMath
             }
         }
 
+        template <EPrecision TPrecision = EPrecision::Precise>
         [[nodiscard]] static constexpr inline
         Matrix4 createSRTMatrix(const Vec3<TType>& scaleVec, const Vec3<TType>& rotVec, const Vec3<TType>& translVec)
         {
             if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
             {
-                const TType cosTX = std::cos(static_cast<TType>(rotVec.getX()));
-                const TType cosTY = std::cos(static_cast<TType>(rotVec.getY()));
-                const TType cosTZ = std::cos(static_cast<TType>(rotVec.getZ()));
+                const Math::SinCos<Math::Real<TType>> sinCosTX = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getX()));
+                const Math::SinCos<Math::Real<TType>> sinCosTY = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getY()));
+                const Math::SinCos<Math::Real<TType>> sinCosTZ = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getZ()));
 
-                const TType sinTX = std::sin(static_cast<TType>(rotVec.getX()));
-                const TType sinTY = std::sin(static_cast<TType>(rotVec.getY()));
-                const TType sinTZ = std::sin(static_cast<TType>(rotVec.getZ()));
+                const TType cosTX = static_cast<TType>(sinCosTX.cos);
+                const TType cosTY = static_cast<TType>(sinCosTY.cos);
+                const TType cosTZ = static_cast<TType>(sinCosTZ.cos);
+
+                const TType sinTX = static_cast<TType>(sinCosTX.sin);
+                const TType sinTY = static_cast<TType>(sinCosTY.sin);
+                const TType sinTZ = static_cast<TType>(sinCosTZ.sin);
 
                 const TType zero  = static_cast<TType>(0);
                 const TType one  = static_cast<TType>(1);
@@ -397,13 +885,17 @@ namespace FoxMath
             }
             else
             {
-                const TType cosTX = std::cos(static_cast<TType>(rotVec.getX()));
-                const TType cosTY = std::cos(static_cast<TType>(rotVec.getY()));
-                const TType cosTZ = std::cos(static_cast<TType>(rotVec.getZ()));
+                const Math::SinCos<Math::Real<TType>> sinCosTX = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getX()));
+                const Math::SinCos<Math::Real<TType>> sinCosTY = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getY()));
+                const Math::SinCos<Math::Real<TType>> sinCosTZ = Math::sincos<TPrecision>(static_cast<TType>(rotVec.getZ()));
+
+                const TType cosTX = static_cast<TType>(sinCosTX.cos);
+                const TType cosTY = static_cast<TType>(sinCosTY.cos);
+                const TType cosTZ = static_cast<TType>(sinCosTZ.cos);
 
-                const TType sinTX = std::sin(static_cast<TType>(rotVec.getX()));
-                const TType sinTY = std::sin(static_cast<TType>(rotVec.getY()));
-                const TType sinTZ = std::sin(static_cast<TType>(rotVec.getZ()));
+                const TType sinTX = static_cast<TType>(sinCosTX.sin);
+                const TType sinTY = static_cast<TType>(sinCosTY.sin);
+                const TType sinTZ = static_cast<TType>(sinCosTZ.sin);
 
                 const TType zero  = static_cast<TType>(0);
                 const TType one  = static_cast<TType>(1);
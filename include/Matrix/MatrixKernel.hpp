@@ -0,0 +1,560 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 41
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Numeric/SIMD.hpp" //Float4, FOXMATH_USE_SIMD
+#include "Matrix/Gemm.hpp" //Gemm::multiply
+#include "Numeric/Math.hpp" //Math::sqrt
+#include "Numeric/Limits.hpp" //isSameAsZero
+
+#include <array> //std::array
+#include <stddef.h> //sizt_t
+#include <algorithm> //std::min
+#include <type_traits> //std::is_same_v
+
+/**
+ * @brief Kernels working on the flat storage of matrix (multiplication, affine decomposition).
+ * All kernels use row major math notation. Column major storage is the transposed matrix, so the caller swap the operands :
+ * transpose(lhs * rhs) = transpose(rhs) * transpose(lhs)
+ */
+namespace FoxMath::MatrixKernel
+{
+    /**
+     * @brief Size of the square tile processed by the generic kernel. 32 * 32 floats fit in L1 cache with lhs, rhs and out tiles.
+     */
+    inline constexpr size_t blockSize = 32;
+
+#ifdef FOXMATH_USE_SIMD
+
+    /**
+     * @brief out = lhs * rhs for 3*3 or 4*4 float row major storage. Each row of out is the sum of rhs rows scaled by broadcasted lhs coeficients.
+     * @note out must not alias lhs or rhs
+     * 
+     * @tparam TSize : 3 or 4
+     * @param lhs 
+     * @param rhs 
+     * @param out 
+     */
+    template <size_t TSize>
+    inline
+    void multiplySquareFloat (const float* lhs, const float* rhs, float* out) noexcept
+    {
+        SIMD::Float4 rhsRows[TSize];
+
+        for (size_t k = 0; k < TSize; k++)
+            rhsRows[k] = SIMD::load<TSize>(rhs + k * TSize);
+
+        for (size_t i = 0; i < TSize; i++)
+        {
+            const float* lhsRow = lhs + i * TSize;
+            SIMD::Float4 rowRst = SIMD::mul(SIMD::set1(lhsRow[0]), rhsRows[0]);
+
+            for (size_t k = 1; k < TSize; k++)
+                rowRst = SIMD::mulAdd(rowRst, SIMD::set1(lhsRow[k]), rhsRows[k]);
+
+            SIMD::store<TSize>(out + i * TSize, rowRst);
+        }
+    }
+
+    /**
+     * @brief out = mat * vec for 4*4 float row major storage. Each lane is the dot product of a row with vec, reduced together with one horizontal add.
+     * 
+     * @param mat 
+     * @param vec 
+     * @param out 
+     */
+    inline
+    void multiplyVectorFloat4RowMajor (const float* mat, const float* vec, float* out) noexcept
+    {
+        const SIMD::Float4 vecReg = SIMD::load<4>(vec);
+
+        SIMD::store<4>(out, SIMD::horizontalAdd(SIMD::mul(SIMD::load<4>(mat),      vecReg),
+                                                SIMD::mul(SIMD::load<4>(mat + 4),  vecReg),
+                                                SIMD::mul(SIMD::load<4>(mat + 8),  vecReg),
+                                                SIMD::mul(SIMD::load<4>(mat + 12), vecReg)));
+    }
+
+    /**
+     * @brief out = mat * vec for 4*4 float column major storage. out is the sum of columns scaled by broadcasted vec coeficients.
+     * 
+     * @param mat 
+     * @param vec 
+     * @param out 
+     */
+    inline
+    void multiplyVectorFloat4ColumnMajor (const float* mat, const float* vec, float* out) noexcept
+    {
+        SIMD::Float4 rst = SIMD::mul(SIMD::set1(vec[0]), SIMD::load<4>(mat));
+        rst = SIMD::mulAdd(rst, SIMD::set1(vec[1]), SIMD::load<4>(mat + 4));
+        rst = SIMD::mulAdd(rst, SIMD::set1(vec[2]), SIMD::load<4>(mat + 8));
+        rst = SIMD::mulAdd(rst, SIMD::set1(vec[3]), SIMD::load<4>(mat + 12));
+        SIMD::store<4>(out, rst);
+    }
+
+#endif //FOXMATH_USE_SIMD
+
+    /**
+     * @brief out = lhs * rhs with lhs rowSize * innerSize and rhs innerSize * columnSize in row major storage.
+     * Cache blocked i-k-j loop : the inner loop stream a row of rhs and a row of out and can be vectorized.
+     * @note out must not alias lhs or rhs
+     * 
+     * @tparam TType 
+     * @param lhs 
+     * @param rhs 
+     * @param out 
+     * @param rowSize 
+     * @param innerSize 
+     * @param columnSize 
+     */
+    template <typename TType>
+    inline constexpr
+    void multiplyBlocked (const TType* lhs, const TType* rhs, TType* out, size_t rowSize, size_t innerSize, size_t columnSize) noexcept
+    {
+        for (size_t i = 0; i < rowSize * columnSize; i++)
+            out[i] = static_cast<TType>(0);
+
+        for (size_t iBlock = 0; iBlock < rowSize; iBlock += blockSize)
+        {
+            const size_t iEnd = std::min(iBlock + blockSize, rowSize);
+
+            for (size_t kBlock = 0; kBlock < innerSize; kBlock += blockSize)
+            {
+                const size_t kEnd = std::min(kBlock + blockSize, innerSize);
+
+                for (size_t jBlock = 0; jBlock < columnSize; jBlock += blockSize)
+                {
+                    const size_t jEnd = std::min(jBlock + blockSize, columnSize);
+
+                    for (size_t i = iBlock; i < iEnd; i++)
+                    {
+                        for (size_t k = kBlock; k < kEnd; k++)
+                        {
+                            const TType coef = lhs[i * innerSize + k];
+
+                            for (size_t j = jBlock; j < jEnd; j++)
+                            {
+                                out[i * columnSize + j] += coef * rhs[k * columnSize + j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief out = lhs * rhs with lhs rowSize * innerSize and rhs innerSize * columnSize in row major storage. Used by matrix with runtime size.
+     * Large products (from Gemm::minMultiplyAddCount multiply-add) use the packed and multithreaded Gemm kernel, the other use the cache blocked loop.
+     * @note out must not alias lhs or rhs
+     * 
+     * @tparam TType 
+     * @param lhs 
+     * @param rhs 
+     * @param out 
+     * @param rowSize 
+     * @param innerSize 
+     * @param columnSize 
+     */
+    template <typename TType>
+    inline constexpr
+    void multiply (const TType* lhs, const TType* rhs, TType* out, size_t rowSize, size_t innerSize, size_t columnSize) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (!FOXMATH_IS_CONSTANT_EVALUATED() && rowSize * innerSize * columnSize >= Gemm::minMultiplyAddCount)
+        {
+            Gemm::multiply(lhs, rhs, out, rowSize, innerSize, columnSize);
+            return;
+        }
+#endif
+
+        multiplyBlocked(lhs, rhs, out, rowSize, innerSize, columnSize);
+    }
+
+    /**
+     * @brief out = lhs * rhs with lhs TRowSize * TInnerSize and rhs TInnerSize * TColumnSize in row major storage.
+     * 3*3 and 4*4 float use SIMD kernel. Other size use the kernel with runtime size (cache blocked loop or Gemm for large matrix).
+     * @note out must not alias lhs or rhs
+     * 
+     * @tparam TRowSize 
+     * @tparam TInnerSize 
+     * @tparam TColumnSize 
+     * @tparam TType 
+     * @param lhs 
+     * @param rhs 
+     * @param out 
+     */
+    template <size_t TRowSize, size_t TInnerSize, size_t TColumnSize, typename TType>
+    inline constexpr
+    void multiply (const std::array<TType, TRowSize * TInnerSize>& lhs, const std::array<TType, TInnerSize * TColumnSize>& rhs, std::array<TType, TRowSize * TColumnSize>& out) noexcept
+    {
+#ifdef FOXMATH_USE_SIMD
+        if constexpr (std::is_same_v<TType, float> && TRowSize == TInnerSize && TInnerSize == TColumnSize && (TInnerSize == 3 || TInnerSize == 4))
+        {
+            if (!FOXMATH_IS_CONSTANT_EVALUATED())
+            {
+                multiplySquareFloat<TInnerSize>(lhs.data(), rhs.data(), out.data());
+                return;
+            }
+        }
+#endif
+
+        multiply(lhs.data(), rhs.data(), out.data(), TRowSize, TInnerSize, TColumnSize);
+    }
+
+    /**
+     * @brief out = mat * vec with mat rowSize * columnSize in row major storage. Used by matrix with runtime size.
+     * @note out must not alias mat or vec
+     * 
+     * @tparam TType 
+     * @param mat 
+     * @param vec 
+     * @param out 
+     * @param rowSize 
+     * @param columnSize 
+     */
+    template <typename TType>
+    inline constexpr
+    void multiplyVectorRowMajor (const TType* mat, const TType* vec, TType* out, size_t rowSize, size_t columnSize) noexcept
+    {
+        for (size_t i = 0; i < rowSize; i++)
+        {
+            TType sum = static_cast<TType>(0);
+
+            for (size_t j = 0; j < columnSize; j++)
+                sum += mat[i * columnSize + j] * vec[j];
+
+            out[i] = sum;
+        }
+    }
+
+    /**
+     * @brief out = mat * vec with mat rowSize * columnSize in column major storage. Used by matrix with runtime size.
+     * @note out must not alias mat or vec
+     * 
+     * @tparam TType 
+     * @param mat 
+     * @param vec 
+     * @param out 
+     * @param rowSize 
+     * @param columnSize 
+     */
+    template <typename TType>
+    inline constexpr
+    void multiplyVectorColumnMajor (const TType* mat, const TType* vec, TType* out, size_t rowSize, size_t columnSize) noexcept
+    {
+        for (size_t i = 0; i < rowSize; i++)
+            out[i] = static_cast<TType>(0);
+
+        for (size_t j = 0; j < columnSize; j++)
+        {
+            const TType coef = vec[j];
+
+            for (size_t i = 0; i < rowSize; i++)
+                out[i] += mat[j * rowSize + i] * coef;
+        }
+    }
+
+    /**
+     * @brief out = mat * vec with mat TRowSize * TColumnSize in row major storage.
+     * 
+     * @tparam TRowSize 
+     * @tparam TColumnSize 
+     * @tparam TType 
+     * @param mat 
+     * @param vec 
+     * @param out 
+     */
+    template <size_t TRowSize, size_t TColumnSize, typename TType>
+    inline constexpr
+    void multiplyVectorRowMajor (const std::array<TType, TRowSize * TColumnSize>& mat, const std::array<TType, TColumnSize>& vec, std::array<TType, TRowSize>& out) noexcept
+    {
+#ifdef FOXMATH_USE_SIMD
+        if constexpr (std::is_same_v<TType, float> && TRowSize == 4 && TColumnSize == 4)
+        {
+            if (!FOXMATH_IS_CONSTANT_EVALUATED())
+            {
+                multiplyVectorFloat4RowMajor(mat.data(), vec.data(), out.data());
+                return;
+            }
+        }
+#endif
+
+        multiplyVectorRowMajor(mat.data(), vec.data(), out.data(), TRowSize, TColumnSize);
+    }
+
+    /**
+     * @brief out = mat * vec with mat TRowSize * TColumnSize in column major storage.
+     * 
+     * @tparam TRowSize 
+     * @tparam TColumnSize 
+     * @tparam TType 
+     * @param mat 
+     * @param vec 
+     * @param out 
+     */
+    template <size_t TRowSize, size_t TColumnSize, typename TType>
+    inline constexpr
+    void multiplyVectorColumnMajor (const std::array<TType, TRowSize * TColumnSize>& mat, const std::array<TType, TColumnSize>& vec, std::array<TType, TRowSize>& out) noexcept
+    {
+#ifdef FOXMATH_USE_SIMD
+        if constexpr (std::is_same_v<TType, float> && TRowSize == 4 && TColumnSize == 4)
+        {
+            if (!FOXMATH_IS_CONSTANT_EVALUATED())
+            {
+                multiplyVectorFloat4ColumnMajor(mat.data(), vec.data(), out.data());
+                return;
+            }
+        }
+#endif
+
+        multiplyVectorColumnMajor(mat.data(), vec.data(), out.data(), TRowSize, TColumnSize);
+    }
+
+    /**
+     * @brief out = lhs * rhs with affine matrix 3*4 in row major storage (last row (0, 0, 0, 1) is implicit).
+     * Each row of out is the sum of the rhs rows scaled by broadcasted lhs coeficients, and the lhs translation.
+     * @note out must not alias lhs or rhs
+     * 
+     * @tparam TType 
+     * @param lhs 
+     * @param rhs 
+     * @param out 
+     */
+    template <typename TType>
+    inline constexpr
+    void multiplyAffine (const std::array<TType, 12>& lhs, const std::array<TType, 12>& rhs, std::array<TType, 12>& out) noexcept
+    {
+#ifdef FOXMATH_USE_SIMD
+        if constexpr (std::is_same_v<TType, float>)
+        {
+            if (!FOXMATH_IS_CONSTANT_EVALUATED())
+            {
+                constexpr float implicitRowData[4] = {0.f, 0.f, 0.f, 1.f};
+
+                const SIMD::Float4 rhsRow0 = SIMD::load<4>(rhs.data());
+                const SIMD::Float4 rhsRow1 = SIMD::load<4>(rhs.data() + 4);
+                const SIMD::Float4 rhsRow2 = SIMD::load<4>(rhs.data() + 8);
+                const SIMD::Float4 implicitRow = SIMD::load<4>(implicitRowData);
+
+                for (size_t i = 0; i < 3; i++)
+                {
+                    const float* lhsRow = lhs.data() + i * 4;
+                    SIMD::Float4 rowRst = SIMD::mul(SIMD::set1(lhsRow[0]), rhsRow0);
+                    rowRst = SIMD::mulAdd(rowRst, SIMD::set1(lhsRow[1]), rhsRow1);
+                    rowRst = SIMD::mulAdd(rowRst, SIMD::set1(lhsRow[2]), rhsRow2);
+                    rowRst = SIMD::mulAdd(rowRst, SIMD::set1(lhsRow[3]), implicitRow);
+                    SIMD::store<4>(out.data() + i * 4, rowRst);
+                }
+                return;
+            }
+        }
+#endif
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            const TType lhs0 = lhs[i * 4];
+            const TType lhs1 = lhs[i * 4 + 1];
+            const TType lhs2 = lhs[i * 4 + 2];
+
+            out[i * 4]     = lhs0 * rhs[0] + lhs1 * rhs[4] + lhs2 * rhs[8];
+            out[i * 4 + 1] = lhs0 * rhs[1] + lhs1 * rhs[5] + lhs2 * rhs[9];
+            out[i * 4 + 2] = lhs0 * rhs[2] + lhs1 * rhs[6] + lhs2 * rhs[10];
+            out[i * 4 + 3] = lhs0 * rhs[3] + lhs1 * rhs[7] + lhs2 * rhs[11] + lhs[i * 4 + 3];
+        }
+    }
+
+    /**
+     * @brief Transform count vectors with a 4*4 matrix given by its columns in math notation.
+     * Vectors are read from src and written to dst with a stride between two consecutive vectors. src and dst can be the same buffer if strides are the same.
+     * 3*3 and 4*4 float use broadcast + mulAdd SIMD kernel and never read or write after the TInputLength / TOutputLength components of each vector.
+     * 
+     * @tparam TInputLength : 3 (w is implicit) or 4
+     * @tparam TOutputLength : 3 or 4
+     * @tparam TUseTranslation : if input is 3D, use implicit w = 1 (point) else w = 0 (direction). Ignored if input is 4D.
+     * @tparam THomogenize : divide the result by its w component (projective point)
+     * @tparam TType 
+     * @param columns : 4 columns of 4 elements in math notation (column major order)
+     * @param src 
+     * @param srcStride : number of TType between two consecutive vectors in src
+     * @param dst 
+     * @param dstStride : number of TType between two consecutive vectors in dst
+     * @param count 
+     */
+    template <size_t TInputLength, size_t TOutputLength, bool TUseTranslation, bool THomogenize, typename TType>
+    inline
+    void transformVectors (const std::array<TType, 16>& columns, const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) noexcept
+    {
+        static_assert((TInputLength == 3 || TInputLength == 4) && (TOutputLength == 3 || TOutputLength == 4), "Only 3D and 4D vectors can be transformed by matrix 4*4");
+
+#ifdef FOXMATH_USE_SIMD
+        if constexpr (std::is_same_v<TType, float>)
+        {
+            const SIMD::Float4 column0 = SIMD::load<4>(columns.data());
+            const SIMD::Float4 column1 = SIMD::load<4>(columns.data() + 4);
+            const SIMD::Float4 column2 = SIMD::load<4>(columns.data() + 8);
+            const SIMD::Float4 column3 = SIMD::load<4>(columns.data() + 12);
+
+            for (size_t i = 0; i < count; i++, src += srcStride, dst += dstStride)
+            {
+                SIMD::Float4 rst = SIMD::mul(SIMD::set1(src[0]), column0);
+                rst = SIMD::mulAdd(rst, SIMD::set1(src[1]), column1);
+                rst = SIMD::mulAdd(rst, SIMD::set1(src[2]), column2);
+
+                if constexpr (TInputLength == 4)
+                    rst = SIMD::mulAdd(rst, SIMD::set1(src[3]), column3);
+                else if constexpr (TUseTranslation)
+                    rst = SIMD::add(rst, column3);
+
+                if constexpr (THomogenize)
+                    rst = SIMD::div(rst, SIMD::splat<3>(rst));
+
+                SIMD::store<TOutputLength>(dst, rst);
+            }
+            return;
+        }
+#endif
+
+        /*w is only needed if it is written or used to homogenize*/
+        constexpr size_t rowCount = (THomogenize || TOutputLength == 4) ? 4 : 3;
+
+        for (size_t i = 0; i < count; i++, src += srcStride, dst += dstStride)
+        {
+            const TType x = src[0];
+            const TType y = src[1];
+            const TType z = src[2];
+
+            TType rst[4];
+            for (size_t row = 0; row < rowCount; row++)
+            {
+                rst[row] = columns[row] * x + columns[4 + row] * y + columns[8 + row] * z;
+
+                if constexpr (TInputLength == 4)
+                    rst[row] += columns[12 + row] * src[3];
+                else if constexpr (TUseTranslation)
+                    rst[row] += columns[12 + row];
+            }
+
+            if constexpr (THomogenize)
+            {
+                const TType wReciprocal = static_cast<TType>(1) / rst[3];
+                for (size_t row = 0; row < TOutputLength; row++)
+                    rst[row] *= wReciprocal;
+            }
+
+            for (size_t row = 0; row < TOutputLength; row++)
+                dst[row] = rst[row];
+        }
+    }
+
+    /**
+     * @brief Split the 3x3 linear part of an affine matrix in an orthonormal rotation and a scale per axis. Shear is not supported.
+     * Shared by Matrix4::decomposeTRS and Transform::decompose so that a matrix and its equivalent transform give the same result.
+     * If the linear part contains a reflection, the scale on x is negative. If one scale is null, its axis is rebuilt with the cross
+     * product of the two others. If more than one scale is null, axes are set to identity.
+     * 
+     * @tparam TType 
+     * @param axes : columns of the linear part, axes[column][row]. Replaced by the columns of the rotation
+     * @param scales : scale of each column
+     * @return number of null scales
+     */
+    template <typename TType>
+    inline constexpr
+    size_t decomposeLinear (TType (&axes)[3][3], TType (&scales)[3]) noexcept
+    {
+        size_t nullScaleCount = 0;
+        size_t nullScaleIndex = 0;
+
+        for (size_t column = 0; column < 3; column++)
+        {
+            TType* axis = axes[column];
+            scales[column] = Math::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+
+            if (isSameAsZero<TType>(scales[column]))
+            {
+                nullScaleCount++;
+                nullScaleIndex = column;
+                continue;
+            }
+
+            const TType scaleReciprocal = static_cast<TType>(1) / scales[column];
+            axis[0] *= scaleReciprocal;
+            axis[1] *= scaleReciprocal;
+            axis[2] *= scaleReciprocal;
+        }
+
+        if (nullScaleCount > 1)
+        {
+            for (size_t column = 0; column < 3; column++)
+            {
+                for (size_t row = 0; row < 3; row++)
+                    axes[column][row] = static_cast<TType>(column == row);
+            }
+            return nullScaleCount;
+        }
+
+        if (nullScaleCount == 1)
+        {
+            const TType* first  = axes[(nullScaleIndex + 1) % 3];
+            const TType* second = axes[(nullScaleIndex + 2) % 3];
+            TType* axis = axes[nullScaleIndex];
+
+            axis[0] = first[1] * second[2] - first[2] * second[1];
+            axis[1] = first[2] * second[0] - first[0] * second[2];
+            axis[2] = first[0] * second[1] - first[1] * second[0];
+
+            const TType length = Math::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+
+            if (!isSameAsZero<TType>(length))
+            {
+                const TType lengthReciprocal = static_cast<TType>(1) / length;
+                axis[0] *= lengthReciprocal;
+                axis[1] *= lengthReciprocal;
+                axis[2] *= lengthReciprocal;
+            }
+            return nullScaleCount;
+        }
+
+        const TType determinant =   axes[0][0] * (axes[1][1] * axes[2][2] - axes[1][2] * axes[2][1])
+                                  + axes[0][1] * (axes[1][2] * axes[2][0] - axes[1][0] * axes[2][2])
+                                  + axes[0][2] * (axes[1][0] * axes[2][1] - axes[1][1] * axes[2][0]);
+
+        /*A reflection cannot be stored in rotation*/
+        if (determinant < static_cast<TType>(0))
+        {
+            scales[0] = -scales[0];
+            axes[0][0] = -axes[0][0];
+            axes[0][1] = -axes[0][1];
+            axes[0][2] = -axes[0][2];
+        }
+
+        return nullScaleCount;
+    }
+
+} /*namespace FoxMath::MatrixKernel*/
@@ -0,0 +1,447 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Matrix/Matrix3.hpp" //Matrix3
+#include "Matrix/Matrix4.hpp" //Matrix4
+#include "Matrix/MatrixKernel.hpp" //MatrixKernel::multiplyAffine, MatrixKernel::transformVectors, MatrixKernel::decomposeLinear
+#include "Vector/Vector3.hpp" //Vec3
+#include "Numeric/SIMD.hpp" //SIMD::storageAlignment
+#include "Numeric/Limits.hpp" //isSameAsZero
+#include "Thread/ParallelFor.hpp" //parallelFor
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <array> //std::array
+
+namespace FoxMath
+{
+    /*Define default template arg and apply template condition*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class Transform;
+
+    /**
+     * @brief Affine transformation stored as the 3 first rows of a matrix 4*4 in math notation : linear part 3*3 and translation in the last column.
+     * The last row (0, 0, 0, 1) is implicit, so transform use 48 bytes for float and compose with 3 rows products instead of 4.
+     * Each row is aligned to be loaded in one register.
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class Transform<TType>
+    {
+        private:
+
+        protected:
+
+        #pragma region attribut
+
+        alignas(SIMD::storageAlignment<4, TType>) std::array<TType, 12> m_data {static_cast<TType>(1), static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(0),
+                                                                                static_cast<TType>(0), static_cast<TType>(1), static_cast<TType>(0), static_cast<TType>(0),
+                                                                                static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(1), static_cast<TType>(0)};
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        /**
+         * @brief Transform vectors with MatrixKernel::transformVectors. Big buffers are split across threads with parallelFor.
+         * 
+         * @tparam TUseTranslation 
+         * @param src 
+         * @param srcStride 
+         * @param dst 
+         * @param dstStride 
+         * @param count 
+         */
+        template <bool TUseTranslation>
+        inline
+        void transformVectorsParallel (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept;
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Construct identity transform
+         * 
+         */
+        constexpr inline
+        Transform () noexcept 					                    = default;
+
+        constexpr inline
+        Transform (const Transform& other) noexcept			        = default;
+
+        constexpr inline
+        Transform (Transform&& other) noexcept				        = default;
+
+        inline
+        ~Transform () noexcept				                        = default;
+
+        constexpr inline
+        Transform& operator=(Transform const& other) noexcept		= default;
+
+        constexpr inline
+        Transform& operator=(Transform && other) noexcept			= default;
+
+        /**
+         * @brief Construct transform with the 3 first rows of the affine matrix. The last row is ignored.
+         * 
+         * @tparam TMatrixConvention 
+         * @param matrix : affine matrix 4*4
+         */
+        template <EMatrixConvention TMatrixConvention>
+        explicit constexpr inline
+        Transform (const GenericMatrix<4, 4, TType, TMatrixConvention>& matrix) noexcept;
+
+        /**
+         * @brief Construct transform with linear part and translation. Use it with Quaternion::getRotationMatrix.
+         * 
+         * @tparam TMatrixConvention 
+         * @param linear : rotation, scale and shear
+         * @param translation 
+         */
+        template <EMatrixConvention TMatrixConvention>
+        constexpr inline
+        Transform (const GenericMatrix<3, 3, TType, TMatrixConvention>& linear, const GenericVector<3, TType>& translation) noexcept;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Reverse affine transformation : linear part is reversed and translation become -inverse(linear) * translation.
+         * If the linear part is not reversible, transform is fill with zero.
+         * 
+         * @return constexpr Transform& 
+         */
+        inline constexpr
+        Transform& reverse () noexcept;
+
+        /**
+         * @brief Return the reverse of affine transformation. See reverse
+         * 
+         * @return constexpr Transform 
+         */
+        [[nodiscard]] inline constexpr
+        Transform getReverse () const noexcept;
+
+        /**
+         * @brief Reverse rigid transformation (rotation and translation only, without scale) : rotation is transposed.
+         * 
+         * @return constexpr Transform& 
+         */
+        inline constexpr
+        Transform& rigidReverse () noexcept;
+
+        /**
+         * @brief Return the reverse of rigid transformation (rotation and translation only, without scale). See rigidReverse
+         * 
+         * @return constexpr Transform 
+         */
+        [[nodiscard]] inline constexpr
+        Transform getRigidReverse () const noexcept;
+
+        /**
+         * @brief Return linear * point + translation
+         * 
+         * @param point 
+         * @return constexpr Vec3<TType> 
+         */
+        [[nodiscard]] inline constexpr
+        Vec3<TType> transformPoint (const GenericVector<3, TType>& point) const noexcept;
+
+        /**
+         * @brief Return linear * direction. Translation is ignored
+         * 
+         * @param direction 
+         * @return constexpr Vec3<TType> 
+         */
+        [[nodiscard]] inline constexpr
+        Vec3<TType> transformDirection (const GenericVector<3, TType>& direction) const noexcept;
+
+        /**
+         * @brief Transform count points. Buffers are read and written with a stride in number of TType.
+         * src and dst can be the same buffer if strides are the same. Big buffers are split across threads.
+         * 
+         * @param src : x, y, z of each point
+         * @param srcStride : number of TType between two consecutive points in src. 3 for tightly packed points
+         * @param dst : x, y, z of each point
+         * @param dstStride : number of TType between two consecutive points in dst
+         * @param count 
+         */
+        inline
+        void transformPoints (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept;
+
+        /**
+         * @brief Transform count directions. Translation is ignored. Buffers are read and written with a stride in number of TType.
+         * src and dst can be the same buffer if strides are the same. Big buffers are split across threads.
+         * 
+         * @param src : x, y, z of each direction
+         * @param srcStride : number of TType between two consecutive directions in src. 3 for tightly packed directions
+         * @param dst : x, y, z of each direction
+         * @param dstStride : number of TType between two consecutive directions in dst
+         * @param count 
+         */
+        inline
+        void transformDirections (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept;
+
+        /**
+         * @brief Decompose transform in translation, rotation and scale. Shear is not supported.
+         * If the linear part contains a reflection, the scale on x is negative. If one scale is null, its axis is rebuilt with
+         * the cross product of the two others. Same result as Matrix4::decomposeTRS (see MatrixKernel::decomposeLinear).
+         * 
+         * @tparam TMatrixConvention 
+         * @param translation 
+         * @param rotation : orthonormal matrix
+         * @param scale 
+         * @return true if decomposition is possible
+         * @return false if more than one scale is null. Rotation is identity
+         */
+        template <EMatrixConvention TMatrixConvention>
+        inline
+        bool decompose (Vec3<TType>& translation, Matrix3<TType, TMatrixConvention>& rotation, Vec3<TType>& scale) const noexcept;
+
+        /**
+         * @brief Write transform in referential : origin is the translation and unit vectors are the columns of the linear part.
+         * @note Unit vectors are unit only if transform is rigid.
+         * 
+         * @tparam TReferential : type with origin, unitI, unitJ and unitK attributs of type Vec3<TType>
+         * @param referential 
+         */
+        template <typename TReferential>
+        inline constexpr
+        void toReferential (TReferential& referential) const noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region static methods
+
+        /**
+         * @brief Get identity transform.
+         * 
+         * @return constexpr Transform 
+         */
+        [[nodiscard]] static inline constexpr
+        Transform identity () noexcept
+        {
+            return Transform();
+        }
+
+        /**
+         * @brief Create transform from translation, rotation matrix and scale. Same as translation * rotation * scale.
+         * 
+         * @tparam TMatrixConvention 
+         * @param translation 
+         * @param rotation : rotation matrix like Quaternion::getRotationMatrix
+         * @param scale 
+         * @return constexpr Transform 
+         */
+        template <EMatrixConvention TMatrixConvention>
+        [[nodiscard]] static inline constexpr
+        Transform createTRS (const Vec3<TType>& translation, const GenericMatrix<3, 3, TType, TMatrixConvention>& rotation, const Vec3<TType>& scale) noexcept;
+
+        /**
+         * @brief Create transform from translation, euler angles in radian and scale. Same as Matrix4::createTRSMatrix
+         * 
+         * @param translation 
+         * @param rotation : euler angles in radian
+         * @param scale 
+         * @return Transform 
+         */
+        [[nodiscard]] static inline
+        Transform createTRS (const Vec3<TType>& translation, const Vec3<TType>& rotation, const Vec3<TType>& scale) noexcept;
+
+        /**
+         * @brief Create transform from referential : local to global transformation.
+         * 
+         * @tparam TReferential : type with origin, unitI, unitJ and unitK attributs of type Vec3<TType>
+         * @param referential 
+         * @return constexpr Transform 
+         */
+        template <typename TReferential>
+        [[nodiscard]] static inline constexpr
+        Transform createFromReferential (const TReferential& referential) noexcept;
+
+        #pragma endregion //!static methods
+
+        #pragma region accessor
+
+        /**
+         * @brief Returns a const reference to the data, row by row
+         * 
+         * @return constexpr const std::array<TType, 12>& 
+         */
+        [[nodiscard]] inline constexpr
+        const std::array<TType, 12>& getData () const noexcept
+        {
+            return m_data;
+        }
+
+        /**
+         * @brief Returns a reference to the data, row by row
+         * 
+         * @return constexpr std::array<TType, 12>& 
+         */
+        [[nodiscard]] inline constexpr
+        std::array<TType, 12>& getData () noexcept
+        {
+            return m_data;
+        }
+
+        /**
+         * @brief Returns the element at row and column in math notation
+         * 
+         * @param row : 0 to 2
+         * @param column : 0 to 3. Column 3 is the translation
+         * @return constexpr TType 
+         */
+        [[nodiscard]] inline constexpr
+        TType getData (size_t row, size_t column) const noexcept
+        {
+            assert(row < 3 && column < 4);
+            return m_data[row * 4 + column];
+        }
+
+        /**
+         * @brief Returns a reference to the element at row and column in math notation
+         * 
+         * @param row : 0 to 2
+         * @param column : 0 to 3. Column 3 is the translation
+         * @return constexpr TType& 
+         */
+        [[nodiscard]] inline constexpr
+        TType& getData (size_t row, size_t column) noexcept
+        {
+            assert(row < 3 && column < 4);
+            return m_data[row * 4 + column];
+        }
+
+        /**
+         * @brief Get the Translation
+         * 
+         * @return constexpr Vec3<TType> 
+         */
+        [[nodiscard]] inline constexpr
+        Vec3<TType> getTranslation () const noexcept
+        {
+            return Vec3<TType>(m_data[3], m_data[7], m_data[11]);
+        }
+
+        /**
+         * @brief Get the linear part (rotation, scale and shear)
+         * 
+         * @tparam TMatrixConvention 
+         * @return constexpr Matrix3<TType, TMatrixConvention> 
+         */
+        template <EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+        [[nodiscard]] inline constexpr
+        Matrix3<TType, TMatrixConvention> getLinear () const noexcept;
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        /**
+         * @brief Set the Translation
+         * 
+         * @param translation 
+         * @return constexpr Transform& 
+         */
+        inline constexpr
+        Transform& setTranslation (const GenericVector<3, TType>& translation) noexcept
+        {
+            m_data[3]  = translation[0];
+            m_data[7]  = translation[1];
+            m_data[11] = translation[2];
+            return *this;
+        }
+
+        #pragma endregion //!mutator
+
+        #pragma region operator
+
+        /**
+         * @brief Compose transform : this = this * other. other is applied first.
+         * 
+         * @param other 
+         * @return constexpr Transform& 
+         */
+        inline constexpr
+        Transform& operator*=(const Transform& other) noexcept;
+
+        #pragma endregion //!operator
+
+        #pragma region convertor
+
+        /**
+         * @brief Converte transform to affine matrix 4*4
+         * 
+         * @tparam TMatrixConvention 
+         * @return constexpr Matrix4<TType, TMatrixConvention> 
+         */
+        template <EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+        [[nodiscard]] inline constexpr
+        Matrix4<TType, TMatrixConvention> toMatrix4 () const noexcept;
+
+        #pragma endregion //!convertor
+    };
+
+    /**
+     * @brief Compose transform : lhs * rhs. rhs is applied first.
+     * 
+     * @tparam TType 
+     * @param lhs 
+     * @param rhs 
+     * @return constexpr Transform<TType> 
+     */
+    template <typename TType>
+    [[nodiscard]] inline constexpr
+    Transform<TType> operator*(const Transform<TType>& lhs, const Transform<TType>& rhs) noexcept;
+
+    /**
+     * @brief Transform point. Same as transform.transformPoint(point)
+     * 
+     * @tparam TType 
+     * @param transform 
+     * @param point 
+     * @return constexpr Vec3<TType> 
+     */
+    template <typename TType>
+    [[nodiscard]] inline constexpr
+    Vec3<TType> operator*(const Transform<TType>& transform, const GenericVector<3, TType>& point) noexcept;
+
+    #include "Matrix/Space/Transform.inl"
+
+    using Transformf = Transform<float>;
+    using Transformd = Transform<double>;
+
+} /*namespace FoxMath*/
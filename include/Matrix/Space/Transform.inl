@@ -0,0 +1,341 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+constexpr inline
+Transform<TType>::Transform (const GenericMatrix<4, 4, TType, TMatrixConvention>& matrix) noexcept
+{
+    for (size_t row = 0; row < 3; row++)
+    {
+        for (size_t column = 0; column < 4; column++)
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                m_data[row * 4 + column] = matrix.getData(row, column);
+            else
+                m_data[row * 4 + column] = matrix.getData(column, row);
+        }
+    }
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+constexpr inline
+Transform<TType>::Transform (const GenericMatrix<3, 3, TType, TMatrixConvention>& linear, const GenericVector<3, TType>& translation) noexcept
+{
+    for (size_t row = 0; row < 3; row++)
+    {
+        for (size_t column = 0; column < 3; column++)
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                m_data[row * 4 + column] = linear.getData(row, column);
+            else
+                m_data[row * 4 + column] = linear.getData(column, row);
+        }
+
+        m_data[row * 4 + 3] = translation[row];
+    }
+}
+
+template <typename TType>
+template <bool TUseTranslation>
+inline
+void Transform<TType>::transformVectorsParallel (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept
+{
+    const std::array<TType, 16> columns {m_data[0], m_data[4], m_data[8],  static_cast<TType>(0),
+                                         m_data[1], m_data[5], m_data[9],  static_cast<TType>(0),
+                                         m_data[2], m_data[6], m_data[10], static_cast<TType>(0),
+                                         m_data[3], m_data[7], m_data[11], static_cast<TType>(1)};
+
+    parallelFor(count, defaultParallelGrain, [&](size_t begin, size_t end)
+    {
+        MatrixKernel::transformVectors<3, 3, TUseTranslation, false>(columns, src + begin * srcStride, srcStride, dst + begin * dstStride, dstStride, end - begin);
+    });
+}
+
+template <typename TType>
+inline constexpr
+Transform<TType>& Transform<TType>::reverse () noexcept
+{
+    const std::array<TType, 12>& m = m_data;
+
+    const TType cofactor00 = m[5] * m[10] - m[6] * m[9];
+    const TType cofactor01 = m[6] * m[8]  - m[4] * m[10];
+    const TType cofactor02 = m[4] * m[9]  - m[5] * m[8];
+
+    const TType determinant = m[0] * cofactor00 + m[1] * cofactor01 + m[2] * cofactor02;
+
+    if (isSameAsZero<TType>(determinant))
+    {
+        m_data = {};
+        return *this;
+    }
+
+    const TType determinantReciprocal = static_cast<TType>(1) / determinant;
+
+    const std::array<TType, 9> linear  {cofactor00 * determinantReciprocal, (m[2] * m[9] - m[1] * m[10]) * determinantReciprocal, (m[1] * m[6] - m[2] * m[5]) * determinantReciprocal,
+                                        cofactor01 * determinantReciprocal, (m[0] * m[10] - m[2] * m[8]) * determinantReciprocal, (m[2] * m[4] - m[0] * m[6]) * determinantReciprocal,
+                                        cofactor02 * determinantReciprocal, (m[1] * m[8] - m[0] * m[9])  * determinantReciprocal, (m[0] * m[5] - m[1] * m[4]) * determinantReciprocal};
+
+    const TType tx = m[3], ty = m[7], tz = m[11];
+
+    for (size_t row = 0; row < 3; row++)
+    {
+        m_data[row * 4]     = linear[row * 3];
+        m_data[row * 4 + 1] = linear[row * 3 + 1];
+        m_data[row * 4 + 2] = linear[row * 3 + 2];
+        m_data[row * 4 + 3] = -(linear[row * 3] * tx + linear[row * 3 + 1] * ty + linear[row * 3 + 2] * tz);
+    }
+
+    return *this;
+}
+
+template <typename TType>
+inline constexpr
+Transform<TType> Transform<TType>::getReverse () const noexcept
+{
+    Transform rst (*this);
+    rst.reverse();
+    return rst;
+}
+
+template <typename TType>
+inline constexpr
+Transform<TType>& Transform<TType>::rigidReverse () noexcept
+{
+    const std::array<TType, 12> m = m_data;
+
+    for (size_t row = 0; row < 3; row++)
+    {
+        m_data[row * 4]     = m[row];
+        m_data[row * 4 + 1] = m[4 + row];
+        m_data[row * 4 + 2] = m[8 + row];
+        m_data[row * 4 + 3] = -(m[row] * m[3] + m[4 + row] * m[7] + m[8 + row] * m[11]);
+    }
+
+    return *this;
+}
+
+template <typename TType>
+inline constexpr
+Transform<TType> Transform<TType>::getRigidReverse () const noexcept
+{
+    Transform rst (*this);
+    rst.rigidReverse();
+    return rst;
+}
+
+template <typename TType>
+inline constexpr
+Vec3<TType> Transform<TType>::transformPoint (const GenericVector<3, TType>& point) const noexcept
+{
+    return Vec3<TType>(m_data[0] * point[0] + m_data[1] * point[1] + m_data[2]  * point[2] + m_data[3],
+                       m_data[4] * point[0] + m_data[5] * point[1] + m_data[6]  * point[2] + m_data[7],
+                       m_data[8] * point[0] + m_data[9] * point[1] + m_data[10] * point[2] + m_data[11]);
+}
+
+template <typename TType>
+inline constexpr
+Vec3<TType> Transform<TType>::transformDirection (const GenericVector<3, TType>& direction) const noexcept
+{
+    return Vec3<TType>(m_data[0] * direction[0] + m_data[1] * direction[1] + m_data[2]  * direction[2],
+                       m_data[4] * direction[0] + m_data[5] * direction[1] + m_data[6]  * direction[2],
+                       m_data[8] * direction[0] + m_data[9] * direction[1] + m_data[10] * direction[2]);
+}
+
+template <typename TType>
+inline
+void Transform<TType>::transformPoints (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept
+{
+    transformVectorsParallel<true>(src, srcStride, dst, dstStride, count);
+}
+
+template <typename TType>
+inline
+void Transform<TType>::transformDirections (const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept
+{
+    transformVectorsParallel<false>(src, srcStride, dst, dstStride, count);
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline
+bool Transform<TType>::decompose (Vec3<TType>& translation, Matrix3<TType, TMatrixConvention>& rotation, Vec3<TType>& scale) const noexcept
+{
+    const std::array<TType, 12>& m = m_data;
+
+    /*axes[column][row]*/
+    TType axes[3][3] = {{m[0], m[4], m[8]},
+                        {m[1], m[5], m[9]},
+                        {m[2], m[6], m[10]}};
+    TType scales[3] {};
+    const size_t nullScaleCount = MatrixKernel::decomposeLinear(axes, scales);
+
+    translation = getTranslation();
+    scale = Vec3<TType>(scales[0], scales[1], scales[2]);
+
+    for (size_t row = 0; row < 3; row++)
+    {
+        for (size_t column = 0; column < 3; column++)
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                rotation.getData(row, column) = axes[column][row];
+            else
+                rotation.getData(column, row) = axes[column][row];
+        }
+    }
+
+    return nullScaleCount <= 1;
+}
+
+template <typename TType>
+template <typename TReferential>
+inline constexpr
+void Transform<TType>::toReferential (TReferential& referential) const noexcept
+{
+    referential.origin = getTranslation();
+    referential.unitI  = Vec3<TType>(m_data[0], m_data[4], m_data[8]);
+    referential.unitJ  = Vec3<TType>(m_data[1], m_data[5], m_data[9]);
+    referential.unitK  = Vec3<TType>(m_data[2], m_data[6], m_data[10]);
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline constexpr
+Transform<TType> Transform<TType>::createTRS (const Vec3<TType>& translation, const GenericMatrix<3, 3, TType, TMatrixConvention>& rotation, const Vec3<TType>& scale) noexcept
+{
+    Transform rst (rotation, translation);
+
+    for (size_t row = 0; row < 3; row++)
+    {
+        for (size_t column = 0; column < 3; column++)
+        {
+            rst.m_data[row * 4 + column] *= scale[column];
+        }
+    }
+
+    return rst;
+}
+
+template <typename TType>
+inline
+Transform<TType> Transform<TType>::createTRS (const Vec3<TType>& translation, const Vec3<TType>& rotation, const Vec3<TType>& scale) noexcept
+{
+    return Transform(Matrix4<TType>::createTRSMatrix(translation, rotation, scale));
+}
+
+template <typename TType>
+template <typename TReferential>
+inline constexpr
+Transform<TType> Transform<TType>::createFromReferential (const TReferential& referential) noexcept
+{
+    Transform rst;
+
+    for (size_t row = 0; row < 3; row++)
+    {
+        rst.m_data[row * 4]     = referential.unitI[row];
+        rst.m_data[row * 4 + 1] = referential.unitJ[row];
+        rst.m_data[row * 4 + 2] = referential.unitK[row];
+        rst.m_data[row * 4 + 3] = referential.origin[row];
+    }
+
+    return rst;
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline constexpr
+Matrix3<TType, TMatrixConvention> Transform<TType>::getLinear () const noexcept
+{
+    Matrix3<TType, TMatrixConvention> rst;
+
+    for (size_t row = 0; row < 3; row++)
+    {
+        for (size_t column = 0; column < 3; column++)
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                rst.getData(row, column) = m_data[row * 4 + column];
+            else
+                rst.getData(column, row) = m_data[row * 4 + column];
+        }
+    }
+
+    return rst;
+}
+
+template <typename TType>
+inline constexpr
+Transform<TType>& Transform<TType>::operator*=(const Transform& other) noexcept
+{
+    std::array<TType, 12> rst {};
+    MatrixKernel::multiplyAffine(m_data, other.m_data, rst);
+    m_data = rst;
+    return *this;
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline constexpr
+Matrix4<TType, TMatrixConvention> Transform<TType>::toMatrix4 () const noexcept
+{
+    Matrix4<TType, TMatrixConvention> rst;
+
+    for (size_t row = 0; row < 4; row++)
+    {
+        for (size_t column = 0; column < 4; column++)
+        {
+            const TType value = (row < 3) ? m_data[row * 4 + column] : ((column == 3) ? static_cast<TType>(1) : static_cast<TType>(0));
+
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                rst.getData(row, column) = value;
+            else
+                rst.getData(column, row) = value;
+        }
+    }
+
+    return rst;
+}
+
+template <typename TType>
+inline constexpr
+Transform<TType> operator*(const Transform<TType>& lhs, const Transform<TType>& rhs) noexcept
+{
+    Transform<TType> rst;
+    MatrixKernel::multiplyAffine(lhs.getData(), rhs.getData(), rst.getData());
+    return rst;
+}
+
+template <typename TType>
+inline constexpr
+Vec3<TType> operator*(const Transform<TType>& transform, const GenericVector<3, TType>& point) noexcept
+{
+    return transform.transformPoint(point);
+}
@@ -0,0 +1,329 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Matrix/Space/Transform.hpp" //Transform
+#include "Matrix/Matrix4.hpp" //Matrix4
+#include "Quaternion/Quaternion.hpp" //Quaternion
+#include "Vector/Vector3.hpp" //Vec3
+#include "Thread/ParallelFor.hpp" //parallelFor
+#include "Thread/ThreadPool.hpp" //ThreadPool
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <array> //std::array
+#include <vector> //std::vector
+#include <algorithm> //std::min, std::max, std::is_sorted, std::fill
+#include <type_traits> //std::remove_reference_t
+#include <limits> //std::numeric_limits
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /*Define default template arg and apply template condition*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class TransformHierarchy;
+
+    /**
+     * @brief Parent-child chains of local TRS (translation, quaternion, scale) that compute world transforms.
+     * Nodes are stored in flat arrays (one by attribute) sorted by depth, so a parent is always processed before its children and
+     * all nodes of one level can be updated in parallel. Only nodes whose local TRS changed, and their subtree, are recomputed by update().
+     * @note Handles returned by addNode stay valid when the storage is sorted again.
+     * @example `FoxMath::TransformHierarchy<float> scene; auto root = scene.addNode(); auto child = scene.addNode(root); scene.setLocalTranslation(child, vec); scene.update();`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class TransformHierarchy<TType>
+    {
+        private:
+
+        public:
+
+        using NodeHandle = size_t;
+
+        #pragma region static attribut
+
+        /**
+         * @brief Parent of root nodes
+         * 
+         */
+        static constexpr NodeHandle invalidNode = std::numeric_limits<size_t>::max();
+
+        /**
+         * @brief Minimum number of nodes of one level given to a thread by update
+         * 
+         */
+        static constexpr size_t parallelGrain = 1 << 12;
+
+        #pragma endregion //! static attribut
+
+        protected:
+
+        #pragma region attribut
+
+        /*Indexed by storage index, sorted by depth*/
+        std::vector<Vec3<TType>>        m_localTranslations;
+        std::vector<Quaternion<TType>>  m_localRotations;
+        std::vector<Vec3<TType>>        m_localScales;
+        std::vector<Transform<TType>>   m_worldTransforms;
+        std::vector<size_t>             m_parents;
+        std::vector<size_t>             m_depths;
+        std::vector<unsigned char>      m_isDirty; /*Not std::vector<bool> : flags of one level are written from several threads*/
+        std::vector<NodeHandle>         m_indexToHandle;
+
+        /*Indexed by handle*/
+        std::vector<size_t>             m_handleToIndex;
+
+        /*Storage index of the first node of each level, plus the node count*/
+        std::vector<size_t>             m_levelOffsets {0};
+
+        size_t                          m_minDirtyDepth = std::numeric_limits<size_t>::max();
+        bool                            m_isLayoutDirty = false;
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        /**
+         * @brief Mark node as dirty. Its world transform and the world transform of its subtree are computed on the next update.
+         * 
+         * @param index : storage index
+         */
+        inline
+        void markDirty (size_t index) noexcept;
+
+        /**
+         * @brief Sort storage by depth if nodes were added out of order and compute level offsets
+         * 
+         */
+        inline
+        void rebuildLayout () noexcept;
+
+        /**
+         * @brief Update dirty nodes level by level. The nodes of one level are given to parallelForFunctor.
+         * 
+         * @tparam TParallelFor : void(size_t count, size_t grain, functor(size_t begin, size_t end))
+         * @param parallelForFunctor 
+         */
+        template <typename TParallelFor>
+        inline
+        void updateLevels (TParallelFor&& parallelForFunctor) noexcept;
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        inline
+        TransformHierarchy () noexcept 					                        = default;
+
+        inline
+        TransformHierarchy (const TransformHierarchy& other) 			        = default;
+
+        inline
+        TransformHierarchy (TransformHierarchy&& other) noexcept				= default;
+
+        inline
+        ~TransformHierarchy () noexcept				                            = default;
+
+        inline
+        TransformHierarchy& operator=(TransformHierarchy const& other)		    = default;
+
+        inline
+        TransformHierarchy& operator=(TransformHierarchy && other) noexcept		= default;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Reserve storage for count nodes
+         * 
+         * @param count 
+         */
+        inline
+        void reserve (size_t count);
+
+        /**
+         * @brief Add node with identity local transform
+         * 
+         * @param parent : parent handle or invalidNode for a root
+         * @return NodeHandle 
+         */
+        inline
+        NodeHandle addNode (NodeHandle parent = invalidNode);
+
+        /**
+         * @brief Add node. Nodes added in depth order (parents before deeper children) do not need to sort the storage on next update.
+         * 
+         * @param parent : parent handle or invalidNode for a root
+         * @param translation 
+         * @param rotation : unit quaternion
+         * @param scale 
+         * @return NodeHandle 
+         */
+        inline
+        NodeHandle addNode (NodeHandle parent, const Vec3<TType>& translation, const Quaternion<TType>& rotation, const Vec3<TType>& scale);
+
+        /**
+         * @brief Compute world transform of dirty nodes and their subtree. Levels are processed in order and the nodes of a big level are split across threads with parallelFor.
+         * 
+         */
+        inline
+        void update () noexcept;
+
+        /**
+         * @brief Same as update but the nodes of a big level are split across the workers of pool
+         * 
+         * @param pool 
+         */
+        inline
+        void update (ThreadPool& pool) noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        /**
+         * @brief Number of nodes
+         * 
+         * @return size_t 
+         */
+        [[nodiscard]] inline
+        size_t size () const noexcept { return m_parents.size(); }
+
+        /**
+         * @brief Return true if a local transform changed or a node was added since the last update
+         * 
+         * @return bool 
+         */
+        [[nodiscard]] inline
+        bool isDirty () const noexcept { return m_minDirtyDepth != std::numeric_limits<size_t>::max(); }
+
+        [[nodiscard]] inline
+        NodeHandle getParent (NodeHandle node) const noexcept
+        {
+            const size_t parent = m_parents[m_handleToIndex[node]];
+            return parent == invalidNode ? invalidNode : m_indexToHandle[parent];
+        }
+
+        /**
+         * @brief Depth of node. Roots have a depth of 0
+         * 
+         * @param node 
+         * @return size_t 
+         */
+        [[nodiscard]] inline
+        size_t getDepth (NodeHandle node) const noexcept { return m_depths[m_handleToIndex[node]]; }
+
+        [[nodiscard]] inline
+        const Vec3<TType>& getLocalTranslation (NodeHandle node) const noexcept { return m_localTranslations[m_handleToIndex[node]]; }
+
+        [[nodiscard]] inline
+        const Quaternion<TType>& getLocalRotation (NodeHandle node) const noexcept { return m_localRotations[m_handleToIndex[node]]; }
+
+        [[nodiscard]] inline
+        const Vec3<TType>& getLocalScale (NodeHandle node) const noexcept { return m_localScales[m_handleToIndex[node]]; }
+
+        /**
+         * @brief World transform of node computed by the last update
+         * 
+         * @param node 
+         * @return const Transform<TType>& 
+         */
+        [[nodiscard]] inline
+        const Transform<TType>& getWorldTransform (NodeHandle node) const noexcept { return m_worldTransforms[m_handleToIndex[node]]; }
+
+        /**
+         * @brief World matrix of node computed by the last update
+         * 
+         * @tparam TMatrixConvention 
+         * @param node 
+         * @return Matrix4<TType, TMatrixConvention> 
+         */
+        template <EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+        [[nodiscard]] inline
+        Matrix4<TType, TMatrixConvention> getWorldMatrix (NodeHandle node) const noexcept { return getWorldTransform(node).template toMatrix4<TMatrixConvention>(); }
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        inline
+        void setLocalTranslation (NodeHandle node, const Vec3<TType>& translation) noexcept;
+
+        /**
+         * @brief Set local rotation of node
+         * 
+         * @param node 
+         * @param rotation : unit quaternion
+         */
+        inline
+        void setLocalRotation (NodeHandle node, const Quaternion<TType>& rotation) noexcept;
+
+        inline
+        void setLocalScale (NodeHandle node, const Vec3<TType>& scale) noexcept;
+
+        /**
+         * @brief Set local translation, rotation and scale of node
+         * 
+         * @param node 
+         * @param translation 
+         * @param rotation : unit quaternion
+         * @param scale 
+         */
+        inline
+        void setLocalTRS (NodeHandle node, const Vec3<TType>& translation, const Quaternion<TType>& rotation, const Vec3<TType>& scale) noexcept;
+
+        #pragma endregion //!mutator
+
+        #pragma region static methods
+
+        /**
+         * @brief Create affine transform translation * rotation * scale from a unit quaternion
+         * 
+         * @param translation 
+         * @param rotation : unit quaternion
+         * @param scale 
+         * @return Transform<TType> 
+         */
+        [[nodiscard]] static inline constexpr
+        Transform<TType> createLocalTransform (const Vec3<TType>& translation, const Quaternion<TType>& rotation, const Vec3<TType>& scale) noexcept;
+
+        #pragma endregion //!static methods
+    };
+
+    #include "Matrix/Space/TransformHierarchy.inl"
+
+    using TransformHierarchyf = TransformHierarchy<float>;
+    using TransformHierarchyd = TransformHierarchy<double>;
+
+} /*namespace FoxMath*/
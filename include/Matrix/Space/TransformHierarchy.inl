@@ -0,0 +1,272 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+inline
+void TransformHierarchy<TType>::markDirty (size_t index) noexcept
+{
+    m_isDirty[index] = 1;
+    m_minDirtyDepth = std::min(m_minDirtyDepth, m_depths[index]);
+}
+
+template <typename TType>
+inline
+void TransformHierarchy<TType>::rebuildLayout () noexcept
+{
+    const size_t count = size();
+
+    size_t levelCount = 0;
+    for (size_t index = 0; index < count; index++)
+        levelCount = std::max(levelCount, m_depths[index] + 1);
+
+    /*Counting sort by depth*/
+    m_levelOffsets.assign(levelCount + 1, 0);
+
+    for (size_t index = 0; index < count; index++)
+        m_levelOffsets[m_depths[index] + 1]++;
+
+    for (size_t level = 0; level < levelCount; level++)
+        m_levelOffsets[level + 1] += m_levelOffsets[level];
+
+    if (!std::is_sorted(m_depths.begin(), m_depths.end()))
+    {
+        std::vector<size_t> newIndices (count);
+        std::vector<size_t> oldIndices (count);
+        std::vector<size_t> cursors (m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+
+        for (size_t index = 0; index < count; index++)
+        {
+            newIndices[index] = cursors[m_depths[index]]++;
+            oldIndices[newIndices[index]] = index;
+        }
+
+        /*Gather instead of scatter : Quaternion is not default constructible*/
+        auto permute = [&](auto& data)
+        {
+            std::remove_reference_t<decltype(data)> sorted;
+            sorted.reserve(data.capacity());
+
+            for (size_t index = 0; index < count; index++)
+                sorted.push_back(data[oldIndices[index]]);
+
+            data.swap(sorted);
+        };
+
+        permute(m_localTranslations);
+        permute(m_localRotations);
+        permute(m_localScales);
+        permute(m_worldTransforms);
+        permute(m_depths);
+        permute(m_isDirty);
+        permute(m_indexToHandle);
+        permute(m_parents);
+
+        for (size_t& parent : m_parents)
+        {
+            if (parent != invalidNode)
+                parent = newIndices[parent];
+        }
+
+        for (size_t& index : m_handleToIndex)
+            index = newIndices[index];
+    }
+
+    m_isLayoutDirty = false;
+}
+
+template <typename TType>
+template <typename TParallelFor>
+inline
+void TransformHierarchy<TType>::updateLevels (TParallelFor&& parallelForFunctor) noexcept
+{
+    if (!isDirty())
+        return;
+
+    if (m_isLayoutDirty)
+        rebuildLayout();
+
+    const size_t levelCount = m_levelOffsets.size() - 1;
+
+    for (size_t level = m_minDirtyDepth; level < levelCount; level++)
+    {
+        const size_t levelBegin = m_levelOffsets[level];
+
+        /*Parents are in the previous level, already updated*/
+        parallelForFunctor(m_levelOffsets[level + 1] - levelBegin, parallelGrain, [this, levelBegin](size_t begin, size_t end)
+        {
+            for (size_t index = levelBegin + begin; index < levelBegin + end; index++)
+            {
+                const size_t parent = m_parents[index];
+
+                if (parent != invalidNode && m_isDirty[parent])
+                    m_isDirty[index] = 1;
+
+                if (!m_isDirty[index])
+                    continue;
+
+                const Transform<TType> local = createLocalTransform(m_localTranslations[index], m_localRotations[index], m_localScales[index]);
+                m_worldTransforms[index] = (parent == invalidNode) ? local : m_worldTransforms[parent] * local;
+            }
+        });
+    }
+
+    std::fill(m_isDirty.begin() + m_levelOffsets[m_minDirtyDepth], m_isDirty.end(), static_cast<unsigned char>(0));
+    m_minDirtyDepth = std::numeric_limits<size_t>::max();
+}
+
+template <typename TType>
+inline
+void TransformHierarchy<TType>::reserve (size_t count)
+{
+    m_localTranslations.reserve(count);
+    m_localRotations.reserve(count);
+    m_localScales.reserve(count);
+    m_worldTransforms.reserve(count);
+    m_parents.reserve(count);
+    m_depths.reserve(count);
+    m_isDirty.reserve(count);
+    m_indexToHandle.reserve(count);
+    m_handleToIndex.reserve(count);
+}
+
+template <typename TType>
+inline
+typename TransformHierarchy<TType>::NodeHandle TransformHierarchy<TType>::addNode (NodeHandle parent)
+{
+    return addNode(parent, Vec3<TType>(), Quaternion<TType>(static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(1)), 
+                   Vec3<TType>(static_cast<TType>(1), static_cast<TType>(1), static_cast<TType>(1)));
+}
+
+template <typename TType>
+inline
+typename TransformHierarchy<TType>::NodeHandle TransformHierarchy<TType>::addNode (NodeHandle parent, const Vec3<TType>& translation, const Quaternion<TType>& rotation, const Vec3<TType>& scale)
+{
+    const size_t      parentIndex = (parent == invalidNode) ? invalidNode : m_handleToIndex[parent];
+    const size_t      depth       = (parent == invalidNode) ? 0 : m_depths[parentIndex] + 1;
+    const size_t      index       = size();
+    const NodeHandle  handle      = m_handleToIndex.size();
+
+    m_localTranslations.push_back(translation);
+    m_localRotations.push_back(rotation);
+    m_localScales.push_back(scale);
+    m_worldTransforms.emplace_back();
+    m_parents.push_back(parentIndex);
+    m_depths.push_back(depth);
+    m_isDirty.push_back(0);
+    m_indexToHandle.push_back(handle);
+    m_handleToIndex.push_back(index);
+
+    m_isLayoutDirty = true;
+    markDirty(index);
+
+    return handle;
+}
+
+template <typename TType>
+inline
+void TransformHierarchy<TType>::update () noexcept
+{
+    updateLevels([](size_t count, size_t grain, auto&& functor)
+    {
+        parallelFor(count, grain, functor);
+    });
+}
+
+template <typename TType>
+inline
+void TransformHierarchy<TType>::update (ThreadPool& pool) noexcept
+{
+    updateLevels([&pool](size_t count, size_t grain, auto&& functor)
+    {
+        pool.parallelFor(count, grain, functor);
+    });
+}
+
+template <typename TType>
+inline
+void TransformHierarchy<TType>::setLocalTranslation (NodeHandle node, const Vec3<TType>& translation) noexcept
+{
+    const size_t index = m_handleToIndex[node];
+    m_localTranslations[index] = translation;
+    markDirty(index);
+}
+
+template <typename TType>
+inline
+void TransformHierarchy<TType>::setLocalRotation (NodeHandle node, const Quaternion<TType>& rotation) noexcept
+{
+    const size_t index = m_handleToIndex[node];
+    m_localRotations[index] = rotation;
+    markDirty(index);
+}
+
+template <typename TType>
+inline
+void TransformHierarchy<TType>::setLocalScale (NodeHandle node, const Vec3<TType>& scale) noexcept
+{
+    const size_t index = m_handleToIndex[node];
+    m_localScales[index] = scale;
+    markDirty(index);
+}
+
+template <typename TType>
+inline
+void TransformHierarchy<TType>::setLocalTRS (NodeHandle node, const Vec3<TType>& translation, const Quaternion<TType>& rotation, const Vec3<TType>& scale) noexcept
+{
+    const size_t index = m_handleToIndex[node];
+    m_localTranslations[index]  = translation;
+    m_localRotations[index]     = rotation;
+    m_localScales[index]        = scale;
+    markDirty(index);
+}
+
+template <typename TType>
+inline constexpr
+Transform<TType> TransformHierarchy<TType>::createLocalTransform (const Vec3<TType>& translation, const Quaternion<TType>& rotation, const Vec3<TType>& scale) noexcept
+{
+    const TType one = static_cast<TType>(1);
+    const TType x = rotation.getX(), y = rotation.getY(), z = rotation.getZ(), w = rotation.getW();
+    const TType twoX = x + x, twoY = y + y, twoZ = z + z;
+    const TType twoXX = twoX * x, twoXY = twoX * y, twoXZ = twoX * z, twoXW = twoX * w;
+    const TType twoYY = twoY * y, twoYZ = twoY * z, twoYW = twoY * w;
+    const TType twoZZ = twoZ * z, twoZW = twoZ * w;
+
+    const TType scaleX = scale[0], scaleY = scale[1], scaleZ = scale[2];
+
+    Transform<TType> rst;
+    std::array<TType, 12>& data = rst.getData();
+
+    data = {(one - twoYY - twoZZ) * scaleX, (twoXY - twoZW) * scaleY,       (twoXZ + twoYW) * scaleZ,       translation[0],
+            (twoXY + twoZW) * scaleX,       (one - twoXX - twoZZ) * scaleY, (twoYZ - twoXW) * scaleZ,       translation[1],
+            (twoXZ - twoYW) * scaleX,       (twoYZ + twoXW) * scaleY,       (one - twoXX - twoYY) * scaleZ, translation[2]};
+
+    return rst;
+}
@@ -35,6 +35,8 @@
 #include "Angle/Angle.hpp"
 #include "Macro/CrossInheritanceCompatibility.hpp"
 #include "Algorythm/Numeric.hpp" //powSigned
+#include "Numeric/Math.hpp" //Math::SinCos
+#include "Numeric/EPrecision.hpp" //EPrecision
 
 namespace FoxMath
 {
@@ -91,6 +93,33 @@ namespace FoxMath
         inline constexpr  
         void		tranformCoMatToAdjointMat		() noexcept;
 
+        /**
+         * @brief Store adjugate / determinant in the matrix. Use reciprocal multiplication for floating point type and division else.
+         * 
+         * @param adjugate : adjugate matrix with the same storage layout than the current matrix
+         * @param determinant : must be not null
+         */
+        inline constexpr  
+        void		setFromAdjugate		(const std::array<TType, TSize * TSize>& adjugate, TType determinant) noexcept;
+
+        /**
+         * @brief Calcul the determinant with gaussian elimination in O(n^3).
+         * Use partial pivoting LU decomposition for floating point type and fraction-free Bareiss algorithm for integral type to stay exact.
+         * 
+         * @return constexpr TType 
+         */
+        [[nodiscard]] inline constexpr  
+        TType		getDeterminantByElimination		() const noexcept;
+
+        /**
+         * @brief Reverse the matrix with Gauss-Jordan elimination and partial pivoting in O(n^3).
+         * 
+         * @return true if matrix is reversed
+         * @return false if matrix is singular. Matrix is not modified.
+         */
+        inline constexpr  
+        bool		reverseByElimination		() noexcept;
+
         #pragma endregion //!methods
     
         public:
@@ -149,6 +178,8 @@ namespace FoxMath
         /**
          * @brief Calcul the derteminant of square matrix X*X.
          *		  If determinant is geometrical area betwen eache vector in matrix.
+         * @note Closed form is used for matrix 2*2, 3*3 and 4*4 (4*4 use the 2*2 sub-determinants of the two first and two last vectors).
+         *       Bigger matrix use LU decomposition with partial pivoting.
          * 
          * @return constexpr TType 
          */
@@ -156,9 +187,10 @@ namespace FoxMath
         TType		getDeterminant		() const noexcept;
 
         /**
-         * @brief reserse matrix if it's possible, else return false. 
-         * If function if orthogonal, this function return the transposate of matrix.
-         * or empty
+         * @brief reserse matrix if it's possible, else return empty matrix.
+         * @note Closed form adjugate / determinant is used for matrix 2*2, 3*3 and 4*4. Bigger matrix use Gauss-Jordan elimination with partial pivoting.
+         * If matrix is an affine transformation, prefer Matrix4::getAffineReverse or Matrix4::getRigidReverse.
+         * To solve A * x = b, prefer LUDecomposition, CholeskyDecomposition or QRDecomposition (see LinearSolver.hpp).
          * 
          * @return Matrix return empty matrix if reverse is not possible
          */
@@ -166,9 +198,8 @@ namespace FoxMath
         SquareMatrix		getReverse		() const noexcept;
 
         /**
-         * @brief reserse matrix if it's possible, else return false.
-         * If function if orthogonal, matrix will be transpose.
-         * or empty
+         * @brief reserse matrix if it's possible, else matrix is fill with zero.
+         * @note Closed form adjugate / determinant is used for matrix 2*2, 3*3 and 4*4. Bigger matrix use Gauss-Jordan elimination with partial pivoting.
          * 
          */
         inline constexpr 
@@ -207,10 +238,12 @@ namespace FoxMath
         /**
          * @brief Create a Rotation Arround Axis Matrix object
          * 
+         * @tparam TPrecision : EPrecision::Fast use minimax sin and cos, EPrecision::Table use the shared lookup table of Math::Table
          * @param unitAxis : Vector to use. Must be unit
          * @param angleRad 
          * @return SquareMatrix 
          */
+        template <EPrecision TPrecision = EPrecision::Precise>
         [[nodiscard]] static inline constexpr
         SquareMatrix createRotationArroundAxisMatrix (const GenericVector<TSize, TType>& unitAxis, Angle<EAngleType::Radian, TType> angle) noexcept
         {
@@ -218,8 +251,9 @@ namespace FoxMath
 
             SquareMatrix rst;
 
-            const TType s = std::sin(static_cast<TType>(angle));
-            const TType c = std::cos(static_cast<TType>(angle));
+            const Math::SinCos<Math::Real<TType>> sinCos = angle.template getSinCos<TPrecision>();
+            const TType s = static_cast<TType>(sinCos.sin);
+            const TType c = static_cast<TType>(sinCos.cos);
             const TType t = (static_cast<TType>(1) - c);
 
             for (size_t i = 0; i < TSize; i++)
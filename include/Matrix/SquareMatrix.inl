@@ -61,7 +61,7 @@ template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
 inline constexpr  
 TType		SquareMatrix<TSize, TType, TMatrixConvention>::getCofactor		(size_t i, size_t j) const noexcept
 {
-	return std::pow(-1, i + j) * getMinor(i, j);
+	return static_cast<TType>(powSign(i + j)) * getMinor(i, j);
 }
 
 template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
@@ -152,73 +152,239 @@ template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
 inline constexpr  
 TType		SquareMatrix<TSize, TType, TMatrixConvention>::getDeterminant		() const noexcept
 {
-    if constexpr (TSize * TSize == 1) //Check if matrix 1*1
+    /*Determinant of transposed matrix is the same. So storage convention can be ignored*/
+    const std::array<TType, TSize * TSize>& m = Parent::m_data;
+
+    if constexpr (TSize == 1)
+    {
+        return m[0];
+    }
+    else if constexpr (TSize == 2)
+    {
+        return m[0] * m[3] - m[1] * m[2];
+    }
+    else if constexpr (TSize == 3)
+    {
+        return    m[0] * (m[4] * m[8] - m[5] * m[7])
+                + m[1] * (m[5] * m[6] - m[3] * m[8])
+                + m[2] * (m[3] * m[7] - m[4] * m[6]);
+    }
+    else if constexpr (TSize == 4)
     {
-        return Parent::getData(0);
+        /*2*2 sub-determinants of the two first vectors*/
+        const TType s0 = m[0] * m[5] - m[4] * m[1];
+        const TType s1 = m[0] * m[6] - m[4] * m[2];
+        const TType s2 = m[0] * m[7] - m[4] * m[3];
+        const TType s3 = m[1] * m[6] - m[5] * m[2];
+        const TType s4 = m[1] * m[7] - m[5] * m[3];
+        const TType s5 = m[2] * m[7] - m[6] * m[3];
+
+        /*2*2 sub-determinants of the two last vectors*/
+        const TType c0 = m[8]  * m[13] - m[12] * m[9];
+        const TType c1 = m[8]  * m[14] - m[12] * m[10];
+        const TType c2 = m[8]  * m[15] - m[12] * m[11];
+        const TType c3 = m[9]  * m[14] - m[13] * m[10];
+        const TType c4 = m[9]  * m[15] - m[13] * m[11];
+        const TType c5 = m[10] * m[15] - m[14] * m[11];
+
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
     }
     else
     {
-        TType result = static_cast<TType>(0);
-        
-        for (size_t i = 0; i < TSize; i++)
+        return getDeterminantByElimination();
+    }
+}
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr  
+TType		SquareMatrix<TSize, TType, TMatrixConvention>::getDeterminantByElimination		() const noexcept
+{
+    std::array<TType, TSize * TSize> a = Parent::m_data;
+    TType determinant = static_cast<TType>(1);
+
+    if constexpr (std::is_floating_point_v<TType>)
+    {
+        for (size_t k = 0; k < TSize; k++)
         {
-            //found signe
-            signed char signe = powSign(0 + i);
+            /*Partial pivoting : use the biggest coeficient of the column*/
+            size_t pivot = k;
+            TType pivotAbs = a[k * TSize + k] < static_cast<TType>(0) ? -a[k * TSize + k] : a[k * TSize + k];
 
-            //found coef
-            TType coef = signe * Parent::m_data[i * TSize];
-        
-            //create submatrix
-            const size_t subMatrixSize = TSize - 1;
-            SquareMatrix<subMatrixSize, TType, TMatrixConvention> subMatrix;
+            for (size_t i = k + 1; i < TSize; i++)
+            {
+                const TType coefAbs = a[i * TSize + k] < static_cast<TType>(0) ? -a[i * TSize + k] : a[i * TSize + k];
+                if (coefAbs > pivotAbs)
+                {
+                    pivot = i;
+                    pivotAbs = coefAbs;
+                }
+            }
 
-            //fill submatrix
-            bool coefLineFound = false;
+            if (pivotAbs == static_cast<TType>(0))
+                return static_cast<TType>(0);
 
-            for (size_t iSubMatrix = 0; iSubMatrix < subMatrixSize; iSubMatrix++)
+            if (pivot != k)
             {
-                if (iSubMatrix == i)
-                    coefLineFound = true;
+                for (size_t j = k; j < TSize; j++)
+                {
+                    const TType temp = a[k * TSize + j];
+                    a[k * TSize + j] = a[pivot * TSize + j];
+                    a[pivot * TSize + j] = temp;
+                }
+                determinant = -determinant;
+            }
+
+            determinant *= a[k * TSize + k];
+
+            const TType pivotReciprocal = static_cast<TType>(1) / a[k * TSize + k];
 
-                for (size_t jSubMatrix = 0; jSubMatrix < subMatrixSize; jSubMatrix++)
-                { 
-                    subMatrix.getData(iSubMatrix * subMatrixSize + jSubMatrix) = Parent::m_data[(iSubMatrix + coefLineFound) * TSize + jSubMatrix + 1];
+            for (size_t i = k + 1; i < TSize; i++)
+            {
+                const TType factor = a[i * TSize + k] * pivotReciprocal;
+
+                for (size_t j = k + 1; j < TSize; j++)
+                {
+                    a[i * TSize + j] -= factor * a[k * TSize + j];
                 }
             }
+        }
 
-            //found determinant
-            TType determinant = subMatrix.getDeterminant();
+        return determinant;
+    }
+    else
+    {
+        /*Bareiss algorithm : each division is exact so integral result stay exact*/
+        TType previousPivot = static_cast<TType>(1);
+
+        for (size_t k = 0; k < TSize - 1; k++)
+        {
+            if (a[k * TSize + k] == static_cast<TType>(0))
+            {
+                size_t pivot = k + 1;
+                while (pivot < TSize && a[pivot * TSize + k] == static_cast<TType>(0))
+                    pivot++;
+
+                if (pivot == TSize)
+                    return static_cast<TType>(0);
+
+                for (size_t j = k; j < TSize; j++)
+                {
+                    const TType temp = a[k * TSize + j];
+                    a[k * TSize + j] = a[pivot * TSize + j];
+                    a[pivot * TSize + j] = temp;
+                }
+                determinant = -determinant;
+            }
 
-            //found result
-            result += coef * determinant;
+            for (size_t i = k + 1; i < TSize; i++)
+            {
+                for (size_t j = k + 1; j < TSize; j++)
+                {
+                    a[i * TSize + j] = (a[i * TSize + j] * a[k * TSize + k] - a[i * TSize + k] * a[k * TSize + j]) / previousPivot;
+                }
+            }
+
+            previousPivot = a[k * TSize + k];
         }
-        
-        return result;
+
+        return determinant * a[TSize * TSize - 1];
     }
 }
 
 template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
 inline constexpr  
-SquareMatrix<TSize, TType, TMatrixConvention>		SquareMatrix<TSize, TType, TMatrixConvention>::getReverse		() const noexcept
+void		SquareMatrix<TSize, TType, TMatrixConvention>::setFromAdjugate		(const std::array<TType, TSize * TSize>& adjugate, TType determinant) noexcept
 {
-	assert ((*this) != static_cast<TType>(0));
+    if constexpr (std::is_floating_point_v<TType>)
+    {
+        const TType determinantReciprocal = static_cast<TType>(1) / determinant;
 
-	if (isOrtho() == true)
-	{
-		return Parent::getTransposed();
-	}
+        for (size_t i = 0; i < TSize * TSize; i++)
+            Parent::m_data[i] = adjugate[i] * determinantReciprocal;
+    }
+    else
+    {
+        for (size_t i = 0; i < TSize * TSize; i++)
+            Parent::m_data[i] = adjugate[i] / determinant;
+    }
+}
 
-	const TType determinant = getDeterminant();
-	
-	if (isSameAsZero<TType>(determinant)) //in two step for more perform
-		return SquareMatrix<TSize, TType, TMatrixConvention>::zero();
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr  
+bool		SquareMatrix<TSize, TType, TMatrixConvention>::reverseByElimination		() noexcept
+{
+    std::array<TType, TSize * TSize> a = Parent::m_data;
+    std::array<TType, TSize * TSize> inverse {};
+
+    for (size_t i = 0; i < TSize; i++)
+        inverse[i * TSize + i] = static_cast<TType>(1);
+
+    for (size_t k = 0; k < TSize; k++)
+    {
+        /*Partial pivoting : use the biggest coeficient of the column*/
+        size_t pivot = k;
+        TType pivotAbs = a[k * TSize + k] < static_cast<TType>(0) ? -a[k * TSize + k] : a[k * TSize + k];
+
+        for (size_t i = k + 1; i < TSize; i++)
+        {
+            const TType coefAbs = a[i * TSize + k] < static_cast<TType>(0) ? -a[i * TSize + k] : a[i * TSize + k];
+            if (coefAbs > pivotAbs)
+            {
+                pivot = i;
+                pivotAbs = coefAbs;
+            }
+        }
+
+        if (pivotAbs == static_cast<TType>(0))
+            return false;
+
+        if (pivot != k)
+        {
+            for (size_t j = 0; j < TSize; j++)
+            {
+                TType temp = a[k * TSize + j];
+                a[k * TSize + j] = a[pivot * TSize + j];
+                a[pivot * TSize + j] = temp;
+
+                temp = inverse[k * TSize + j];
+                inverse[k * TSize + j] = inverse[pivot * TSize + j];
+                inverse[pivot * TSize + j] = temp;
+            }
+        }
+
+        const TType pivotReciprocal = static_cast<TType>(1) / a[k * TSize + k];
+
+        for (size_t j = 0; j < TSize; j++)
+        {
+            a[k * TSize + j] *= pivotReciprocal;
+            inverse[k * TSize + j] *= pivotReciprocal;
+        }
+
+        for (size_t i = 0; i < TSize; i++)
+        {
+            const TType factor = a[i * TSize + k];
 
-	SquareMatrix<TSize, TType, TMatrixConvention> reversedMatrix = getCoMatrix();
+            if (i == k || factor == static_cast<TType>(0))
+                continue;
 
-	reversedMatrix.tranformCoMatToAdjointMat();
+            for (size_t j = 0; j < TSize; j++)
+            {
+                a[i * TSize + j] -= factor * a[k * TSize + j];
+                inverse[i * TSize + j] -= factor * inverse[k * TSize + j];
+            }
+        }
+    }
 
-	reversedMatrix /= determinant;
+    Parent::m_data = inverse;
+    return true;
+}
 
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr  
+SquareMatrix<TSize, TType, TMatrixConvention>		SquareMatrix<TSize, TType, TMatrixConvention>::getReverse		() const noexcept
+{
+	SquareMatrix<TSize, TType, TMatrixConvention> reversedMatrix (*this);
+	reversedMatrix.reverse();
 	return reversedMatrix;
 }
 
@@ -228,23 +394,90 @@ SquareMatrix<TSize, TType, TMatrixConvention>&		SquareMatrix<TSize, TType, TMatr
 {
 	assert ((*this) != static_cast<TType>(0));
 
-	if (isOrtho() == true)
-	{
-        transpose();
-		return *this;
-	}
+    /*inverse(transpose(M)) = transpose(inverse(M)). So the same formula work on the storage of both convention*/
+    const std::array<TType, TSize * TSize>& m = Parent::m_data;
 
-	const TType determinant = getDeterminant();
-	
-	if (isSameAsZero<TType>(determinant)) //in two step for more perform
+    if constexpr (TSize <= 4)
     {
-        Parent::fill(static_cast<TType>(0));
-		return *this;
+        const TType determinant = getDeterminant();
+
+        if (isSameAsZero<TType>(determinant))
+        {
+            Parent::fill(static_cast<TType>(0));
+            return *this;
+        }
+
+        if constexpr (TSize == 1)
+        {
+            setFromAdjugate({static_cast<TType>(1)}, determinant);
+        }
+        else if constexpr (TSize == 2)
+        {
+            setFromAdjugate({m[3], -m[1], -m[2], m[0]}, determinant);
+        }
+        else if constexpr (TSize == 3)
+        {
+            setFromAdjugate({m[4] * m[8] - m[5] * m[7], m[2] * m[7] - m[1] * m[8], m[1] * m[5] - m[2] * m[4],
+                             m[5] * m[6] - m[3] * m[8], m[0] * m[8] - m[2] * m[6], m[2] * m[3] - m[0] * m[5],
+                             m[3] * m[7] - m[4] * m[6], m[1] * m[6] - m[0] * m[7], m[0] * m[4] - m[1] * m[3]}, determinant);
+        }
+        else
+        {
+            const TType s0 = m[0] * m[5] - m[4] * m[1];
+            const TType s1 = m[0] * m[6] - m[4] * m[2];
+            const TType s2 = m[0] * m[7] - m[4] * m[3];
+            const TType s3 = m[1] * m[6] - m[5] * m[2];
+            const TType s4 = m[1] * m[7] - m[5] * m[3];
+            const TType s5 = m[2] * m[7] - m[6] * m[3];
+
+            const TType c0 = m[8]  * m[13] - m[12] * m[9];
+            const TType c1 = m[8]  * m[14] - m[12] * m[10];
+            const TType c2 = m[8]  * m[15] - m[12] * m[11];
+            const TType c3 = m[9]  * m[14] - m[13] * m[10];
+            const TType c4 = m[9]  * m[15] - m[13] * m[11];
+            const TType c5 = m[10] * m[15] - m[14] * m[11];
+
+            setFromAdjugate({ m[5]  * c5 - m[6]  * c4 + m[7]  * c3,
+                             -m[1]  * c5 + m[2]  * c4 - m[3]  * c3,
+                              m[13] * s5 - m[14] * s4 + m[15] * s3,
+                             -m[9]  * s5 + m[10] * s4 - m[11] * s3,
+
+                             -m[4]  * c5 + m[6]  * c2 - m[7]  * c1,
+                              m[0]  * c5 - m[2]  * c2 + m[3]  * c1,
+                             -m[12] * s5 + m[14] * s2 - m[15] * s1,
+                              m[8]  * s5 - m[10] * s2 + m[11] * s1,
+
+                              m[4]  * c4 - m[5]  * c2 + m[7]  * c0,
+                             -m[0]  * c4 + m[1]  * c2 - m[3]  * c0,
+                              m[12] * s4 - m[13] * s2 + m[15] * s0,
+                             -m[8]  * s4 + m[9]  * s2 - m[11] * s0,
+
+                             -m[4]  * c3 + m[5]  * c1 - m[6]  * c0,
+                              m[0]  * c3 - m[1]  * c1 + m[2]  * c0,
+                             -m[12] * s3 + m[13] * s1 - m[14] * s0,
+                              m[8]  * s3 - m[9]  * s1 + m[10] * s0}, determinant);
+        }
+    }
+    else if constexpr (std::is_floating_point_v<TType>)
+    {
+        if (!reverseByElimination())
+            Parent::fill(static_cast<TType>(0));
     }
+    else
+    {
+        /*Integral type cannot be eliminate without lose precision : use the adjugate*/
+        const TType determinant = getDeterminant();
+        
+        if (isSameAsZero<TType>(determinant))
+        {
+            Parent::fill(static_cast<TType>(0));
+            return *this;
+        }
 
-	(*this) = getCoMatrix();
-	tranformCoMatToAdjointMat();
-	(*this) /= determinant;
+        (*this) = getCoMatrix();
+        tranformCoMatToAdjointMat();
+        (*this) /= determinant;
+    }
 
     return *this;
 }
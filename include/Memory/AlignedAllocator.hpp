@@ -0,0 +1,121 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <new> //operator new, std::align_val_t, std::bad_alloc
+#include <limits> //std::numeric_limits
+
+namespace FoxMath
+{
+    /**
+     * @brief Standard allocator that returns memory aligned on TAlignment bytes. Used to store streams loaded in SIMD register.
+     * @example `std::vector<float, AlignedAllocator<float, 64>> stream`
+     *
+     * @tparam TType
+     * @tparam TAlignment : power of two, greater or equal to alignof(TType)
+     */
+    template <typename TType, size_t TAlignment = 64>
+    class AlignedAllocator
+    {
+        static_assert((TAlignment & (TAlignment - 1)) == 0, "Alignment must be a power of two");
+        static_assert(TAlignment >= alignof(TType), "Alignment must be greater or equal to the natural alignment of the type");
+
+        public:
+
+        using value_type = TType;
+
+        template <typename TTypeOther>
+        struct rebind
+        {
+            using other = AlignedAllocator<TTypeOther, TAlignment>;
+        };
+
+        #pragma region constructor/destructor
+
+        constexpr inline
+        AlignedAllocator () noexcept                                        = default;
+
+        constexpr inline
+        AlignedAllocator (const AlignedAllocator& other) noexcept           = default;
+
+        template <typename TTypeOther>
+        constexpr inline
+        AlignedAllocator (const AlignedAllocator<TTypeOther, TAlignment>&) noexcept
+        {}
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Allocate count elements of TType aligned on TAlignment
+         *
+         * @param count
+         * @return TType*
+         */
+        [[nodiscard]] inline
+        TType* allocate (size_t count)
+        {
+            if (count > std::numeric_limits<size_t>::max() / sizeof(TType)) [[unlikely]]
+                throw std::bad_alloc();
+
+            return static_cast<TType*>(::operator new(count * sizeof(TType), std::align_val_t{TAlignment}));
+        }
+
+        /**
+         * @brief Release memory returned by allocate
+         *
+         * @param ptr
+         */
+        inline
+        void deallocate (TType* ptr, size_t) noexcept
+        {
+            ::operator delete(ptr, std::align_val_t{TAlignment});
+        }
+
+        #pragma endregion //!methods
+    };
+
+    template <typename TType, typename TTypeOther, size_t TAlignment>
+    [[nodiscard]] constexpr inline
+    bool operator==(const AlignedAllocator<TType, TAlignment>&, const AlignedAllocator<TTypeOther, TAlignment>&) noexcept
+    {
+        return true;
+    }
+
+    template <typename TType, typename TTypeOther, size_t TAlignment>
+    [[nodiscard]] constexpr inline
+    bool operator!=(const AlignedAllocator<TType, TAlignment>&, const AlignedAllocator<TTypeOther, TAlignment>&) noexcept
+    {
+        return false;
+    }
+
+} /*namespace FoxMath*/
@@ -0,0 +1,258 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <cassert> //assert
+#include <new> //operator new, std::align_val_t, std::bad_alloc
+#include <limits> //std::numeric_limits
+#include <utility> //std::exchange
+
+namespace FoxMath
+{
+    /**
+     * @brief Monotonic buffer for per frame scratch memory. Allocation bumps an offset in one aligned block and memory is released all at once with reset().
+     * @note Not thread safe : use one arena per thread
+     * @example `Arena frameArena (1 << 20); DynamicVector<float, ArenaAllocator<float>> tmp (size, ArenaAllocator<float>(frameArena)); [...] frameArena.reset();`
+     */
+    class Arena
+    {
+        protected:
+
+        #pragma region attribut
+
+        /*Alignment of the block, allocations with greater alignment are not allowed*/
+        static constexpr size_t blockAlignment = 64;
+
+        unsigned char*  m_buffer    {nullptr};
+        size_t          m_capacity  {0};
+        size_t          m_offset    {0};
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Allocate the block of capacity bytes
+         * 
+         * @param capacity 
+         */
+        explicit inline
+        Arena (size_t capacity)
+            : m_buffer {static_cast<unsigned char*>(::operator new(capacity, std::align_val_t{blockAlignment}))}, m_capacity {capacity}
+        {}
+
+        inline
+        Arena (const Arena& other) = delete;
+
+        inline
+        Arena (Arena&& other) noexcept
+            : m_buffer {std::exchange(other.m_buffer, nullptr)}, m_capacity {std::exchange(other.m_capacity, 0)}, m_offset {std::exchange(other.m_offset, 0)}
+        {}
+
+        inline
+        ~Arena () noexcept
+        {
+            if (m_buffer)
+                ::operator delete(m_buffer, std::align_val_t{blockAlignment});
+        }
+
+        inline
+        Arena& operator=(const Arena& other) = delete;
+
+        inline
+        Arena& operator=(Arena&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_buffer)
+                    ::operator delete(m_buffer, std::align_val_t{blockAlignment});
+
+                m_buffer    = std::exchange(other.m_buffer, nullptr);
+                m_capacity  = std::exchange(other.m_capacity, 0);
+                m_offset    = std::exchange(other.m_offset, 0);
+            }
+            return *this;
+        }
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Return size bytes aligned on alignment. Throw std::bad_alloc if the arena is full
+         * 
+         * @param size 
+         * @param alignment : power of two, less or equal to 64
+         * @return void* 
+         */
+        [[nodiscard]] inline
+        void* allocate (size_t size, size_t alignment)
+        {
+            assert((alignment & (alignment - 1)) == 0 && alignment <= blockAlignment);
+
+            const size_t begin = (m_offset + alignment - 1) & ~(alignment - 1);
+
+            if (begin > m_capacity || size > m_capacity - begin) [[unlikely]]
+                throw std::bad_alloc();
+
+            m_offset = begin + size;
+            return m_buffer + begin;
+        }
+
+        /**
+         * @brief Release all the allocations at once. Objects allocated in the arena must not be used after
+         * 
+         */
+        inline
+        void reset () noexcept
+        {
+            m_offset = 0;
+        }
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        size_t getCapacity () const noexcept
+        {
+            return m_capacity;
+        }
+
+        [[nodiscard]] inline
+        size_t getUsedSize () const noexcept
+        {
+            return m_offset;
+        }
+
+        #pragma endregion //!accessor
+    };
+
+    /**
+     * @brief Standard allocator that allocates in an Arena. deallocate does nothing : memory is released by Arena::reset
+     * @example `std::vector<float, ArenaAllocator<float>> scratch (ArenaAllocator<float>(frameArena))`
+     *
+     * @tparam TType
+     * @tparam TAlignment : power of two, greater or equal to alignof(TType) and less or equal to 64
+     */
+    template <typename TType, size_t TAlignment = 64>
+    class ArenaAllocator
+    {
+        static_assert((TAlignment & (TAlignment - 1)) == 0, "Alignment must be a power of two");
+        static_assert(TAlignment >= alignof(TType), "Alignment must be greater or equal to the natural alignment of the type");
+        static_assert(TAlignment <= 64, "Alignment must be less or equal to the alignment of the arena");
+
+        template <typename TTypeOther, size_t TAlignmentOther>
+        friend class ArenaAllocator;
+
+        protected:
+
+        Arena* m_arena;
+
+        public:
+
+        using value_type = TType;
+
+        template <typename TTypeOther>
+        struct rebind
+        {
+            using other = ArenaAllocator<TTypeOther, TAlignment>;
+        };
+
+        #pragma region constructor/destructor
+
+        explicit constexpr inline
+        ArenaAllocator (Arena& arena) noexcept
+            : m_arena {&arena}
+        {}
+
+        constexpr inline
+        ArenaAllocator (const ArenaAllocator& other) noexcept               = default;
+
+        template <typename TTypeOther>
+        constexpr inline
+        ArenaAllocator (const ArenaAllocator<TTypeOther, TAlignment>& other) noexcept
+            : m_arena {other.m_arena}
+        {}
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Allocate count elements of TType aligned on TAlignment in the arena
+         *
+         * @param count
+         * @return TType*
+         */
+        [[nodiscard]] inline
+        TType* allocate (size_t count)
+        {
+            if (count > std::numeric_limits<size_t>::max() / sizeof(TType)) [[unlikely]]
+                throw std::bad_alloc();
+
+            return static_cast<TType*>(m_arena->allocate(count * sizeof(TType), TAlignment));
+        }
+
+        inline
+        void deallocate (TType*, size_t) noexcept
+        {}
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] constexpr inline
+        Arena& getArena () const noexcept
+        {
+            return *m_arena;
+        }
+
+        #pragma endregion //!accessor
+    };
+
+    template <typename TType, typename TTypeOther, size_t TAlignment>
+    [[nodiscard]] constexpr inline
+    bool operator==(const ArenaAllocator<TType, TAlignment>& lhs, const ArenaAllocator<TTypeOther, TAlignment>& rhs) noexcept
+    {
+        return &lhs.getArena() == &rhs.getArena();
+    }
+
+    template <typename TType, typename TTypeOther, size_t TAlignment>
+    [[nodiscard]] constexpr inline
+    bool operator!=(const ArenaAllocator<TType, TAlignment>& lhs, const ArenaAllocator<TTypeOther, TAlignment>& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+} /*namespace FoxMath*/
@@ -0,0 +1,67 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 18 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+namespace FoxMath
+{
+    /**
+     * @brief Precision policy of math functions.
+     * Precise use the standard library (or constexpr series at compile time).
+     * Fast use hardware reciprocal square root refined by one Newton step and minimax polynomial trigonometry. 
+     * Table use a quantized angle lookup table with linear interpolation for sin, cos and sincos (see Math::Table), other functions use Precise.
+     * Without hardware support or at compile time, Fast and Table fallback on Precise.
+     */
+    enum class EPrecision
+    {
+        Precise,
+        Fast,
+        Table
+    };
+
+    [[nodiscard]] constexpr inline
+    const char* precisionToString (EPrecision precision) noexcept
+    {
+        switch (precision)
+        {
+        case EPrecision::Precise:
+            return "Precise";
+
+        case EPrecision::Fast:
+            return "Fast";
+
+        case EPrecision::Table:
+            return "Table";
+        
+        default:
+            return "Unknow";
+        }
+    }
+
+} /*namespace FoxMath*/
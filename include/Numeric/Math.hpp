@@ -0,0 +1,994 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 17 h 45
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Numeric/SIMD.hpp" //FOXMATH_IS_CONSTANT_EVALUATED, FOXMATH_USE_SIMD
+#include "Numeric/EPrecision.hpp" //EPrecision
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<T>, IsFloatingPoint<T>
+
+#include <array> //std::array
+#include <cmath> //std::sqrt, std::sin, std::cos, std::tan, std::acos, std::atan, std::atan2, std::exp, std::log, std::pow
+#include <cstddef> //std::size_t
+#include <limits> //std::numeric_limits
+#include <type_traits> //std::conditional_t, std::common_type_t
+
+/**
+ * @brief Math kernel usable in constant expression. Each function dispatch on FOXMATH_IS_CONSTANT_EVALUATED :
+ * at compile time it use the series/Newton implementation of Math::Constexpr, at runtime the standard library (i.e. hardware instructions).
+ * Without FOXMATH_IS_CONSTANT_EVALUATED (compiler older than GCC 9/Clang 9/MSVC 19.25), the standard library is always used.
+ * Integral arguments are computed and returned as double like the standard library. float is computed with double at compile time.
+ * sqrt, rsqrt, sin, cos and sincos take an EPrecision policy : EPrecision::Fast use the Math::Fast approximation at runtime,
+ * EPrecision::Table use the shared lookup table of Math::Table for sin, cos and sincos.
+ * The resolution of this shared table can be changed with FOXMATH_SINCOS_TABLE_RESOLUTION (power of 2, 4096 by default)
+ * and its linear interpolation replaced by nearest step with FOXMATH_SINCOS_TABLE_NEAREST.
+ */
+
+#ifndef FOXMATH_SINCOS_TABLE_RESOLUTION
+#define FOXMATH_SINCOS_TABLE_RESOLUTION 4096
+#endif
+namespace FoxMath::Math
+{
+    /**
+     * @brief Result type of a math function. Integral argument are promoted to double like the standard library
+     * 
+     * @tparam T 
+     */
+    template <typename T>
+    using Real = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+    /**
+     * @brief Sine and cosine of the same angle returned by sincos
+     * 
+     * @tparam T 
+     */
+    template <typename T>
+    struct SinCos
+    {
+        T sin;
+        T cos;
+    };
+
+    namespace Constexpr
+    {
+        /*float is computed with double to return correctly rounded result*/
+        template <typename T>
+        using Compute = std::conditional_t<std::is_same_v<Real<T>, float>, double, Real<T>>;
+
+        template <typename T>
+        inline constexpr T pi       = static_cast<T>(3.14159265358979323846264338327950288L);
+
+        template <typename T>
+        inline constexpr T halfPi   = static_cast<T>(1.57079632679489661923132169163975144L);
+
+        /*Cody and Waite constants : ln2 = ln2Hi + ln2Lo and pi/2 = halfPi1 + halfPi2 + halfPi3 with exact product by small integer*/
+        inline constexpr double ln2Hi   = 6.93147180369123816490e-01;
+        inline constexpr double ln2Lo   = 1.90821492927058770002e-10;
+        inline constexpr double halfPi1 = 1.57079632673412561417e+00;
+        inline constexpr double halfPi2 = 6.07710050630396597660e-11;
+        inline constexpr double halfPi3 = 2.02226624879595063154e-21;
+
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T abs (T x) noexcept
+        {
+            return x < static_cast<T>(0) ? -x : x;
+        }
+
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        bool isNaN (T x) noexcept
+        {
+            return x != x;
+        }
+
+        /**
+         * @brief Round to nearest integer
+         * @note x must be in the range of long long
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        long long round (T x) noexcept
+        {
+            return static_cast<long long>(x < static_cast<T>(0) ? x - static_cast<T>(0.5) : x + static_cast<T>(0.5));
+        }
+
+        /**
+         * @brief Multiply x by 2^exponent. Product by power of 2 are exact until denormal range
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T scaleByPowerOfTwo (T x, long long exponent) noexcept
+        {
+            for (; exponent > 0; exponent--)
+                x *= static_cast<T>(2);
+
+            for (; exponent < 0; exponent++)
+                x *= static_cast<T>(0.5);
+
+            return x;
+        }
+
+        /**
+         * @brief Newton-Raphson square root. x is scaled by power of 4 in [0.25, 4[ so the iteration converge in few steps
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T sqrt (T x) noexcept
+        {
+            if (isNaN(x) || x < static_cast<T>(0))
+                return std::numeric_limits<T>::quiet_NaN();
+
+            if (x == static_cast<T>(0) || x == std::numeric_limits<T>::infinity())
+                return x;
+
+            T scale = static_cast<T>(1);
+
+            for (; x >= static_cast<T>(4); x *= static_cast<T>(0.25))
+                scale *= static_cast<T>(2);
+
+            for (; x < static_cast<T>(0.25); x *= static_cast<T>(4))
+                scale *= static_cast<T>(0.5);
+
+            T current   = (static_cast<T>(1) + x) * static_cast<T>(0.5);
+            T previous  = static_cast<T>(0);
+
+            /*Stop when the value converge or oscillate between the two nearest values*/
+            for (T next = current; ; previous = current, current = next)
+            {
+                next = (current + x / current) * static_cast<T>(0.5);
+
+                if (next == current || next == previous)
+                    break;
+            }
+
+            return current * scale;
+        }
+
+        /**
+         * @brief Taylor series of sin on [-pi/4, pi/4]
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T sinReduced (T x) noexcept
+        {
+            const T x2  = x * x;
+            T term      = x;
+            T sum       = x;
+
+            for (int n = 1; sum + term != sum; n++)
+            {
+                term *= -x2 / static_cast<T>((2 * n) * (2 * n + 1));
+                sum  += term;
+            }
+
+            return sum;
+        }
+
+        /**
+         * @brief Taylor series of cos on [-pi/4, pi/4]
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T cosReduced (T x) noexcept
+        {
+            const T x2  = x * x;
+            T term      = static_cast<T>(1);
+            T sum       = static_cast<T>(1);
+
+            for (int n = 1; sum + term != sum; n++)
+            {
+                term *= -x2 / static_cast<T>((2 * n - 1) * (2 * n));
+                sum  += term;
+            }
+
+            return sum;
+        }
+
+        /**
+         * @brief Reduce x in [-pi/4, pi/4] and return its quadrant (x = quadrant * pi/2 + reduced)
+         * @note Reduction is accurate for |x| < 1e5
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T reduceQuadrant (T x, long long& quadrant) noexcept
+        {
+            quadrant = round(x / halfPi<T>);
+
+            const T k = static_cast<T>(quadrant);
+            return ((x - k * static_cast<T>(halfPi1)) - k * static_cast<T>(halfPi2)) - k * static_cast<T>(halfPi3);
+        }
+
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T sin (T x) noexcept
+        {
+            if (isNaN(x) || abs(x) == std::numeric_limits<T>::infinity())
+                return std::numeric_limits<T>::quiet_NaN();
+
+            long long quadrant = 0;
+            const T reduced = reduceQuadrant(x, quadrant);
+
+            switch (quadrant & 3)
+            {
+                case 0  : return sinReduced(reduced);
+                case 1  : return cosReduced(reduced);
+                case 2  : return -sinReduced(reduced);
+                default : return -cosReduced(reduced);
+            }
+        }
+
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T cos (T x) noexcept
+        {
+            if (isNaN(x) || abs(x) == std::numeric_limits<T>::infinity())
+                return std::numeric_limits<T>::quiet_NaN();
+
+            long long quadrant = 0;
+            const T reduced = reduceQuadrant(x, quadrant);
+
+            switch (quadrant & 3)
+            {
+                case 0  : return cosReduced(reduced);
+                case 1  : return -sinReduced(reduced);
+                case 2  : return -cosReduced(reduced);
+                default : return sinReduced(reduced);
+            }
+        }
+
+        /**
+         * @brief sin and cos sharing the same quadrant reduction
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        SinCos<T> sincos (T x) noexcept
+        {
+            if (isNaN(x) || abs(x) == std::numeric_limits<T>::infinity())
+                return {std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::quiet_NaN()};
+
+            long long quadrant = 0;
+            const T reduced = reduceQuadrant(x, quadrant);
+            const T sinR    = sinReduced(reduced);
+            const T cosR    = cosReduced(reduced);
+
+            switch (quadrant & 3)
+            {
+                case 0  : return {sinR, cosR};
+                case 1  : return {cosR, -sinR};
+                case 2  : return {-sinR, -cosR};
+                default : return {-cosR, sinR};
+            }
+        }
+
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T tan (T x) noexcept
+        {
+            return sin(x) / cos(x);
+        }
+
+        /**
+         * @brief atan with argument reduction : atan(x) = pi/2 - atan(1/x) for x > 1 and atan(x) = pi/6 + atan((sqrt(3)x - 1) / (x + sqrt(3))) for x > 2 - sqrt(3).
+         * The Taylor series converge quickly on [0, 2 - sqrt(3)]
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T atan (T x) noexcept
+        {
+            if (isNaN(x))
+                return x;
+
+            if (x < static_cast<T>(0))
+                return -atan(-x);
+
+            if (x > static_cast<T>(1))
+                return halfPi<T> - atan(static_cast<T>(1) / x);
+
+            const T sqrt3 = static_cast<T>(1.73205080756887729352744634150587237L);
+
+            if (x > static_cast<T>(0.26794919243112270647255365849412763L))
+                return pi<T> / static_cast<T>(6) + atan((sqrt3 * x - static_cast<T>(1)) / (x + sqrt3));
+
+            const T x2  = x * x;
+            T power     = x;
+            T sum       = x;
+
+            for (int n = 1; ; n++)
+            {
+                power *= -x2;
+                const T term = power / static_cast<T>(2 * n + 1);
+
+                if (sum + term == sum)
+                    break;
+
+                sum += term;
+            }
+
+            return sum;
+        }
+
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T atan2 (T y, T x) noexcept
+        {
+            if (isNaN(x) || isNaN(y))
+                return std::numeric_limits<T>::quiet_NaN();
+
+            if (x > static_cast<T>(0))
+                return atan(y / x);
+
+            if (x < static_cast<T>(0))
+                return (y < static_cast<T>(0)) ? atan(y / x) - pi<T> : atan(y / x) + pi<T>;
+
+            if (y == static_cast<T>(0))
+                return y;
+
+            return (y < static_cast<T>(0)) ? -halfPi<T> : halfPi<T>;
+        }
+
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T acos (T x) noexcept
+        {
+            if (isNaN(x) || abs(x) > static_cast<T>(1))
+                return std::numeric_limits<T>::quiet_NaN();
+
+            /*sin(acos(x)) = sqrt((1 - x)(1 + x)) keep the precision near 1*/
+            return atan2(sqrt((static_cast<T>(1) - x) * (static_cast<T>(1) + x)), x);
+        }
+
+        /**
+         * @brief exp(x) = 2^k * exp(r) with r = x - k * ln2 in [-ln2/2, ln2/2]
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T exp (T x) noexcept
+        {
+            if (isNaN(x))
+                return x;
+
+            if (x > static_cast<T>(std::numeric_limits<T>::max_exponent) * static_cast<T>(0.6931471805599453))
+                return std::numeric_limits<T>::infinity();
+
+            if (x < static_cast<T>(std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits) * static_cast<T>(0.6931471805599453))
+                return static_cast<T>(0);
+
+            const long long k   = round(x / static_cast<T>(0.69314718055994530941723212145817657L));
+            const T reduced     = (x - static_cast<T>(k) * static_cast<T>(ln2Hi)) - static_cast<T>(k) * static_cast<T>(ln2Lo);
+
+            T term  = static_cast<T>(1);
+            T sum   = static_cast<T>(1);
+
+            for (int n = 1; sum + term != sum; n++)
+            {
+                term *= reduced / static_cast<T>(n);
+                sum  += term;
+            }
+
+            return scaleByPowerOfTwo(sum, k);
+        }
+
+        /**
+         * @brief log(x) = e * ln2 + log(m) with m in [sqrt(2)/2, sqrt(2)] and log(m) = 2 atanh((m - 1) / (m + 1))
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T log (T x) noexcept
+        {
+            if (isNaN(x) || x < static_cast<T>(0))
+                return std::numeric_limits<T>::quiet_NaN();
+
+            if (x == static_cast<T>(0))
+                return -std::numeric_limits<T>::infinity();
+
+            if (x == std::numeric_limits<T>::infinity())
+                return x;
+
+            long long exponent = 0;
+
+            for (; x >= static_cast<T>(2); x *= static_cast<T>(0.5))
+                exponent++;
+
+            for (; x < static_cast<T>(1); x *= static_cast<T>(2))
+                exponent--;
+
+            if (x > static_cast<T>(1.41421356237309504880168872420969808L))
+            {
+                x *= static_cast<T>(0.5);
+                exponent++;
+            }
+
+            const T s   = (x - static_cast<T>(1)) / (x + static_cast<T>(1));
+            const T s2  = s * s;
+            T power     = s;
+            T sum       = s;
+
+            for (int n = 1; ; n++)
+            {
+                power *= s2;
+                const T term = power / static_cast<T>(2 * n + 1);
+
+                if (sum + term == sum)
+                    break;
+
+                sum += term;
+            }
+
+            const T k = static_cast<T>(exponent);
+            return k * static_cast<T>(ln2Hi) + (static_cast<T>(2) * sum + k * static_cast<T>(ln2Lo));
+        }
+
+        /**
+         * @brief Exponentiation by squaring
+         */
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T powInteger (T base, long long exponent) noexcept
+        {
+            const bool isNegative = exponent < 0;
+            unsigned long long remaining = static_cast<unsigned long long>(isNegative ? -exponent : exponent);
+            T rst = static_cast<T>(1);
+
+            for (; remaining; remaining >>= 1, base *= base)
+            {
+                if (remaining & 1)
+                    rst *= base;
+            }
+
+            return isNegative ? static_cast<T>(1) / rst : rst;
+        }
+
+        template <typename T>
+        [[nodiscard]] inline constexpr
+        T pow (T base, T exponent) noexcept
+        {
+            if (isNaN(base) || isNaN(exponent))
+                return (exponent == static_cast<T>(0)) ? static_cast<T>(1) : std::numeric_limits<T>::quiet_NaN();
+
+            /*Integral exponent keep the sign of negative base*/
+            if (abs(exponent) < static_cast<T>(1LL << 53) && static_cast<T>(static_cast<long long>(exponent)) == exponent)
+                return powInteger(base, static_cast<long long>(exponent));
+
+            if (base < static_cast<T>(0))
+                return std::numeric_limits<T>::quiet_NaN();
+
+            if (base == static_cast<T>(0))
+                return (exponent > static_cast<T>(0)) ? static_cast<T>(0) : std::numeric_limits<T>::infinity();
+
+            return exp(exponent * log(base));
+        }
+
+    } /*namespace FoxMath::Math::Constexpr*/
+
+    /**
+     * @brief Runtime approximations used by EPrecision::Fast. Errors are measured against the standard library on float.
+     */
+    namespace Fast
+    {
+        /**
+         * @brief Hardware reciprocal square root estimate refined by Newton-Raphson. Max error 4 ulp on float normal numbers. 
+         * double and targets without estimate instruction use 1 / std::sqrt.
+         */
+        template <typename T>
+        [[nodiscard]] inline
+        T rsqrt (T x) noexcept
+        {
+#ifdef FOXMATH_USE_SIMD
+            if constexpr (std::is_same_v<T, float>)
+            {
+    #ifdef FOXMATH_SIMD_SSE
+                /*Estimate have 12 bits of precision, one Newton step is enough*/
+                const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+                return estimate * (1.5f - 0.5f * x * estimate * estimate);
+    #else
+                /*Estimate have 8 bits of precision : two Newton step with vrsqrts (3 - a * b) / 2*/
+                const float32x2_t value = vdup_n_f32(x);
+                float32x2_t estimate    = vrsqrte_f32(value);
+                estimate = vmul_f32(estimate, vrsqrts_f32(vmul_f32(value, estimate), estimate));
+                estimate = vmul_f32(estimate, vrsqrts_f32(vmul_f32(value, estimate), estimate));
+                return vget_lane_f32(estimate, 0);
+    #endif
+            }
+#endif
+            return static_cast<T>(1) / std::sqrt(x);
+        }
+
+        /**
+         * @brief sqrt(x) = x * rsqrt(x) on float normal numbers. Max error 4 ulp on float
+         */
+        template <typename T>
+        [[nodiscard]] inline
+        T sqrt (T x) noexcept
+        {
+#ifdef FOXMATH_USE_SIMD
+            if constexpr (std::is_same_v<T, float>)
+            {
+                if (x >= std::numeric_limits<float>::min() && x <= std::numeric_limits<float>::max())
+                    return x * rsqrt(x);
+            }
+#endif
+            return std::sqrt(x);
+        }
+
+        /**
+         * @brief Reduce x in [-pi/4, pi/4] with the Cody and Waite split of pi/2 exact on float and return its quadrant
+         * @note Reduction is accurate for |x| < 8192
+         */
+        template <typename T>
+        [[nodiscard]] inline
+        T reduceQuadrant (T x, int& quadrant) noexcept
+        {
+            const T scaled = x * static_cast<T>(0.636619772367581343075535053490057448L);
+            quadrant = static_cast<int>(scaled + (scaled < static_cast<T>(0) ? static_cast<T>(-0.5) : static_cast<T>(0.5)));
+
+            const T k = static_cast<T>(quadrant);
+            return ((x - k * static_cast<T>(1.5703125)) - k * static_cast<T>(4.837512969970703125e-4)) - k * static_cast<T>(7.54978995489188216e-8);
+        }
+
+        /**
+         * @brief Minimax polynomial of sin on [-pi/4, pi/4] (Cephes sinf coefficients)
+         */
+        template <typename T>
+        [[nodiscard]] inline
+        T sinReduced (T x) noexcept
+        {
+            const T x2 = x * x;
+            return ((static_cast<T>(-1.9515295891e-4) * x2 + static_cast<T>(8.3321608736e-3)) * x2 + static_cast<T>(-1.6666654611e-1)) * x2 * x + x;
+        }
+
+        /**
+         * @brief Minimax polynomial of cos on [-pi/4, pi/4] (Cephes cosf coefficients)
+         */
+        template <typename T>
+        [[nodiscard]] inline
+        T cosReduced (T x) noexcept
+        {
+            const T x2 = x * x;
+            return ((static_cast<T>(2.443315711809948e-5) * x2 + static_cast<T>(-1.388731625493765e-3)) * x2 + static_cast<T>(4.166664568298827e-2)) * x2 * x2
+                    - static_cast<T>(0.5) * x2 + static_cast<T>(1);
+        }
+
+        /**
+         * @brief Minimax sin. On float, max error 0.81 ulp for |x| <= pi/4 and 1.4 ulp for |x| <= pi. The reduction error is absolute so the error in ulp
+         * grows near the zeros of greater angles : 14 ulp for |x| < 64 and 478 ulp for |x| < 8192 (absolute error <= 8e-8). Absolute error <= 3e-9 on double for |x| < 8192
+         */
+        template <typename T>
+        [[nodiscard]] inline
+        T sin (T x) noexcept
+        {
+            int quadrant = 0;
+            const T reduced = reduceQuadrant(x, quadrant);
+            const T rst     = (quadrant & 1) ? cosReduced(reduced) : sinReduced(reduced);
+            return (quadrant & 2) ? -rst : rst;
+        }
+
+        /**
+         * @brief Minimax cos. On float, max error 0.99 ulp for |x| <= pi/4 and 1.5 ulp for |x| <= pi. The reduction error is absolute so the error in ulp
+         * grows near the zeros of greater angles : 14 ulp for |x| < 64 and 975 ulp for |x| < 8192 (absolute error <= 8e-8). Absolute error <= 3e-9 on double for |x| < 8192
+         */
+        template <typename T>
+        [[nodiscard]] inline
+        T cos (T x) noexcept
+        {
+            int quadrant = 0;
+            const T reduced = reduceQuadrant(x, quadrant);
+            const T rst     = (quadrant & 1) ? sinReduced(reduced) : cosReduced(reduced);
+            return ((quadrant + 1) & 2) ? -rst : rst;
+        }
+
+        /**
+         * @brief Minimax sin and cos sharing the same quadrant reduction. Both polynomials are evaluated without branch and swapped by quadrant.
+         * Same error as sin and cos
+         */
+        template <typename T>
+        [[nodiscard]] inline
+        SinCos<T> sincos (T x) noexcept
+        {
+            int quadrant = 0;
+            const T reduced = reduceQuadrant(x, quadrant);
+            const T sinR    = sinReduced(reduced);
+            const T cosR    = cosReduced(reduced);
+            const T sinRst  = (quadrant & 1) ? cosR : sinR;
+            const T cosRst  = (quadrant & 1) ? sinR : cosR;
+            return {(quadrant & 2) ? -sinRst : sinRst, ((quadrant + 1) & 2) ? -cosRst : cosRst};
+        }
+
+        /**
+         * @brief sin of Packet::size angles in [-pi/2, 3pi/2] without reduction : sin(x) = sin(pi - x) fold x on [-pi/2, pi/2] for the Taylor polynomial of degree 11.
+         * Absolute error < 2.2e-7 on float (truncation and rounding near +/- pi/2). Shared by the packet kernels (QuaternionBatch, EulerAngle...)
+         */
+        template <typename T>
+        [[nodiscard]] inline
+        typename SIMD::Packet<T>::Type sinPacketHalfTurn (typename SIMD::Packet<T>::Type x) noexcept
+        {
+            using Packet = SIMD::Packet<T>;
+            using PacketType = typename Packet::Type;
+
+            const PacketType y  = Packet::min(x, Packet::sub(Packet::set1(static_cast<T>(3.14159265358979323846)), x));
+            const PacketType y2 = Packet::mul(y, y);
+
+            PacketType poly = Packet::set1(static_cast<T>(-1.0 / 39916800.0));
+            poly = Packet::mulAdd(Packet::set1(static_cast<T>(1.0 / 362880.0)), poly, y2);
+            poly = Packet::mulAdd(Packet::set1(static_cast<T>(-1.0 / 5040.0)), poly, y2);
+            poly = Packet::mulAdd(Packet::set1(static_cast<T>(1.0 / 120.0)), poly, y2);
+            poly = Packet::mulAdd(Packet::set1(static_cast<T>(-1.0 / 6.0)), poly, y2);
+            poly = Packet::mulAdd(Packet::set1(static_cast<T>(1)), poly, y2);
+
+            return Packet::mul(y, poly);
+        }
+
+        /**
+         * @brief sin and cos of Packet::size angles. Angles are reduced on [-pi, pi] with the Cody and Waite split of 2pi then evaluated by sinPacketHalfTurn.
+         * Absolute error < 2.3e-7 on float for |x| < 1e3. Without SIMD packet (double), use std::sin and std::cos
+         */
+        template <typename T>
+        inline
+        void sincosPacket (typename SIMD::Packet<T>::Type x, typename SIMD::Packet<T>::Type& sin, typename SIMD::Packet<T>::Type& cos) noexcept
+        {
+            using Packet = SIMD::Packet<T>;
+            using PacketType = typename Packet::Type;
+
+            if constexpr (Packet::size == 1)
+            {
+                sin = std::sin(x);
+                cos = std::cos(x);
+            }
+            else
+            {
+                /*Adding and removing 1.5 * 2^(mantissa bits) round to the nearest integer the number of turns*/
+                const PacketType magic  = Packet::set1(static_cast<T>(1.5) * static_cast<T>(1ull << (std::numeric_limits<T>::digits - 1)));
+                const PacketType turn   = Packet::sub(Packet::add(Packet::mul(x, Packet::set1(static_cast<T>(0.159154943091895335768883763372514362))), magic), magic);
+
+                /*The first part of 2pi is exact with 8 bits*/
+                PacketType reduced      = Packet::sub(x, Packet::mul(turn, Packet::set1(static_cast<T>(6.28125))));
+                reduced                 = Packet::sub(reduced, Packet::mul(turn, Packet::set1(static_cast<T>(1.93530717958647692528676655900576839e-3))));
+
+                /*sin(x) = sin(-pi - x) bring [-pi, -pi/2] in [-pi/2, 3pi/2]. cos(x) = sin(pi/2 - |x|)*/
+                sin = sinPacketHalfTurn<T>(Packet::max(reduced, Packet::sub(Packet::set1(static_cast<T>(-3.14159265358979323846)), reduced)));
+                cos = sinPacketHalfTurn<T>(Packet::sub(Packet::set1(static_cast<T>(1.57079632679489661923)), Packet::abs(reduced)));
+            }
+        }
+
+    } /*namespace FoxMath::Math::Fast*/
+
+    /**
+     * @brief Quantized angle lookup used by EPrecision::Table. Made for workload that rotate by discrete angles at very high rates
+     */
+    namespace Table
+    {
+        enum class EInterpolation
+        {
+            Nearest, //Value of the closest step. Max absolute error pi / TResolution
+            Linear   //Linear interpolation between the two surrounding steps. Max absolute error (2pi / TResolution)^2 / 8 (3e-7 with 4096 steps)
+        };
+
+        /**
+         * @brief sin and cos of one turn sampled on TResolution steps. Step i store the angle i * 2pi / TResolution computed in double.
+         * Angle out of [0, 2pi] wrap with a mask.
+         * 
+         * @tparam TType : float or double
+         * @tparam TResolution : Number of step by turn. Must be a power of 2
+         * @tparam TInterpolation : Interpolation between two steps
+         */
+        template <typename TType, std::size_t TResolution = FOXMATH_SINCOS_TABLE_RESOLUTION,
+#ifdef FOXMATH_SINCOS_TABLE_NEAREST
+                EInterpolation TInterpolation = EInterpolation::Nearest>
+#else
+                EInterpolation TInterpolation = EInterpolation::Linear>
+#endif
+        class SinCosTable
+        {
+            static_assert(std::is_floating_point_v<TType>, "SinCosTable need floating point type");
+            static_assert(TResolution >= 4 && (TResolution & (TResolution - 1)) == 0, "SinCosTable resolution must be a power of 2");
+
+            protected:
+
+            static constexpr std::size_t m_mask = TResolution - 1;
+
+            /*Last step duplicate the first one to interpolate the last interval without wrap*/
+            std::array<SinCos<TType>, TResolution + 1> m_steps;
+
+            public:
+
+            static constexpr TType stepAngle = static_cast<TType>(6.28318530717958647692528676655900576L / TResolution);
+
+            /*Built with the constexpr series to be constant initialized*/
+            constexpr SinCosTable () noexcept
+                : m_steps {}
+            {
+                for (std::size_t i = 0; i < TResolution; i++)
+                {
+                    const SinCos<double> step = Constexpr::sincos(6.28318530717958647692528676655900576 * static_cast<double>(i) / static_cast<double>(TResolution));
+                    m_steps[i] = {static_cast<TType>(step.sin), static_cast<TType>(step.cos)};
+                }
+
+                m_steps[TResolution] = m_steps[0];
+            }
+
+            /**
+             * @brief Exact sin and cos (rounded from double) of the angle step * stepAngle. Negative step wrap
+             */
+            [[nodiscard]] inline constexpr
+            const SinCos<TType>& getStep (long long step) const noexcept
+            {
+                return m_steps[static_cast<std::size_t>(step) & m_mask];
+            }
+
+            /**
+             * @brief sin and cos of the angle in radian
+             */
+            [[nodiscard]] inline constexpr
+            SinCos<TType> operator() (TType angle) const noexcept
+            {
+                /*float is scaled in double to keep the interpolation ratio accurate on large number of turn*/
+                using TCompute = Constexpr::Compute<TType>;
+                const TCompute scaled = static_cast<TCompute>(angle) * static_cast<TCompute>(TResolution / 6.28318530717958647692528676655900576L);
+
+                if constexpr (TInterpolation == EInterpolation::Nearest)
+                {
+                    return getStep(Constexpr::round(scaled));
+                }
+                else
+                {
+                    long long step = static_cast<long long>(scaled);
+                    step -= scaled < static_cast<TCompute>(step);
+
+                    const TType ratio = static_cast<TType>(scaled - static_cast<TCompute>(step));
+                    const std::size_t index = static_cast<std::size_t>(step) & m_mask;
+                    const SinCos<TType>& from   = m_steps[index];
+                    const SinCos<TType>& to     = m_steps[index + 1];
+
+                    return {from.sin + (to.sin - from.sin) * ratio, from.cos + (to.cos - from.cos) * ratio};
+                }
+            }
+        };
+
+        /**
+         * @brief Shared table of EPrecision::Table. Constant initialized, so lookup do not need any initialization guard
+         */
+        template <typename TType>
+        inline constexpr SinCosTable<TType> defaultTable {};
+
+    } /*namespace FoxMath::Math::Table*/
+
+    /**
+     * @brief Absolute value
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    T abs (T x) noexcept
+    {
+        return Constexpr::abs(x);
+    }
+
+    /**
+     * @brief Square root. Compile time error <= 1 ulp. Fast error <= 4 ulp on float
+     */
+    template <EPrecision TPrecision = EPrecision::Precise, typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    Real<T> sqrt (T x) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return static_cast<Real<T>>(Constexpr::sqrt(static_cast<Constexpr::Compute<T>>(x)));
+#endif
+        if constexpr (TPrecision == EPrecision::Fast)
+            return Fast::sqrt(static_cast<Real<T>>(x));
+        else
+            return std::sqrt(static_cast<Real<T>>(x));
+    }
+
+    /**
+     * @brief Reciprocal square root 1 / sqrt(x). Fast error <= 4 ulp on float
+     */
+    template <EPrecision TPrecision = EPrecision::Precise, typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    Real<T> rsqrt (T x) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return static_cast<Real<T>>(static_cast<Constexpr::Compute<T>>(1) / Constexpr::sqrt(static_cast<Constexpr::Compute<T>>(x)));
+#endif
+        if constexpr (TPrecision == EPrecision::Fast)
+            return Fast::rsqrt(static_cast<Real<T>>(x));
+        else
+            return static_cast<Real<T>>(1) / std::sqrt(static_cast<Real<T>>(x));
+    }
+
+    /**
+     * @brief Sine of x in radian. Compile time error of few ulp for |x| < 1e5. Fast error <= 1.5 ulp on float for |x| <= pi and absolute error <= 8e-8 for |x| < 8192. Table absolute error <= 4e-7 on float with the default table
+     */
+    template <EPrecision TPrecision = EPrecision::Precise, typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    Real<T> sin (T x) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return static_cast<Real<T>>(Constexpr::sin(static_cast<Constexpr::Compute<T>>(x)));
+#endif
+        if constexpr (TPrecision == EPrecision::Fast)
+            return Fast::sin(static_cast<Real<T>>(x));
+        else if constexpr (TPrecision == EPrecision::Table)
+            return Table::defaultTable<Real<T>>(static_cast<Real<T>>(x)).sin;
+        else
+            return std::sin(static_cast<Real<T>>(x));
+    }
+
+    /**
+     * @brief Cosine of x in radian. Compile time error of few ulp for |x| < 1e5. Fast error <= 1.5 ulp on float for |x| <= pi and absolute error <= 8e-8 for |x| < 8192. Table absolute error <= 4e-7 on float with the default table
+     */
+    template <EPrecision TPrecision = EPrecision::Precise, typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    Real<T> cos (T x) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return static_cast<Real<T>>(Constexpr::cos(static_cast<Constexpr::Compute<T>>(x)));
+#endif
+        if constexpr (TPrecision == EPrecision::Fast)
+            return Fast::cos(static_cast<Real<T>>(x));
+        else if constexpr (TPrecision == EPrecision::Table)
+            return Table::defaultTable<Real<T>>(static_cast<Real<T>>(x)).cos;
+        else
+            return std::cos(static_cast<Real<T>>(x));
+    }
+
+    /**
+     * @brief Sine and cosine of x in radian computed together. Compile time and Fast share one quadrant reduction, 
+     * Precise let the compiler fuse std::sin and std::cos in one sincos call. Same errors as sin and cos
+     */
+    template <EPrecision TPrecision = EPrecision::Precise, typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    SinCos<Real<T>> sincos (T x) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            const SinCos<Constexpr::Compute<T>> rst = Constexpr::sincos(static_cast<Constexpr::Compute<T>>(x));
+            return {static_cast<Real<T>>(rst.sin), static_cast<Real<T>>(rst.cos)};
+        }
+#endif
+        if constexpr (TPrecision == EPrecision::Fast)
+            return Fast::sincos(static_cast<Real<T>>(x));
+        else if constexpr (TPrecision == EPrecision::Table)
+            return Table::defaultTable<Real<T>>(static_cast<Real<T>>(x));
+        else
+            return {std::sin(static_cast<Real<T>>(x)), std::cos(static_cast<Real<T>>(x))};
+    }
+
+    /**
+     * @brief Tangent of x in radian. Compile time error of few ulp for |x| < 1e5
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    Real<T> tan (T x) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return static_cast<Real<T>>(Constexpr::tan(static_cast<Constexpr::Compute<T>>(x)));
+#endif
+        return std::tan(static_cast<Real<T>>(x));
+    }
+
+    /**
+     * @brief Arc cosine in [0, pi]. Return NaN if |x| > 1
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    Real<T> acos (T x) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return static_cast<Real<T>>(Constexpr::acos(static_cast<Constexpr::Compute<T>>(x)));
+#endif
+        return std::acos(static_cast<Real<T>>(x));
+    }
+
+    /**
+     * @brief Arc tangent in [-pi/2, pi/2]
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    Real<T> atan (T x) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return static_cast<Real<T>>(Constexpr::atan(static_cast<Constexpr::Compute<T>>(x)));
+#endif
+        return std::atan(static_cast<Real<T>>(x));
+    }
+
+    /**
+     * @brief Angle of the point (x, y) in [-pi, pi]
+     */
+    template <typename TY, typename TX, IsAllArithmetic<TY, TX> = true>
+    [[nodiscard]] inline constexpr
+    Real<std::common_type_t<TY, TX>> atan2 (TY y, TX x) noexcept
+    {
+        using TReal = Real<std::common_type_t<TY, TX>>;
+
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return static_cast<TReal>(Constexpr::atan2(static_cast<Constexpr::Compute<TReal>>(y), static_cast<Constexpr::Compute<TReal>>(x)));
+#endif
+        return std::atan2(static_cast<TReal>(y), static_cast<TReal>(x));
+    }
+
+    /**
+     * @brief Base e exponential
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    Real<T> exp (T x) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return static_cast<Real<T>>(Constexpr::exp(static_cast<Constexpr::Compute<T>>(x)));
+#endif
+        return std::exp(static_cast<Real<T>>(x));
+    }
+
+    /**
+     * @brief Natural logarithm
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    Real<T> log (T x) noexcept
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return static_cast<Real<T>>(Constexpr::log(static_cast<Constexpr::Compute<T>>(x)));
+#endif
+        return std::log(static_cast<Real<T>>(x));
+    }
+
+    /**
+     * @brief base power exponent. Integral exponent use exponentiation by squaring at compile time (exact for small integer),
+     * other use exp(exponent * log(base)) with an error that grows with |exponent * log(base)|
+     */
+    template <typename TBase, typename TExponent, IsAllArithmetic<TBase, TExponent> = true>
+    [[nodiscard]] inline constexpr
+    Real<std::common_type_t<TBase, TExponent>> pow (TBase base, TExponent exponent) noexcept
+    {
+        using TReal = Real<std::common_type_t<TBase, TExponent>>;
+
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            if constexpr (std::is_integral_v<TExponent>)
+                return static_cast<TReal>(Constexpr::powInteger(static_cast<Constexpr::Compute<TReal>>(base), static_cast<long long>(exponent)));
+            else
+                return static_cast<TReal>(Constexpr::pow(static_cast<Constexpr::Compute<TReal>>(base), static_cast<Constexpr::Compute<TReal>>(exponent)));
+        }
+#endif
+        return std::pow(static_cast<TReal>(base), static_cast<TReal>(exponent));
+    }
+
+} /*namespace FoxMath::Math*/
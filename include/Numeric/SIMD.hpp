@@ -0,0 +1,634 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 09 h 12
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <array> //std::array
+#include <stddef.h> //sizt_t
+#include <type_traits> //std::is_same_v, std::is_constant_evaluated
+#include <algorithm> //std::max, std::min
+#include <cmath> //std::sqrt, std::abs
+
+/*Backend selection. Define DONT_USE_SIMD to force the scalar implementation*/
+#ifndef DONT_USE_SIMD
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        #define FOXMATH_SIMD_SSE
+        #include <immintrin.h> //__m128
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define FOXMATH_SIMD_NEON
+        #include <arm_neon.h> //float32x4_t
+    #endif
+#endif
+
+/*SIMD intrinsics are not constexpr : kernels must know if they are evaluated at compile time to fallback on scalar code*/
+#if __cplusplus >= 201709L
+    #define FOXMATH_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__clang__)
+    #if __clang_major__ >= 9
+        #define FOXMATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+#elif defined(__GNUC__)
+    #if __GNUC__ >= 9
+        #define FOXMATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+#elif defined(_MSC_VER)
+    #if _MSC_VER >= 1925
+        #define FOXMATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+#endif
+
+#if (defined(FOXMATH_SIMD_SSE) || defined(FOXMATH_SIMD_NEON)) && defined(FOXMATH_IS_CONSTANT_EVALUATED)
+    #define FOXMATH_USE_SIMD
+#endif
+
+namespace FoxMath::SIMD
+{
+    /**
+     * @brief True if the generic vector of TLength TType can be processed in one 4 floats register
+     *
+     * @tparam TLength
+     * @tparam TType
+     */
+    template <size_t TLength, typename TType>
+#ifdef FOXMATH_USE_SIMD
+    inline constexpr bool isFloat4Compatible = std::is_same_v<TType, float> && (TLength == 3 || TLength == 4);
+#else
+    inline constexpr bool isFloat4Compatible = false;
+#endif
+
+    /**
+     * @brief Alignment of generic vector storage. 4 floats vectors are aligned on 16 bytes to match the register layout.
+     * @note 3 floats vectors keep their natural alignment and size (12 bytes) to stay compatible with packed vertex buffer and Quaternion union layout.
+     *
+     * @tparam TLength
+     * @tparam TType
+     */
+    template <size_t TLength, typename TType>
+    inline constexpr size_t storageAlignment = (isFloat4Compatible<TLength, TType> && TLength == 4) ? 16 : alignof(std::array<TType, TLength>);
+
+#ifdef FOXMATH_USE_SIMD
+
+#ifdef FOXMATH_SIMD_SSE
+    using Float4 = __m128;
+#else
+    using Float4 = float32x4_t;
+#endif
+
+    [[nodiscard]] inline
+    Float4 set1 (float scalar) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        return _mm_set1_ps(scalar);
+#else
+        return vdupq_n_f32(scalar);
+#endif
+    }
+
+    [[nodiscard]] inline
+    Float4 zero () noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        return _mm_setzero_ps();
+#else
+        return vdupq_n_f32(0.f);
+#endif
+    }
+
+    [[nodiscard]] inline
+    float firstLane (Float4 reg) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        return _mm_cvtss_f32(reg);
+#else
+        return vgetq_lane_f32(reg, 0);
+#endif
+    }
+
+    /**
+     * @brief Load TLength floats in register. Unused lanes are set to zero.
+     * @note Never read after src[TLength - 1]
+     *
+     * @tparam TLength : 3 or 4
+     * @param src
+     * @return Float4
+     */
+    template <size_t TLength>
+    [[nodiscard]] inline
+    Float4 load (const float* src) noexcept
+    {
+        static_assert(TLength == 3 || TLength == 4, "Float4 register can only load 3 or 4 floats");
+
+#ifdef FOXMATH_SIMD_SSE
+        if constexpr (TLength == 4)
+        {
+            return _mm_loadu_ps(src);
+        }
+        else
+        {
+            const __m128 xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(src));
+            return _mm_movelh_ps(xy, _mm_load_ss(src + 2));
+        }
+#else
+        if constexpr (TLength == 4)
+        {
+            return vld1q_f32(src);
+        }
+        else
+        {
+            return vcombine_f32(vld1_f32(src), vset_lane_f32(src[2], vdup_n_f32(0.f), 0));
+        }
+#endif
+    }
+
+    /**
+     * @brief Store the TLength first lanes of register
+     * @note Never write after dst[TLength - 1]
+     *
+     * @tparam TLength : 3 or 4
+     * @param dst
+     * @param reg
+     */
+    template <size_t TLength>
+    inline
+    void store (float* dst, Float4 reg) noexcept
+    {
+        static_assert(TLength == 3 || TLength == 4, "Float4 register can only store 3 or 4 floats");
+
+#ifdef FOXMATH_SIMD_SSE
+        if constexpr (TLength == 4)
+        {
+            _mm_storeu_ps(dst, reg);
+        }
+        else
+        {
+            _mm_storel_pi(reinterpret_cast<__m64*>(dst), reg);
+            _mm_store_ss(dst + 2, _mm_movehl_ps(reg, reg));
+        }
+#else
+        if constexpr (TLength == 4)
+        {
+            vst1q_f32(dst, reg);
+        }
+        else
+        {
+            vst1_f32(dst, vget_low_f32(reg));
+            vst1q_lane_f32(dst + 2, reg, 2);
+        }
+#endif
+    }
+
+    [[nodiscard]] inline
+    Float4 add (Float4 lhs, Float4 rhs) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        return _mm_add_ps(lhs, rhs);
+#else
+        return vaddq_f32(lhs, rhs);
+#endif
+    }
+
+    [[nodiscard]] inline
+    Float4 sub (Float4 lhs, Float4 rhs) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        return _mm_sub_ps(lhs, rhs);
+#else
+        return vsubq_f32(lhs, rhs);
+#endif
+    }
+
+    [[nodiscard]] inline
+    Float4 mul (Float4 lhs, Float4 rhs) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        return _mm_mul_ps(lhs, rhs);
+#else
+        return vmulq_f32(lhs, rhs);
+#endif
+    }
+
+    [[nodiscard]] inline
+    Float4 div (Float4 lhs, Float4 rhs) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        return _mm_div_ps(lhs, rhs);
+#elif defined(__aarch64__)
+        return vdivq_f32(lhs, rhs);
+#else
+        /*ARMv7 doesn't have division : reciprocal estimate refined with 2 Newton-Raphson steps*/
+        float32x4_t inv = vrecpeq_f32(rhs);
+        inv = vmulq_f32(vrecpsq_f32(rhs, inv), inv);
+        inv = vmulq_f32(vrecpsq_f32(rhs, inv), inv);
+        return vmulq_f32(lhs, inv);
+#endif
+    }
+
+    /**
+     * @brief lhs + a * b
+     *
+     * @param lhs
+     * @param a
+     * @param b
+     * @return Float4
+     */
+    [[nodiscard]] inline
+    Float4 mulAdd (Float4 lhs, Float4 a, Float4 b) noexcept
+    {
+#if defined(FOXMATH_SIMD_SSE) && defined(__FMA__)
+        return _mm_fmadd_ps(a, b, lhs);
+#elif defined(FOXMATH_SIMD_SSE)
+        return _mm_add_ps(lhs, _mm_mul_ps(a, b));
+#else
+        return vmlaq_f32(lhs, a, b);
+#endif
+    }
+
+    [[nodiscard]] inline
+    float horizontalAdd (Float4 reg) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        __m128 shuffled = _mm_shuffle_ps(reg, reg, _MM_SHUFFLE(2, 3, 0, 1));
+        __m128 sums     = _mm_add_ps(reg, shuffled);
+        shuffled        = _mm_movehl_ps(shuffled, sums);
+        return _mm_cvtss_f32(_mm_add_ss(sums, shuffled));
+#elif defined(__aarch64__)
+        return vaddvq_f32(reg);
+#else
+        const float32x2_t sums = vadd_f32(vget_low_f32(reg), vget_high_f32(reg));
+        return vget_lane_f32(vpadd_f32(sums, sums), 0);
+#endif
+    }
+
+    /**
+     * @brief Horizontal add of four registers : lane i of result is the sum of lanes of register i
+     *
+     * @param reg0
+     * @param reg1
+     * @param reg2
+     * @param reg3
+     * @return Float4
+     */
+    [[nodiscard]] inline
+    Float4 horizontalAdd (Float4 reg0, Float4 reg1, Float4 reg2, Float4 reg3) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        const __m128 sums01 = _mm_add_ps(_mm_unpacklo_ps(reg0, reg1), _mm_unpackhi_ps(reg0, reg1));
+        const __m128 sums23 = _mm_add_ps(_mm_unpacklo_ps(reg2, reg3), _mm_unpackhi_ps(reg2, reg3));
+        return _mm_add_ps(_mm_movelh_ps(sums01, sums23), _mm_movehl_ps(sums23, sums01));
+#elif defined(__aarch64__)
+        return vpaddq_f32(vpaddq_f32(reg0, reg1), vpaddq_f32(reg2, reg3));
+#else
+        const float32x2_t sums01 = vpadd_f32(vpadd_f32(vget_low_f32(reg0), vget_high_f32(reg0)), vpadd_f32(vget_low_f32(reg1), vget_high_f32(reg1)));
+        const float32x2_t sums23 = vpadd_f32(vpadd_f32(vget_low_f32(reg2), vget_high_f32(reg2)), vpadd_f32(vget_low_f32(reg3), vget_high_f32(reg3)));
+        return vcombine_f32(sums01, sums23);
+#endif
+    }
+
+    /**
+     * @brief Transpose 4 registers seen as the rows of a 4*4 matrix : lane j of reg i become lane i of reg j.
+     * Used to switch 4 vectors between array of structures and structure of arrays.
+     *
+     * @param reg0
+     * @param reg1
+     * @param reg2
+     * @param reg3
+     */
+    inline
+    void transpose (Float4& reg0, Float4& reg1, Float4& reg2, Float4& reg3) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        _MM_TRANSPOSE4_PS(reg0, reg1, reg2, reg3);
+#else
+        const float32x4x2_t trn01 = vtrnq_f32(reg0, reg1);
+        const float32x4x2_t trn23 = vtrnq_f32(reg2, reg3);
+        reg0 = vcombine_f32(vget_low_f32(trn01.val[0]), vget_low_f32(trn23.val[0]));
+        reg1 = vcombine_f32(vget_low_f32(trn01.val[1]), vget_low_f32(trn23.val[1]));
+        reg2 = vcombine_f32(vget_high_f32(trn01.val[0]), vget_high_f32(trn23.val[0]));
+        reg3 = vcombine_f32(vget_high_f32(trn01.val[1]), vget_high_f32(trn23.val[1]));
+#endif
+    }
+
+    /**
+     * @brief Broadcast lane TLane in all lanes
+     *
+     * @tparam TLane : 0 to 3
+     * @param reg
+     * @return Float4
+     */
+    template <int TLane>
+    [[nodiscard]] inline
+    Float4 splat (Float4 reg) noexcept
+    {
+        static_assert(TLane >= 0 && TLane < 4, "Float4 register have 4 lanes");
+
+#ifdef FOXMATH_SIMD_SSE
+        return _mm_shuffle_ps(reg, reg, _MM_SHUFFLE(TLane, TLane, TLane, TLane));
+#elif defined(__aarch64__)
+        return vdupq_laneq_f32(reg, TLane);
+#else
+        return vdupq_n_f32(vgetq_lane_f32(reg, TLane));
+#endif
+    }
+
+    /**
+     * @brief Rotate the TLength first lanes to the left : lane i receive lane (i + 1) % TLength. Lane 3 of 3 floats register is kept.
+     *
+     * @tparam TLength : 3 or 4
+     * @param reg
+     * @return Float4
+     */
+    template <size_t TLength>
+    [[nodiscard]] inline
+    Float4 rotateLeft (Float4 reg) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        if constexpr (TLength == 4)
+            return _mm_shuffle_ps(reg, reg, _MM_SHUFFLE(0, 3, 2, 1));
+        else
+            return _mm_shuffle_ps(reg, reg, _MM_SHUFFLE(3, 0, 2, 1));
+#else
+        const float32x4_t rotated = vextq_f32(reg, reg, 1);
+
+        if constexpr (TLength == 4)
+            return rotated;
+        else
+            return vsetq_lane_f32(vgetq_lane_f32(reg, 3), vsetq_lane_f32(vgetq_lane_f32(reg, 0), rotated, 2), 3);
+#endif
+    }
+
+    /**
+     * @brief Rotate the TLength first lanes to the right : lane i receive lane (i - 1) % TLength. Lane 3 of 3 floats register is kept.
+     *
+     * @tparam TLength : 3 or 4
+     * @param reg
+     * @return Float4
+     */
+    template <size_t TLength>
+    [[nodiscard]] inline
+    Float4 rotateRight (Float4 reg) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        if constexpr (TLength == 4)
+            return _mm_shuffle_ps(reg, reg, _MM_SHUFFLE(2, 1, 0, 3));
+        else
+            return _mm_shuffle_ps(reg, reg, _MM_SHUFFLE(3, 1, 0, 2));
+#else
+        const float32x4_t rotated = vextq_f32(reg, reg, 3);
+
+        if constexpr (TLength == 4)
+            return rotated;
+        else
+            return vsetq_lane_f32(vgetq_lane_f32(reg, 3), vsetq_lane_f32(vgetq_lane_f32(reg, 2), rotated, 0), 3);
+#endif
+    }
+
+    /**
+     * @brief Dot product of the TLength first lanes
+     *
+     * @param lhs
+     * @param rhs
+     * @return float
+     */
+    [[nodiscard]] inline
+    float dot (Float4 lhs, Float4 rhs) noexcept
+    {
+        return horizontalAdd(mul(lhs, rhs));
+    }
+
+    /**
+     * @brief Dot product broadcasted in the four lanes
+     *
+     * @param lhs
+     * @param rhs
+     * @return Float4
+     */
+    [[nodiscard]] inline
+    Float4 dotSplat (Float4 lhs, Float4 rhs) noexcept
+    {
+        const Float4 product = mul(lhs, rhs);
+#ifdef FOXMATH_SIMD_SSE
+        const __m128 sums = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_add_ps(sums, _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(1, 0, 3, 2)));
+#elif defined(__aarch64__)
+        return vdupq_n_f32(vaddvq_f32(product));
+#else
+        return vdupq_n_f32(horizontalAdd(product));
+#endif
+    }
+
+    /**
+     * @brief Reciprocal square root estimate refined by Newton-Raphson (max error 4 ulp on normal numbers)
+     *
+     * @param reg
+     * @return Float4
+     */
+    [[nodiscard]] inline
+    Float4 rsqrt (Float4 reg) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        /*Estimate have 12 bits of precision, one Newton step is enough*/
+        const __m128 estimate = _mm_rsqrt_ps(reg);
+        const __m128 halfReg  = _mm_mul_ps(reg, _mm_set1_ps(0.5f));
+        return _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfReg, _mm_mul_ps(estimate, estimate))));
+#else
+        /*Estimate have 8 bits of precision : two Newton step with vrsqrts (3 - a * b) / 2*/
+        float32x4_t estimate = vrsqrteq_f32(reg);
+        estimate = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(reg, estimate), estimate));
+        return vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(reg, estimate), estimate));
+#endif
+    }
+
+    /**
+     * @brief Cyclic cross product used by GenericVector : rst[i] = lhs[i + 1] * rhs[i - 1] - rhs[i + 1] * lhs[i - 1]
+     *
+     * @tparam TLength : 3 or 4
+     * @param lhs
+     * @param rhs
+     * @return Float4
+     */
+    template <size_t TLength>
+    [[nodiscard]] inline
+    Float4 cross (Float4 lhs, Float4 rhs) noexcept
+    {
+        return sub(mul(rotateLeft<TLength>(lhs), rotateRight<TLength>(rhs)), mul(rotateLeft<TLength>(rhs), rotateRight<TLength>(lhs)));
+    }
+
+#endif //FOXMATH_USE_SIMD
+
+    /**
+     * @brief Register abstraction of one scalar lane. Used by Packet when there is no SIMD register for TType
+     * and by kernels written for Packet that must also run on a single element.
+     *
+     * @tparam TType
+     */
+    template <typename TType>
+    struct ScalarPacket
+    {
+        using Type = TType;
+
+        static constexpr size_t size = 1;
+
+        [[nodiscard]] static inline Type load             (const TType* src) noexcept             { return *src; }
+        [[nodiscard]] static inline Type loadUnaligned    (const TType* src) noexcept             { return *src; }
+        static inline void               store            (TType* dst, Type reg) noexcept         { *dst = reg; }
+        static inline void               storeUnaligned   (TType* dst, Type reg) noexcept         { *dst = reg; }
+        [[nodiscard]] static inline Type set1             (TType scalar) noexcept                 { return scalar; }
+        [[nodiscard]] static inline Type add              (Type lhs, Type rhs) noexcept           { return lhs + rhs; }
+        [[nodiscard]] static inline Type sub              (Type lhs, Type rhs) noexcept           { return lhs - rhs; }
+        [[nodiscard]] static inline Type mul              (Type lhs, Type rhs) noexcept           { return lhs * rhs; }
+        [[nodiscard]] static inline Type div              (Type lhs, Type rhs) noexcept           { return lhs / rhs; }
+        [[nodiscard]] static inline Type mulAdd           (Type acc, Type a, Type b) noexcept     { return acc + a * b; }
+        [[nodiscard]] static inline Type max              (Type lhs, Type rhs) noexcept           { return std::max(lhs, rhs); }
+        [[nodiscard]] static inline Type min              (Type lhs, Type rhs) noexcept           { return std::min(lhs, rhs); }
+        [[nodiscard]] static inline Type abs              (Type reg) noexcept                     { return static_cast<TType>(std::abs(reg)); }
+        [[nodiscard]] static inline Type sqrt             (Type reg) noexcept                     { return static_cast<TType>(std::sqrt(reg)); }
+        [[nodiscard]] static inline Type rsqrt            (Type reg) noexcept                     { return static_cast<TType>(1) / static_cast<TType>(std::sqrt(reg)); }
+
+        /*Lane wise lhs < rhs ? ifTrue : ifFalse*/
+        [[nodiscard]] static inline Type selectIfLess     (Type lhs, Type rhs, Type ifTrue, Type ifFalse) noexcept { return lhs < rhs ? ifTrue : ifFalse; }
+
+        /*Bit i is set if lane i of lhs <= lane i of rhs*/
+        [[nodiscard]] static inline unsigned int lessEqualMask (Type lhs, Type rhs) noexcept { return static_cast<unsigned int>(lhs <= rhs); }
+    };
+
+    /**
+     * @brief Register abstraction used by stream kernels (structure of arrays). Generic version process one scalar lane.
+     * @note load and store expect pointer aligned on sizeof(Type). Use loadUnaligned and storeUnaligned else.
+     *
+     * @tparam TType
+     */
+    template <typename TType>
+    struct Packet : public ScalarPacket<TType>
+    {};
+
+#if defined(FOXMATH_USE_SIMD) && defined(FOXMATH_SIMD_SSE) && defined(__AVX__)
+
+    template <>
+    struct Packet<float>
+    {
+        using Type = __m256;
+
+        static constexpr size_t size = 8;
+
+        [[nodiscard]] static inline Type load             (const float* src) noexcept             { return _mm256_load_ps(src); }
+        [[nodiscard]] static inline Type loadUnaligned    (const float* src) noexcept             { return _mm256_loadu_ps(src); }
+        static inline void               store            (float* dst, Type reg) noexcept         { _mm256_store_ps(dst, reg); }
+        static inline void               storeUnaligned   (float* dst, Type reg) noexcept         { _mm256_storeu_ps(dst, reg); }
+        [[nodiscard]] static inline Type set1             (float scalar) noexcept                 { return _mm256_set1_ps(scalar); }
+        [[nodiscard]] static inline Type add              (Type lhs, Type rhs) noexcept           { return _mm256_add_ps(lhs, rhs); }
+        [[nodiscard]] static inline Type sub              (Type lhs, Type rhs) noexcept           { return _mm256_sub_ps(lhs, rhs); }
+        [[nodiscard]] static inline Type mul              (Type lhs, Type rhs) noexcept           { return _mm256_mul_ps(lhs, rhs); }
+        [[nodiscard]] static inline Type div              (Type lhs, Type rhs) noexcept           { return _mm256_div_ps(lhs, rhs); }
+        [[nodiscard]] static inline Type max              (Type lhs, Type rhs) noexcept           { return _mm256_max_ps(lhs, rhs); }
+        [[nodiscard]] static inline Type min              (Type lhs, Type rhs) noexcept           { return _mm256_min_ps(lhs, rhs); }
+        [[nodiscard]] static inline Type abs              (Type reg) noexcept                     { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), reg); }
+        [[nodiscard]] static inline Type sqrt             (Type reg) noexcept                     { return _mm256_sqrt_ps(reg); }
+
+        /*Estimate refined by one Newton step (max error 4 ulp on normal numbers)*/
+        [[nodiscard]] static inline Type rsqrt            (Type reg) noexcept
+        {
+            const __m256 estimate = _mm256_rsqrt_ps(reg);
+            const __m256 halfReg  = _mm256_mul_ps(reg, _mm256_set1_ps(0.5f));
+            return _mm256_mul_ps(estimate, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfReg, _mm256_mul_ps(estimate, estimate))));
+        }
+
+        [[nodiscard]] static inline Type selectIfLess     (Type lhs, Type rhs, Type ifTrue, Type ifFalse) noexcept 
+        { 
+            return _mm256_blendv_ps(ifFalse, ifTrue, _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ)); 
+        }
+
+        [[nodiscard]] static inline unsigned int lessEqualMask (Type lhs, Type rhs) noexcept
+        {
+            return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ)));
+        }
+
+        [[nodiscard]] static inline Type mulAdd           (Type acc, Type a, Type b) noexcept
+        {
+#ifdef __FMA__
+            return _mm256_fmadd_ps(a, b, acc);
+#else
+            return _mm256_add_ps(acc, _mm256_mul_ps(a, b));
+#endif
+        }
+    };
+
+#elif defined(FOXMATH_USE_SIMD) && (defined(FOXMATH_SIMD_SSE) || defined(__aarch64__))
+
+    template <>
+    struct Packet<float>
+    {
+        using Type = Float4;
+
+        static constexpr size_t size = 4;
+
+#ifdef FOXMATH_SIMD_SSE
+        [[nodiscard]] static inline Type load             (const float* src) noexcept             { return _mm_load_ps(src); }
+        static inline void               store            (float* dst, Type reg) noexcept         { _mm_store_ps(dst, reg); }
+        [[nodiscard]] static inline Type max              (Type lhs, Type rhs) noexcept           { return _mm_max_ps(lhs, rhs); }
+        [[nodiscard]] static inline Type min              (Type lhs, Type rhs) noexcept           { return _mm_min_ps(lhs, rhs); }
+        [[nodiscard]] static inline Type abs              (Type reg) noexcept                     { return _mm_andnot_ps(_mm_set1_ps(-0.f), reg); }
+        [[nodiscard]] static inline Type sqrt             (Type reg) noexcept                     { return _mm_sqrt_ps(reg); }
+
+        [[nodiscard]] static inline Type selectIfLess     (Type lhs, Type rhs, Type ifTrue, Type ifFalse) noexcept
+        {
+            const __m128 mask = _mm_cmplt_ps(lhs, rhs);
+            return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+        }
+
+        [[nodiscard]] static inline unsigned int lessEqualMask (Type lhs, Type rhs) noexcept { return static_cast<unsigned int>(_mm_movemask_ps(_mm_cmple_ps(lhs, rhs))); }
+#else
+        [[nodiscard]] static inline Type load             (const float* src) noexcept             { return vld1q_f32(src); }
+        static inline void               store            (float* dst, Type reg) noexcept         { vst1q_f32(dst, reg); }
+        [[nodiscard]] static inline Type max              (Type lhs, Type rhs) noexcept           { return vmaxq_f32(lhs, rhs); }
+        [[nodiscard]] static inline Type min              (Type lhs, Type rhs) noexcept           { return vminq_f32(lhs, rhs); }
+        [[nodiscard]] static inline Type abs              (Type reg) noexcept                     { return vabsq_f32(reg); }
+        [[nodiscard]] static inline Type sqrt             (Type reg) noexcept                     { return vsqrtq_f32(reg); }
+
+        [[nodiscard]] static inline Type selectIfLess     (Type lhs, Type rhs, Type ifTrue, Type ifFalse) noexcept { return vbslq_f32(vcltq_f32(lhs, rhs), ifTrue, ifFalse); }
+
+        [[nodiscard]] static inline unsigned int lessEqualMask (Type lhs, Type rhs) noexcept
+        {
+            const uint32x4_t laneBits = {1u, 2u, 4u, 8u};
+            return vaddvq_u32(vandq_u32(vcleq_f32(lhs, rhs), laneBits));
+        }
+#endif
+        [[nodiscard]] static inline Type loadUnaligned    (const float* src) noexcept             { return SIMD::load<4>(src); }
+        static inline void               storeUnaligned   (float* dst, Type reg) noexcept         { SIMD::store<4>(dst, reg); }
+        [[nodiscard]] static inline Type set1             (float scalar) noexcept                 { return SIMD::set1(scalar); }
+        [[nodiscard]] static inline Type add              (Type lhs, Type rhs) noexcept           { return SIMD::add(lhs, rhs); }
+        [[nodiscard]] static inline Type sub              (Type lhs, Type rhs) noexcept           { return SIMD::sub(lhs, rhs); }
+        [[nodiscard]] static inline Type mul              (Type lhs, Type rhs) noexcept           { return SIMD::mul(lhs, rhs); }
+        [[nodiscard]] static inline Type div              (Type lhs, Type rhs) noexcept           { return SIMD::div(lhs, rhs); }
+        [[nodiscard]] static inline Type mulAdd           (Type acc, Type a, Type b) noexcept     { return SIMD::mulAdd(acc, a, b); }
+        [[nodiscard]] static inline Type rsqrt            (Type reg) noexcept                     { return SIMD::rsqrt(reg); }
+    };
+
+#endif
+
+} /*namespace FoxMath::SIMD*/
@@ -0,0 +1,357 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Quaternion/Quaternion.hpp" //Quaternion
+#include "Matrix/Matrix4.hpp" //Matrix4, TRSDecomposition
+#include "Vector/Vector3.hpp" //Vector3<TType>
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+#include "Numeric/Math.hpp" //Math::sqrt
+
+#include <iostream> //std::ostream
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class DualQuaternion;
+
+    /**
+     * @brief Rigid transformation (rotation then translation) stored in 8 scalars : real + epsilon * dual with epsilon^2 = 0.
+     * The real part is the rotation and the dual part is 0.5 * translation * rotation. Unlike matrices, a weighted sum of unit dual quaternions
+     * stay a rigid transformation once normalized : it is used to blend bones without the volume loss of linear blend skinning.
+     * @example `FoxMath::DualQuaternion<float> bone (rotation, translation); Vec3f p = bone.transformPoint(vertex);`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class DualQuaternion<TType>
+    {
+        private:
+
+        protected:
+
+        #pragma region attribut
+
+        Quaternion<TType> m_real;
+        Quaternion<TType> m_dual;
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Create identity transformation
+         * 
+         */
+        constexpr inline
+        DualQuaternion () noexcept;
+
+        constexpr inline
+        DualQuaternion (const DualQuaternion& other) noexcept				= default;
+
+        constexpr inline
+        DualQuaternion (DualQuaternion&& other) noexcept				    = default;
+
+        inline
+        ~DualQuaternion () noexcept				                            = default;
+
+        constexpr inline
+        DualQuaternion& operator=(DualQuaternion const& other) noexcept	    = default;
+
+        constexpr inline
+        DualQuaternion& operator=(DualQuaternion && other) noexcept         = default;
+
+        /**
+         * @brief Create dual quaternion based on it's parts
+         * 
+         * @param real 
+         * @param dual 
+         */
+        explicit constexpr inline
+        DualQuaternion (const Quaternion<TType>& real, const Quaternion<TType>& dual) noexcept;
+
+        /**
+         * @brief Create rigid transformation : rotation then translation
+         * 
+         * @param rotation : unit quaternion
+         * @param translation 
+         */
+        explicit constexpr inline
+        DualQuaternion (const Quaternion<TType>& rotation, const Vector3<TType>& translation) noexcept;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Normalize the dual quaternion it self : both parts are divided by the magnitude of the real part and the dual part is made orthogonal to the real part.
+         * The result is a rigid transformation.
+         * 
+         * @return constexpr DualQuaternion& 
+         */
+        inline constexpr
+        DualQuaternion& normalize() noexcept;
+
+        /**
+         * @brief Get the normalized dual quaternion. See normalize
+         * 
+         * @return constexpr DualQuaternion 
+         */
+        [[nodiscard]] inline constexpr
+        DualQuaternion getNormalized() const noexcept;
+
+        /**
+         * @brief Conjugate both parts of the dual quaternion it self. For unit dual quaternion, it is the inverse transformation
+         * 
+         * @return constexpr DualQuaternion& 
+         */
+        inline constexpr
+        DualQuaternion& conjugate() noexcept;
+
+        /**
+         * @brief Get the conjugate of both parts. For unit dual quaternion, it is the inverse transformation
+         * 
+         * @return constexpr DualQuaternion 
+         */
+        [[nodiscard]] inline constexpr
+        DualQuaternion getConjugate() const noexcept;
+
+        /**
+         * @brief Get the Translation of the unit dual quaternion : 2 * dual * conjugate(real)
+         * 
+         * @return constexpr Vector3<TType> 
+         */
+        [[nodiscard]] inline constexpr
+        Vector3<TType> getTranslation() const noexcept;
+
+        /**
+         * @brief Transform point with the unit dual quaternion : rotation then translation
+         * 
+         * @param point 
+         * @return constexpr Vector3<TType> 
+         */
+        [[nodiscard]] inline constexpr
+        Vector3<TType> transformPoint(const Vector3<TType>& point) const noexcept;
+
+        /**
+         * @brief Transform direction with the unit dual quaternion. Translation is ignored
+         * 
+         * @param direction 
+         * @return constexpr Vector3<TType> 
+         */
+        [[nodiscard]] inline constexpr
+        Vector3<TType> transformDirection(Vector3<TType> direction) const noexcept;
+
+        /**
+         * @brief Get the affine matrix of the unit dual quaternion : translation * rotation in math notation
+         * 
+         * @tparam TMatrixConvention 
+         * @return constexpr Matrix4<TType, TMatrixConvention> 
+         */
+        template <EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+        [[nodiscard]] inline constexpr
+        Matrix4<TType, TMatrixConvention> toMatrix() const noexcept;
+
+        /**
+         * @brief Get translation and rotation of the unit dual quaternion. Scale is one
+         * 
+         * @return constexpr TRSDecomposition<TType> 
+         */
+        [[nodiscard]] inline constexpr
+        TRSDecomposition<TType> toTRS() const noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region static methods
+
+        /**
+         * @brief Create rigid transformation from translation and rotation. Scale cannot be stored in dual quaternion and is ignored
+         * 
+         * @param trs 
+         * @return constexpr DualQuaternion 
+         */
+        [[nodiscard]] static inline constexpr
+        DualQuaternion createFromTRS(const TRSDecomposition<TType>& trs) noexcept;
+
+        /**
+         * @brief Create rigid transformation from affine matrix with Matrix4::decomposeTRS. Scale is ignored
+         * 
+         * @tparam TMatrixConvention 
+         * @param matrix 
+         * @return constexpr DualQuaternion 
+         */
+        template <EMatrixConvention TMatrixConvention>
+        [[nodiscard]] static inline constexpr
+        DualQuaternion createFromMatrix(const Matrix4<TType, TMatrixConvention>& matrix) noexcept;
+
+        #pragma endregion //!static methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline constexpr
+        const Quaternion<TType>& getReal() const noexcept { return m_real; }
+
+        [[nodiscard]] inline constexpr
+        const Quaternion<TType>& getDual() const noexcept { return m_dual; }
+
+        /**
+         * @brief Get the Rotation of the unit dual quaternion. It is the real part
+         * 
+         * @return constexpr const Quaternion<TType>& 
+         */
+        [[nodiscard]] inline constexpr
+        const Quaternion<TType>& getRotation() const noexcept { return m_real; }
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        inline constexpr
+        void setReal(const Quaternion<TType>& real) noexcept { m_real = real; }
+
+        inline constexpr
+        void setDual(const Quaternion<TType>& dual) noexcept { m_dual = dual; }
+
+        #pragma endregion //!mutator
+
+        #pragma region operator
+        #pragma region assignment operators
+
+        /**
+         * @brief Composition : the transformation of other is applied first
+         * 
+         * @param other 
+         * @return constexpr DualQuaternion& 
+         */
+		inline constexpr
+		DualQuaternion& operator*=(const DualQuaternion& other) noexcept;
+
+        /**
+         * @brief Component wise addition. Use it with the scalar multiplication to blend transformations before normalize
+         * 
+         * @param other 
+         * @return constexpr DualQuaternion& 
+         */
+		inline constexpr
+		DualQuaternion& operator+=(const DualQuaternion& other) noexcept;
+
+        /**
+         * @brief Multiplication of both parts with a scalar
+         * 
+         * @param scalar 
+         * @return constexpr DualQuaternion& 
+         */
+		inline constexpr
+		DualQuaternion& operator*=(TType scalar) noexcept;
+
+        #pragma endregion //!assignment operators
+        #pragma endregion //!operator
+
+        #pragma region static attribut
+
+        static constexpr inline DualQuaternion identity  = DualQuaternion(Quaternion<TType>::identity, Quaternion<TType>(static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(0)));
+
+        #pragma endregion //! static attribut
+    };
+
+    #pragma region arithmetic operators
+
+    /**
+     * @brief Composition : (lhs * rhs) apply rhs then lhs
+     * 
+     * @tparam TType 
+     * @param lhs 
+     * @param rhs 
+     * @return constexpr DualQuaternion<TType> 
+     */
+	template <typename TType>
+	[[nodiscard]] inline constexpr
+    DualQuaternion<TType> operator*(DualQuaternion<TType> lhs, const DualQuaternion<TType>& rhs) noexcept;
+
+    /**
+     * @brief addition
+     * 
+     * @tparam TType 
+     * @param lhs 
+     * @param rhs 
+     * @return constexpr DualQuaternion<TType> 
+     */
+	template <typename TType>
+	[[nodiscard]] inline constexpr
+    DualQuaternion<TType> operator+(DualQuaternion<TType> lhs, const DualQuaternion<TType>& rhs) noexcept;
+
+    /**
+     * @brief multiplication of dual quaternion with a scalar
+     * 
+     * @tparam TType 
+     * @param dualQuat 
+     * @param scalar 
+     * @return constexpr DualQuaternion<TType> 
+     */
+	template <typename TType>
+	[[nodiscard]] inline constexpr
+    DualQuaternion<TType> operator*(DualQuaternion<TType> dualQuat, TType scalar) noexcept;
+
+    /**
+     * @brief multiplication of dual quaternion with a scalar
+     * 
+     * @tparam TType 
+     * @param scalar 
+     * @param dualQuat 
+     * @return constexpr DualQuaternion<TType> 
+     */
+	template <typename TType>
+	[[nodiscard]] inline constexpr
+    DualQuaternion<TType> operator*(TType scalar, DualQuaternion<TType> dualQuat) noexcept;
+
+    #pragma endregion //!arithmetic operators
+
+    #pragma region stream operators
+
+    /**
+     * @brief output stream : real part then dual part
+     * 
+     * @tparam TType 
+     * @param out 
+     * @param dualQuat 
+     * @return constexpr std::ostream& 
+     */
+    template <typename TType>
+    inline
+    std::ostream& 	operator<<		(std::ostream& out, const DualQuaternion<TType>& dualQuat) noexcept;
+
+    #pragma endregion //!stream operators
+
+    #include "DualQuaternion.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,223 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType>
+constexpr inline
+DualQuaternion<TType>::DualQuaternion () noexcept
+    :   m_real  {Quaternion<TType>::identity},
+        m_dual  {static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(0), static_cast<TType>(0)}
+{}
+
+template <typename TType>
+constexpr inline
+DualQuaternion<TType>::DualQuaternion (const Quaternion<TType>& real, const Quaternion<TType>& dual) noexcept
+    :   m_real  {real},
+        m_dual  {dual}
+{}
+
+template <typename TType>
+constexpr inline
+DualQuaternion<TType>::DualQuaternion (const Quaternion<TType>& rotation, const Vector3<TType>& translation) noexcept
+    :   m_real  {rotation},
+        m_dual  {Quaternion<TType>(translation.getX(), translation.getY(), translation.getZ(), static_cast<TType>(0)) * rotation * static_cast<TType>(0.5)}
+{}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType>& DualQuaternion<TType>::normalize() noexcept
+{
+    const TType magnitudeReciprocal = static_cast<TType>(1) / m_real.getMagnitude();
+
+    m_real *= magnitudeReciprocal;
+    m_dual *= magnitudeReciprocal;
+
+    /*Unit dual quaternion needs real . dual = 0*/
+    m_dual -= m_real * m_real.dot(m_dual);
+    return *this;
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType> DualQuaternion<TType>::getNormalized() const noexcept
+{
+    DualQuaternion<TType> rst (*this);
+    rst.normalize();
+    return rst;
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType>& DualQuaternion<TType>::conjugate() noexcept
+{
+    m_real.conjugate();
+    m_dual.conjugate();
+    return *this;
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType> DualQuaternion<TType>::getConjugate() const noexcept
+{
+    DualQuaternion<TType> rst (*this);
+    rst.conjugate();
+    return rst;
+}
+
+template <typename TType>
+inline constexpr
+Vector3<TType> DualQuaternion<TType>::getTranslation() const noexcept
+{
+    /*Vector part of 2 * dual * conjugate(real)*/
+    const Vector3<TType> realXYZ = m_real.getXYZ();
+    const Vector3<TType> dualXYZ = m_dual.getXYZ();
+    const TType two = static_cast<TType>(2);
+
+    return two * (m_real.getW() * dualXYZ - m_dual.getW() * realXYZ + Vector3<TType>::cross(realXYZ, dualXYZ));
+}
+
+template <typename TType>
+inline constexpr
+Vector3<TType> DualQuaternion<TType>::transformPoint(const Vector3<TType>& point) const noexcept
+{
+    return transformDirection(point) + getTranslation();
+}
+
+template <typename TType>
+inline constexpr
+Vector3<TType> DualQuaternion<TType>::transformDirection(Vector3<TType> direction) const noexcept
+{
+    m_real.rotateVector(direction);
+    return direction;
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline constexpr
+Matrix4<TType, TMatrixConvention> DualQuaternion<TType>::toMatrix() const noexcept
+{
+    const Matrix3<TType, EMatrixConvention::RowMajor> rotation = m_real.template getRotationMatrix<EMatrixConvention::RowMajor>();
+    const Vector3<TType> translation = getTranslation();
+    const TType zero = static_cast<TType>(0);
+
+    return Matrix4<TType, TMatrixConvention>(rotation.getData(0, 0), rotation.getData(0, 1), rotation.getData(0, 2), translation.getX(),
+                                             rotation.getData(1, 0), rotation.getData(1, 1), rotation.getData(1, 2), translation.getY(),
+                                             rotation.getData(2, 0), rotation.getData(2, 1), rotation.getData(2, 2), translation.getZ(),
+                                             zero,                   zero,                   zero,                   static_cast<TType>(1));
+}
+
+template <typename TType>
+inline constexpr
+TRSDecomposition<TType> DualQuaternion<TType>::toTRS() const noexcept
+{
+    TRSDecomposition<TType> rst;
+    rst.translation = getTranslation();
+    rst.rotation    = m_real;
+    rst.scale       = Vector3<TType>(static_cast<TType>(1), static_cast<TType>(1), static_cast<TType>(1));
+    return rst;
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType> DualQuaternion<TType>::createFromTRS(const TRSDecomposition<TType>& trs) noexcept
+{
+    return DualQuaternion<TType>(trs.rotation, trs.translation);
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline constexpr
+DualQuaternion<TType> DualQuaternion<TType>::createFromMatrix(const Matrix4<TType, TMatrixConvention>& matrix) noexcept
+{
+    return createFromTRS(matrix.decomposeTRS());
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType>& DualQuaternion<TType>::operator*=(const DualQuaternion& other) noexcept
+{
+    /*(r1 + e d1)(r2 + e d2) = r1 r2 + e (r1 d2 + d1 r2)*/
+    m_dual = m_real * other.m_dual + m_dual * other.m_real;
+    m_real *= other.m_real;
+    return *this;
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType>& DualQuaternion<TType>::operator+=(const DualQuaternion& other) noexcept
+{
+    m_real += other.m_real;
+    m_dual += other.m_dual;
+    return *this;
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType>& DualQuaternion<TType>::operator*=(TType scalar) noexcept
+{
+    m_real *= scalar;
+    m_dual *= scalar;
+    return *this;
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType> operator*(DualQuaternion<TType> lhs, const DualQuaternion<TType>& rhs) noexcept
+{
+    return lhs *= rhs;
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType> operator+(DualQuaternion<TType> lhs, const DualQuaternion<TType>& rhs) noexcept
+{
+    return lhs += rhs;
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType> operator*(DualQuaternion<TType> dualQuat, TType scalar) noexcept
+{
+    return dualQuat *= scalar;
+}
+
+template <typename TType>
+inline constexpr
+DualQuaternion<TType> operator*(TType scalar, DualQuaternion<TType> dualQuat) noexcept
+{
+    return dualQuat *= scalar;
+}
+
+template <typename TType>
+inline
+std::ostream& 	operator<<		(std::ostream& out, const DualQuaternion<TType>& dualQuat) noexcept
+{
+    return out << dualQuat.getReal() << " | " << dualQuat.getDual();
+}
@@ -37,6 +37,11 @@
 #include "Matrix/Matrix3.hpp" //Matrix3
 #include "Numeric/Limits.hpp" //Vector3<TType>
 #include "Angle/Angle.hpp" //Angle<EAngleType::Radian, TType>
+#include "Matrix/MatrixKernel.hpp" //MatrixKernel::transformVectors
+#include "Numeric/SIMD.hpp" //SIMD::Float4
+#include "Numeric/Math.hpp" //Math::sqrt, Math::sin, Math::sincos, Math::acos
+#include "Thread/ParallelFor.hpp" //parallelFor
+#include <type_traits> //std::is_base_of_v
 
 namespace FoxMath
 {
@@ -72,8 +77,45 @@ namespace FoxMath
         #pragma region static attribut
         #pragma endregion //! static attribut
     
+        protected:
+
         #pragma region methods
 
+        /**
+         * @brief Rotate one vector with a unit quaternion : v' = v + w * t + u x t with t = 2 * (u x v), u = (x, y, z).
+         * Same result as v + 2w(u x v) + 2u x (u x v) with 15 multiplications instead of two Hamilton products.
+         * 
+         * @param quaternion : x, y, z, w
+         * @param src : x, y, z
+         * @param dst : x, y, z. Can be src
+         */
+        static inline constexpr
+        void rotateVectorKernel (const TType* quaternion, const TType* src, TType* dst) noexcept;
+
+        /**
+         * @brief Columns of the 4*4 rotation matrix in math notation used by MatrixKernel::transformVectors
+         * 
+         * @return std::array<TType, 16> 
+         */
+        [[nodiscard]] inline constexpr
+        std::array<TType, 16> getRotationColumns () const noexcept;
+
+        /**
+         * @brief Number of TType between two consecutive vectors in an array of TVector3
+         * 
+         * @tparam TVector3 
+         * @return constexpr size_t 
+         */
+        template <typename TVector3>
+        [[nodiscard]] static inline constexpr
+        size_t vectorStride () noexcept
+        {
+            static_assert(std::is_base_of_v<GenericVector<3, TType>, TVector3>, "Vector must be a GenericVector<3> with the same type than the quaternion");
+            static_assert(sizeof(TVector3) % sizeof(TType) == 0 && sizeof(TVector3) >= 3 * sizeof(TType), "Vector layout must be an array of TType");
+
+            return sizeof(TVector3) / sizeof(TType);
+        }
+
         #pragma endregion //!methods
     
         public:
@@ -202,7 +244,7 @@ namespace FoxMath
         Vector3<TType> getAxis() const noexcept;
 
         /**
-         * @brief Get the Rotation Matrix of the quaternion
+         * @brief Get the Rotation Matrix of the quaternion in math notation : rotation matrix * v rotate v like rotateVector
          * 
          * @tparam TMatrixConvention 
          * @return constexpr Matrix3<TType, TMatrixConvention> 
@@ -221,8 +263,8 @@ namespace FoxMath
         TType dot(const Quaternion<TType>& other) const noexcept;
 
         /**
-         * @brief Rotate vector with current quaternion. Is optimized only for 1 vector, else use RotateVectos that use matricial forme.
-         *          Use Rodrigues formula and not q * v * q^-1 for optimization raison.
+         * @brief Rotate vector with current unit quaternion. Is optimized only for 1 vector, else use rotateVectors that use matricial forme.
+         *          Use v + 2w(u x v) + 2u x (u x v) and not q * v * q^-1 for optimization raison.
          * 
          * @param vec
          */
@@ -230,9 +272,40 @@ namespace FoxMath
         inline constexpr
         void rotateVector(Vector3<TTypeVector>& vec) const noexcept;
 
+        /**
+         * @brief Rotate count vectors with current unit quaternion. The quaternion is converted once in rotation matrix and vectors are
+         * transformed with the SIMD kernel of matrix. Buffers are read and written with a stride in number of TType.
+         * src and dst can be the same buffer if strides are the same. Big buffers are split across threads.
+         * 
+         * @param src : x, y, z of each vector
+         * @param srcStride : number of TType between two consecutive vectors in src. 3 for tightly packed vectors
+         * @param dst : x, y, z of each vector
+         * @param dstStride : number of TType between two consecutive vectors in dst
+         * @param count 
+         */
+        inline
+        void rotateVectors(const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept;
+
+        /**
+         * @brief Rotate count vectors with current unit quaternion. src and dst can be the same buffer.
+         * 
+         * @tparam TVector3 : Vec3 or GenericVector<3, TType>
+         * @param src 
+         * @param dst 
+         * @param count 
+         */
+        template <typename TVector3>
+        inline
+        void rotateVectors(const TVector3* src, TVector3* dst, size_t count) const noexcept
+        {
+            constexpr size_t stride = vectorStride<TVector3>();
+            rotateVectors(reinterpret_cast<const TType*>(src), stride, reinterpret_cast<TType*>(dst), stride, count);
+        }
+
         /**
          * @brief Perform the rotation of the vector with the formula : (q1 * q2) * v * (q1 * q2)^-1.
          *        Rotation is firstly on q2 and then on q1
+         * @note Quaternions must be unit
          * 
          * @param vec
          */
@@ -243,6 +316,7 @@ namespace FoxMath
         /**
          * @brief Perform the rotation of the vector with the formula : (q2 * q1) * v * (q2 * q1)^-1.
          *        Rotation is firstly on q1 and then on q2
+         * @note Quaternions must be unit
          * 
          * @param vec
          */
@@ -326,8 +400,41 @@ namespace FoxMath
         void rotateVector(Vector3<TTypeVector>& vec, const Vector3<TTypeAxis>& unitAxis, Angle<EAngleType::Radian, TType> angle) noexcept
         {
             //Rodrigues formula with quaternion is better than quat * vec * quat.getInverse()
-            const TType cosAngle = std::cos(static_cast<TType>(angle));
-            vec = cosAngle * vec + (static_cast<TType>(1) - cosAngle) * vec.dot(unitAxis) * unitAxis + std::sin(static_cast<TType>(angle)) * unitAxis.getCross(vec);
+            const Math::SinCos<Math::Real<TType>> sinCos = angle.getSinCos();
+            const TType cosAngle = static_cast<TType>(sinCos.cos);
+            vec = cosAngle * vec + (static_cast<TType>(1) - cosAngle) * vec.dot(unitAxis) * unitAxis + static_cast<TType>(sinCos.sin) * unitAxis.getCross(vec);
+        }
+
+        /**
+         * @brief Rotate each vector by the unit quaternion with the same index : dst[i] = quaternions[i] * src[i] * quaternions[i]^-1.
+         * Buffers of vectors are read and written with a stride in number of TType. src and dst can be the same buffer if strides are the same.
+         * Big buffers are split across threads.
+         * 
+         * @param quaternions 
+         * @param src : x, y, z of each vector
+         * @param srcStride : number of TType between two consecutive vectors in src. 3 for tightly packed vectors
+         * @param dst : x, y, z of each vector
+         * @param dstStride : number of TType between two consecutive vectors in dst
+         * @param count 
+         */
+        static inline
+        void rotateVectorsPairwise(const Quaternion* quaternions, const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) noexcept;
+
+        /**
+         * @brief Rotate each vector by the unit quaternion with the same index. src and dst can be the same buffer.
+         * 
+         * @tparam TVector3 : Vec3 or GenericVector<3, TType>
+         * @param quaternions 
+         * @param src 
+         * @param dst 
+         * @param count 
+         */
+        template <typename TVector3>
+        static inline
+        void rotateVectorsPairwise(const Quaternion* quaternions, const TVector3* src, TVector3* dst, size_t count) noexcept
+        {
+            constexpr size_t stride = vectorStride<TVector3>();
+            rotateVectorsPairwise(quaternions, reinterpret_cast<const TType*>(src), stride, reinterpret_cast<TType*>(dst), stride, count);
         }
 
         template <typename TTypeVector, typename TTypeAxis>
@@ -373,7 +480,7 @@ namespace FoxMath
         inline constexpr
         void globalRotateVector(const Quaternion<TType>& q1, const Quaternion<TType>& q2, Vector3<TTypeVector>& vec) noexcept
         {
-            q1.GlobalRotateVector(q2, vec);
+            q1.globalRotateVector(q2, vec);
         }
 
         /**
@@ -386,9 +493,33 @@ namespace FoxMath
         inline constexpr
         void localRotateVector(const Quaternion<TType>& q1, const Quaternion<TType>& q2, Vector3<TTypeVector>& vec) noexcept
         {
-            q1.LocalRotateVector(q2, vec);
+            q1.localRotateVector(q2, vec);
         }
 
+        /**
+         * @brief Create unit quaternion from rotation matrix coefficients in math notation (mRowColumn).
+         * Use Shepperd method : the biggest of w, x, y, z is computed with the square root of the trace or of a diagonal element,
+         * the others are deduced from it. The result is normalized to absorb a small drift of the matrix and w is positive.
+         *
+         * @return constexpr Quaternion
+         */
+        [[nodiscard]] static inline constexpr
+        Quaternion createFromRotationMatrix(TType m00, TType m01, TType m02,
+                                            TType m10, TType m11, TType m12,
+                                            TType m20, TType m21, TType m22) noexcept;
+
+        /**
+         * @brief Create unit quaternion from rotation matrix in math notation.
+         * Inverse of getRotationMatrix : the rotation matrix of the result is the input matrix.
+         *
+         * @tparam TMatrixConvention
+         * @param rotation : orthonormal matrix
+         * @return constexpr Quaternion
+         */
+        template <EMatrixConvention TMatrixConvention>
+        [[nodiscard]] static inline constexpr
+        Quaternion createFromRotationMatrix(const Matrix3<TType, TMatrixConvention>& rotation) noexcept;
+
         #pragma endregion //!static methods
 
         #pragma region accessor
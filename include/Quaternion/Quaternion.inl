@@ -34,8 +34,9 @@ inline constexpr
 Quaternion<TType>::Quaternion (Vector3<TType> axis, Angle<EAngleType::Radian, TType> angle) noexcept
 {
     const TType halfAngle    = static_cast<TType>(angle) / static_cast<TType>(2);
-    const TType halfSinAngle = std::sin(halfAngle);
-    const TType halfCosAngle = std::cos(halfAngle);
+    const Math::SinCos<Math::Real<TType>> halfSinCos = Math::sincos(halfAngle);
+    const TType halfSinAngle = static_cast<TType>(halfSinCos.sin);
+    const TType halfCosAngle = static_cast<TType>(halfSinCos.cos);
 
     axis.normalize();
 
@@ -59,7 +60,7 @@ template <typename TType>
 inline constexpr
 TType Quaternion<TType>::getMagnitude() const noexcept
 {
-    return std::sqrt(getSquaredMagnitude());
+    return Math::sqrt(getSquaredMagnitude());
 }
 
 template <typename TType>
@@ -126,7 +127,7 @@ template <typename TType>
 inline constexpr
 Angle<EAngleType::Radian, TType> Quaternion<TType>::getAngle() const noexcept
 {
-    return Angle<EAngleType::Radian, TType>(std::acos(m_w) * static_cast<TType>(2));
+    return Angle<EAngleType::Radian, TType>(Math::acos(m_w) * static_cast<TType>(2));
 }
 
 
@@ -134,7 +135,7 @@ template <typename TType>
 inline constexpr
 Vector3<TType> Quaternion<TType>::getAxis() const noexcept
 {
-    return m_xyz / (std::sin(static_cast<TType>(getAngle()) / static_cast<TType>(2)));
+    return m_xyz / (Math::sin(static_cast<TType>(getAngle()) / static_cast<TType>(2)));
 }
 
 template <typename TType>
@@ -157,12 +158,10 @@ Matrix3<TType, TMatrixConvention> Quaternion<TType>::getRotationMatrix() const n
     const TType twoZZ = twoZ * m_z;
     const TType twoZW = twoZ * m_w;
 
-    const Vector3<TType> vec1 (one - twoYY - twoZZ, twoXY + twoZW, twoXZ - twoYW);
-    const Vector3<TType> vec2 (twoXY - twoZW, one - twoXX - twoZZ, twoYZ + twoXW);
-    const Vector3<TType> vec3 (twoXZ + twoYW, twoYZ - twoXW, one - twoXX - twoYY);
-
-    Mat3<TType, TMatrixConvention> rst ({vec1, vec2, vec3});
-    return rst;
+    /*Coefficients in math notation, row by row*/
+    return Matrix3<TType, TMatrixConvention>(one - twoYY - twoZZ, twoXY - twoZW, twoXZ + twoYW,
+                                             twoXY + twoZW, one - twoXX - twoZZ, twoYZ - twoXW,
+                                             twoXZ - twoYW, twoYZ + twoXW, one - twoXX - twoYY);
 }
 
 template <typename TType>
@@ -172,17 +171,115 @@ TType Quaternion<TType>::dot(const Quaternion<TType>& other) const noexcept
     return m_w * other.getW() + m_x * other.getX() + m_y * other.getY() + m_z * other.getZ(); 
 }
 
+template <typename TType>
+inline constexpr
+void Quaternion<TType>::rotateVectorKernel (const TType* quaternion, const TType* src, TType* dst) noexcept
+{
+    const TType x = quaternion[0], y = quaternion[1], z = quaternion[2], w = quaternion[3];
+    const TType vx = src[0], vy = src[1], vz = src[2];
+
+    /*t = 2 * (u x v)*/
+    const TType tx = static_cast<TType>(2) * (y * vz - z * vy);
+    const TType ty = static_cast<TType>(2) * (z * vx - x * vz);
+    const TType tz = static_cast<TType>(2) * (x * vy - y * vx);
+
+    /*v' = v + w * t + u x t*/
+    dst[0] = vx + w * tx + (y * tz - z * ty);
+    dst[1] = vy + w * ty + (z * tx - x * tz);
+    dst[2] = vz + w * tz + (x * ty - y * tx);
+}
+
+template <typename TType>
+inline constexpr
+std::array<TType, 16> Quaternion<TType>::getRotationColumns () const noexcept
+{
+    const TType zero = static_cast<TType>(0);
+    const TType one = static_cast<TType>(1);
+    const TType twoX = m_x + m_x, twoY = m_y + m_y, twoZ = m_z + m_z;
+    const TType twoXX = twoX * m_x, twoXY = twoX * m_y, twoXZ = twoX * m_z, twoXW = twoX * m_w;
+    const TType twoYY = twoY * m_y, twoYZ = twoY * m_z, twoYW = twoY * m_w;
+    const TType twoZZ = twoZ * m_z, twoZW = twoZ * m_w;
+
+    return {one - twoYY - twoZZ, twoXY + twoZW,         twoXZ - twoYW,          zero,
+            twoXY - twoZW,       one - twoXX - twoZZ,   twoYZ + twoXW,          zero,
+            twoXZ + twoYW,       twoYZ - twoXW,         one - twoXX - twoYY,    zero,
+            zero,                zero,                  zero,                   one};
+}
+
 template <typename TType>
 template <typename TTypeVector>
 inline constexpr
 void Quaternion<TType>::rotateVector(Vector3<TTypeVector>& vec) const noexcept
 {
-    //Rodrigues formula with quaternion is better than quat * vec * quat.getInverse()
-    TType angle = static_cast<TType>(getAngle());
-    Vector3<TType> unitAxis = getAxis();
+    const TType src[3] = {static_cast<TType>(vec[0]), static_cast<TType>(vec[1]), static_cast<TType>(vec[2])};
+    TType dst[3] {};
+
+    rotateVectorKernel(m_data.data(), src, dst);
+    vec = Vector3<TTypeVector>(static_cast<TTypeVector>(dst[0]), static_cast<TTypeVector>(dst[1]), static_cast<TTypeVector>(dst[2]));
+}
+
+template <typename TType>
+inline
+void Quaternion<TType>::rotateVectors(const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) const noexcept
+{
+    const std::array<TType, 16> columns = getRotationColumns();
+
+    parallelFor(count, defaultParallelGrain, [&](size_t begin, size_t end)
+    {
+        MatrixKernel::transformVectors<3, 3, false, false>(columns, src + begin * srcStride, srcStride, dst + begin * dstStride, dstStride, end - begin);
+    });
+}
 
-    const TType cosAngle = std::cos(static_cast<TType>(angle));
-    vec = cosAngle * vec + (static_cast<TType>(1) - cosAngle) * vec.dot(unitAxis) * unitAxis + std::sin(static_cast<TType>(angle)) * unitAxis.getCross(vec);
+template <typename TType>
+inline
+void Quaternion<TType>::rotateVectorsPairwise(const Quaternion* quaternions, const TType* src, size_t srcStride, TType* dst, size_t dstStride, size_t count) noexcept
+{
+    parallelFor(count, defaultParallelGrain, [&](size_t begin, size_t end)
+    {
+        size_t i = begin;
+
+#ifdef FOXMATH_USE_SIMD
+        if constexpr (std::is_same_v<TType, float>)
+        {
+            /*4 pairs by iteration : transpose to get x, y, z, w of 4 quaternions in 4 registers and apply the scalar formula on each lane*/
+            const SIMD::Float4 two = SIMD::set1(2.f);
+
+            for (const size_t packedEnd = begin + (end - begin) / 4 * 4; i < packedEnd; i += 4)
+            {
+                SIMD::Float4 x = SIMD::load<4>(quaternions[i].m_data.data());
+                SIMD::Float4 y = SIMD::load<4>(quaternions[i + 1].m_data.data());
+                SIMD::Float4 z = SIMD::load<4>(quaternions[i + 2].m_data.data());
+                SIMD::Float4 w = SIMD::load<4>(quaternions[i + 3].m_data.data());
+                SIMD::transpose(x, y, z, w);
+
+                SIMD::Float4 vx = SIMD::load<3>(src + i * srcStride);
+                SIMD::Float4 vy = SIMD::load<3>(src + (i + 1) * srcStride);
+                SIMD::Float4 vz = SIMD::load<3>(src + (i + 2) * srcStride);
+                SIMD::Float4 vw = SIMD::load<3>(src + (i + 3) * srcStride);
+                SIMD::transpose(vx, vy, vz, vw);
+
+                const SIMD::Float4 tx = SIMD::mul(two, SIMD::sub(SIMD::mul(y, vz), SIMD::mul(z, vy)));
+                const SIMD::Float4 ty = SIMD::mul(two, SIMD::sub(SIMD::mul(z, vx), SIMD::mul(x, vz)));
+                const SIMD::Float4 tz = SIMD::mul(two, SIMD::sub(SIMD::mul(x, vy), SIMD::mul(y, vx)));
+
+                SIMD::Float4 rx = SIMD::add(SIMD::mulAdd(vx, w, tx), SIMD::sub(SIMD::mul(y, tz), SIMD::mul(z, ty)));
+                SIMD::Float4 ry = SIMD::add(SIMD::mulAdd(vy, w, ty), SIMD::sub(SIMD::mul(z, tx), SIMD::mul(x, tz)));
+                SIMD::Float4 rz = SIMD::add(SIMD::mulAdd(vz, w, tz), SIMD::sub(SIMD::mul(x, ty), SIMD::mul(y, tx)));
+                SIMD::Float4 lastVector = SIMD::zero();
+                SIMD::transpose(rx, ry, rz, lastVector);
+
+                SIMD::store<3>(dst + i * dstStride, rx);
+                SIMD::store<3>(dst + (i + 1) * dstStride, ry);
+                SIMD::store<3>(dst + (i + 2) * dstStride, rz);
+                SIMD::store<3>(dst + (i + 3) * dstStride, lastVector);
+            }
+        }
+#endif
+        for (; i < end; i++)
+        {
+            rotateVectorKernel(quaternions[i].m_data.data(), src + i * srcStride, dst + i * dstStride);
+        }
+    });
 }
 
 template <typename TType>
@@ -190,8 +287,7 @@ template <typename TTypeVector>
 inline constexpr
 void Quaternion<TType>::globalRotateVector(const Quaternion<TType>& otherQuat, Vector3<TTypeVector>& vec) const noexcept
 {
-    const Quaternion<TType> q1q2 = (*this) * otherQuat;
-    vec = (q1q2 * vec * q1q2.getInverse()).getXYZ();
+    ((*this) * otherQuat).rotateVector(vec);
 }
 
 template <typename TType>
@@ -199,8 +295,7 @@ template <typename TTypeVector>
 inline constexpr
 void Quaternion<TType>::localRotateVector(const Quaternion<TType>& otherQuat, Vector3<TTypeVector>& vec) const noexcept
 {
-    const Quaternion<TType> q2q1 = otherQuat * (*this);
-    vec = (q2q1 * vec * q2q1.getInverse()).getXYZ();
+    (otherQuat * (*this)).rotateVector(vec);
 }
 
 template <typename TType>
@@ -217,6 +312,75 @@ Quaternion<TType> Quaternion<TType>::getLocalSmallestDiffenceWithOther(const Qua
     return getInverse() * otherQuat;
 }
 
+template <typename TType>
+inline constexpr
+Quaternion<TType> Quaternion<TType>::createFromRotationMatrix(TType m00, TType m01, TType m02,
+                                                              TType m10, TType m11, TType m12,
+                                                              TType m20, TType m21, TType m22) noexcept
+{
+    const TType one = static_cast<TType>(1);
+    const TType quarter = static_cast<TType>(0.25);
+    const TType trace = m00 + m11 + m22;
+
+    /*Divide only by the biggest component : 4 * max(w, x, y, z)^2 >= 1, no cancellation for rotation near to PI*/
+    TType x {}, y {}, z {}, w {};
+    if (trace > m00 && trace > m11 && trace > m22)
+    {
+        const TType twoW = Math::sqrt(one + trace) * static_cast<TType>(2);
+        const TType reciprocal = one / twoW;
+        w = quarter * twoW;
+        x = (m21 - m12) * reciprocal;
+        y = (m02 - m20) * reciprocal;
+        z = (m10 - m01) * reciprocal;
+    }
+    else if (m00 > m11 && m00 > m22)
+    {
+        const TType twoX = Math::sqrt(one + m00 - m11 - m22) * static_cast<TType>(2);
+        const TType reciprocal = one / twoX;
+        w = (m21 - m12) * reciprocal;
+        x = quarter * twoX;
+        y = (m01 + m10) * reciprocal;
+        z = (m02 + m20) * reciprocal;
+    }
+    else if (m11 > m22)
+    {
+        const TType twoY = Math::sqrt(one + m11 - m00 - m22) * static_cast<TType>(2);
+        const TType reciprocal = one / twoY;
+        w = (m02 - m20) * reciprocal;
+        x = (m01 + m10) * reciprocal;
+        y = quarter * twoY;
+        z = (m12 + m21) * reciprocal;
+    }
+    else
+    {
+        const TType twoZ = Math::sqrt(one + m22 - m00 - m11) * static_cast<TType>(2);
+        const TType reciprocal = one / twoZ;
+        w = (m10 - m01) * reciprocal;
+        x = (m02 + m20) * reciprocal;
+        y = (m12 + m21) * reciprocal;
+        z = quarter * twoZ;
+    }
+
+    /*q and -q are the same rotation : keep w positive to have an unique result*/
+    const TType squaredMagnitude = x * x + y * y + z * z + w * w;
+    const TType scale = (w < static_cast<TType>(0) ? -one : one) / Math::sqrt(squaredMagnitude);
+
+    return Quaternion<TType>(x * scale, y * scale, z * scale, w * scale);
+}
+
+template <typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline constexpr
+Quaternion<TType> Quaternion<TType>::createFromRotationMatrix(const Matrix3<TType, TMatrixConvention>& rotation) noexcept
+{
+    const std::array<TType, 9>& m = rotation.getData();
+
+    if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+        return createFromRotationMatrix(m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8]);
+    else
+        return createFromRotationMatrix(m[0], m[3], m[6], m[1], m[4], m[7], m[2], m[5], m[8]);
+}
+
 template <typename TType>
 template <bool TShortestPath, bool TClampedRatio>
 inline constexpr
@@ -229,14 +393,14 @@ void Quaternion<TType>::sLerp(const Quaternion<TType>& startQuat, const Quaterni
 
     if constexpr (TShortestPath)
     {
-        const TType angle = std::acos(std::abs(dotQaQb));
+        const TType angle = Math::acos(std::abs(dotQaQb));
         const float sign = (dotQaQb >= static_cast<TType>(0)) * static_cast<TType>(2) - static_cast<TType>(1); //Hack to avoid branch (2x - 1) with x is bool
-        *this = (startQuat * sign * std::sin((static_cast<TType>(1) - t) * angle) + endQuat * std::sin(t * angle)) / std::sin(angle);
+        *this = (startQuat * sign * Math::sin((static_cast<TType>(1) - t) * angle) + endQuat * Math::sin(t * angle)) / Math::sin(angle);
     }
     else
     {
-        const TType angle = std::acos(dotQaQb);
-        *this = (startQuat * std::sin((static_cast<TType>(1) - t) * angle) + endQuat * std::sin(t * angle)) / std::sin(angle);
+        const TType angle = Math::acos(dotQaQb);
+        *this = (startQuat * Math::sin((static_cast<TType>(1) - t) * angle) + endQuat * Math::sin(t * angle)) / Math::sin(angle);
     }   
 }
 
@@ -0,0 +1,275 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 17 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Quaternion/Quaternion.hpp" //Quaternion
+#include "Vector/VectorBatch.hpp" //VectorBatch
+#include "Numeric/SIMD.hpp" //SIMD::Packet
+#include "Numeric/Math.hpp" //Math::Fast::sinPacketHalfTurn
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+
+#include <algorithm> //std::clamp, std::fill
+#include <limits> //std::numeric_limits
+#include <cassert> //assert
+#include <stddef.h> //sizt_t
+
+namespace FoxMath
+{
+    /*Define default template arg and apply template condition*/
+    template <typename TType = float, IsArithmetic<TType> = true>
+    class QuaternionBatch;
+
+    /**
+     * @brief Structure of arrays container of quaternions (x0 x1 x2..., y0 y1..., z..., w...) used to blend thousands of rotations.
+     * Interpolations evaluate Packet::size quaternions (4 with SSE/NEON, 8 with AVX) per step without call to std::acos or std::sin :
+     * acos use the polynomial 4.4.46 of Abramowitz and Stegun (absolute error < 2e-8 on [0, 1]) and sin the Taylor polynomial of degree 11
+     * of Math::Fast::sinPacketHalfTurn (absolute error < 2.2e-7 on [-pi/2, 3pi/2]). With float, sLerp components differ from the
+     * double precision reference by less than 5e-7.
+     * @example `FoxMath::QuaternionBatch<float> pose (boneCount); pose.sLerp(walkPose, runPose, blend);`
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class QuaternionBatch<TType> : public VectorBatch<4, TType>
+    {
+        private:
+
+        using Parent = VectorBatch<4, TType>;
+        using Packet = SIMD::Packet<TType>;
+        using PacketType = typename Packet::Type;
+
+        public:
+
+        #pragma region static attribut
+
+        /**
+         * @brief Under this angle between two quaternions (cos > nLerpThreshold, about 1.8 degrees), sLerp use normalized lerp : sin(angle) tends to zero
+         * and the spherical weights lose their precision while the rotation is the same.
+         * 
+         */
+        static constexpr TType nLerpThreshold = static_cast<TType>(0.9995);
+
+        #pragma endregion //! static attribut
+
+        protected:
+
+        #pragma region static methods
+
+        /**
+         * @brief Polynomial acos of x in [0, 1]. Absolute error < 2e-8
+         * 
+         * @param x 
+         * @return PacketType 
+         */
+        [[nodiscard]] static inline
+        PacketType acosPositive (PacketType x) noexcept;
+
+        /**
+         * @brief Interpolate the packet at index of start and end streams and write it in rst streams
+         * 
+         * @tparam TShortestPath 
+         * @tparam TSpherical : true for sLerp, false for nLerp
+         * @param start 
+         * @param end 
+         * @param rst 
+         * @param index 
+         * @param t : ratio of each lane
+         */
+        template <bool TShortestPath, bool TSpherical>
+        static inline
+        void interpolatePacket (const QuaternionBatch& start, const QuaternionBatch& end, QuaternionBatch& rst, size_t index, PacketType t) noexcept;
+
+        #pragma endregion //!static methods
+
+        #pragma region methods
+
+        /**
+         * @brief Call interpolatePacket on each packet with the same ratio
+         * 
+         */
+        template <bool TShortestPath, bool TClampedRatio, bool TSpherical>
+        inline
+        void interpolate (const QuaternionBatch& start, const QuaternionBatch& end, TType t) noexcept;
+
+        /**
+         * @brief Call interpolatePacket on each packet with one ratio by quaternion
+         * 
+         */
+        template <bool TShortestPath, bool TClampedRatio, bool TSpherical>
+        inline
+        void interpolate (const QuaternionBatch& start, const QuaternionBatch& end, const TType* ratios) noexcept;
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        QuaternionBatch ()                                          = default;
+        QuaternionBatch (const QuaternionBatch& other)			    = default;
+        QuaternionBatch (QuaternionBatch&& other) noexcept	        = default;
+        ~QuaternionBatch ()				                            = default;
+        QuaternionBatch& operator=(QuaternionBatch const& other)    = default;
+        QuaternionBatch& operator=(QuaternionBatch && other)        = default;
+
+        /**
+         * @brief Create size identity quaternions
+         * 
+         * @param size 
+         */
+        explicit inline
+        QuaternionBatch (size_t size);
+
+        /**
+         * @brief Gather count quaternions
+         * 
+         * @param quaternions 
+         * @param count 
+         */
+        explicit inline
+        QuaternionBatch (const Quaternion<TType>* quaternions, size_t count);
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Gather count quaternions from array of structure in the batch from index offset. The batch grows if needed.
+         * 
+         * @param quaternions 
+         * @param count 
+         * @param offset 
+         */
+        inline
+        void gather (const Quaternion<TType>* quaternions, size_t count, size_t offset = 0);
+
+        /**
+         * @brief Scatter count quaternions of the batch from index offset to array of structure
+         * 
+         * @param quaternions 
+         * @param count 
+         * @param offset 
+         */
+        inline
+        void scatter (Quaternion<TType>* quaternions, size_t count, size_t offset = 0) const noexcept;
+
+        /**
+         * @brief Spherical interpolation of each pair of start and end with the same ratio. start, end and the batch must have the same size.
+         * Quaternions must be unit. Near parallel pairs use normalized lerp and results are renormalized.
+         * @note Without TShortestPath, opposite quaternions (dot near -1) have no defined result like Quaternion::sLerp.
+         * 
+         * @tparam TShortestPath : true if the ratio must use the shotedt path. Else more optimized but can go with the largest path to goal 
+         * @tparam TClampedRatio : true if the ratio must be clamped between 0 and 1. Else ratio must keep t * angle in the range of the sin polynomial
+         * @param start 
+         * @param end 
+         * @param t 
+         * @return QuaternionBatch& 
+         */
+        template <bool TShortestPath = true, bool TClampedRatio = true>
+        inline
+        QuaternionBatch& sLerp (const QuaternionBatch& start, const QuaternionBatch& end, TType t) noexcept;
+
+        /**
+         * @brief Spherical interpolation of each pair of start and end with its own ratio. ratios contain size() elements.
+         * 
+         * @tparam TShortestPath 
+         * @tparam TClampedRatio 
+         * @param start 
+         * @param end 
+         * @param ratios 
+         * @return QuaternionBatch& 
+         */
+        template <bool TShortestPath = true, bool TClampedRatio = true>
+        inline
+        QuaternionBatch& sLerp (const QuaternionBatch& start, const QuaternionBatch& end, const TType* ratios) noexcept;
+
+        /**
+         * @brief Linear interpolation of each pair of start and end with the same ratio, then normalized. Angulare speed is not safe
+         * 
+         * @tparam TShortestPath 
+         * @tparam TClampedRatio 
+         * @param start 
+         * @param end 
+         * @param t 
+         * @return QuaternionBatch& 
+         */
+        template <bool TShortestPath = true, bool TClampedRatio = true>
+        inline
+        QuaternionBatch& nLerp (const QuaternionBatch& start, const QuaternionBatch& end, TType t) noexcept;
+
+        /**
+         * @brief Linear interpolation of each pair of start and end with its own ratio, then normalized. ratios contain size() elements.
+         * 
+         * @tparam TShortestPath 
+         * @tparam TClampedRatio 
+         * @param start 
+         * @param end 
+         * @param ratios 
+         * @return QuaternionBatch& 
+         */
+        template <bool TShortestPath = true, bool TClampedRatio = true>
+        inline
+        QuaternionBatch& nLerp (const QuaternionBatch& start, const QuaternionBatch& end, const TType* ratios) noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        /**
+         * @brief Gather the quaternion at index
+         * 
+         * @param index 
+         * @return Quaternion<TType> 
+         */
+        [[nodiscard]] inline
+        Quaternion<TType> getQuaternion (size_t index) const noexcept;
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        /**
+         * @brief Scatter the quaternion at index
+         * 
+         * @param index 
+         * @param quaternion 
+         */
+        inline
+        void setQuaternion (size_t index, const Quaternion<TType>& quaternion) noexcept;
+
+        #pragma endregion //!mutator
+    };
+
+    #include "QuaternionBatch.inl"
+
+    using QuaternionfBatch = QuaternionBatch<float>;
+    using QuaterniondBatch = QuaternionBatch<double>;
+
+} /*namespace FoxMath*/
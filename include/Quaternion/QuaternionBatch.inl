@@ -0,0 +1,272 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 17 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+template <typename TType>
+inline
+typename SIMD::Packet<TType>::Type QuaternionBatch<TType>::acosPositive (PacketType x) noexcept
+{
+    /*Abramowitz and Stegun 4.4.46 : acos(x) = sqrt(1 - x) * P(x) on [0, 1]*/
+    PacketType poly = Packet::set1(static_cast<TType>(-0.0012624911));
+    poly = Packet::mulAdd(Packet::set1(static_cast<TType>(0.0066700901)), poly, x);
+    poly = Packet::mulAdd(Packet::set1(static_cast<TType>(-0.0170881256)), poly, x);
+    poly = Packet::mulAdd(Packet::set1(static_cast<TType>(0.0308918810)), poly, x);
+    poly = Packet::mulAdd(Packet::set1(static_cast<TType>(-0.0501743046)), poly, x);
+    poly = Packet::mulAdd(Packet::set1(static_cast<TType>(0.0889789874)), poly, x);
+    poly = Packet::mulAdd(Packet::set1(static_cast<TType>(-0.2145988016)), poly, x);
+    poly = Packet::mulAdd(Packet::set1(static_cast<TType>(1.5707963050)), poly, x);
+
+    return Packet::mul(Packet::sqrt(Packet::sub(Packet::set1(static_cast<TType>(1)), x)), poly);
+}
+
+template <typename TType>
+template <bool TShortestPath, bool TSpherical>
+inline
+void QuaternionBatch<TType>::interpolatePacket (const QuaternionBatch& start, const QuaternionBatch& end, QuaternionBatch& rst, size_t index, PacketType t) noexcept
+{
+    const PacketType zero   = Packet::set1(static_cast<TType>(0));
+    const PacketType one    = Packet::set1(static_cast<TType>(1));
+
+    PacketType startQuat[4];
+    PacketType endQuat[4];
+    PacketType cosAngle = zero;
+
+    for (size_t component = 0; component < 4; component++)
+    {
+        startQuat[component] = Packet::load(start.m_streams[component].data() + index);
+        endQuat[component]   = Packet::load(end.m_streams[component].data() + index);
+        cosAngle = Packet::mulAdd(cosAngle, startQuat[component], endQuat[component]);
+    }
+
+    const PacketType absCosAngle = Packet::abs(cosAngle);
+
+    PacketType startWeight = Packet::sub(one, t);
+    PacketType endWeight   = t;
+
+    if constexpr (TSpherical)
+    {
+        const PacketType x      = Packet::min(absCosAngle, one);
+        PacketType angle        = acosPositive(x);
+
+        if constexpr (!TShortestPath)
+        {
+            /*acos(-x) = pi - acos(x)*/
+            angle = Packet::selectIfLess(cosAngle, zero, Packet::sub(Packet::set1(static_cast<TType>(3.14159265358979323846)), angle), angle);
+        }
+
+        /*sin(acos(x)) = sqrt((1 - x)(1 + x)). Near parallel lanes are replaced by lerp weights after so the division can't produce NaN in the result*/
+        const PacketType sinAngle   = Packet::sqrt(Packet::mul(Packet::sub(one, x), Packet::add(one, x)));
+        const PacketType invSin     = Packet::div(one, Packet::max(sinAngle, Packet::set1(std::numeric_limits<TType>::min())));
+
+        const PacketType isSpherical = Packet::sub(absCosAngle, Packet::set1(nLerpThreshold));
+        startWeight = Packet::selectIfLess(isSpherical, zero, Packet::mul(Math::Fast::sinPacketHalfTurn<TType>(Packet::mul(startWeight, angle)), invSin), startWeight);
+        endWeight   = Packet::selectIfLess(isSpherical, zero, Packet::mul(Math::Fast::sinPacketHalfTurn<TType>(Packet::mul(endWeight, angle)), invSin), endWeight);
+    }
+
+    if constexpr (TShortestPath)
+    {
+        /*Reverse start if quaternions are on the opposite hemispheres*/
+        startWeight = Packet::mul(startWeight, Packet::selectIfLess(cosAngle, zero, Packet::set1(static_cast<TType>(-1)), one));
+    }
+
+    PacketType rstQuat[4];
+    PacketType squareLength = zero;
+
+    for (size_t component = 0; component < 4; component++)
+    {
+        rstQuat[component] = Packet::mulAdd(Packet::mul(startWeight, startQuat[component]), endWeight, endQuat[component]);
+        squareLength = Packet::mulAdd(squareLength, rstQuat[component], rstQuat[component]);
+    }
+
+    /*Normalize lerp lanes and remove the polynomial error of slerp lanes. Null padding quaternions stay null*/
+    const PacketType length = Packet::max(Packet::sqrt(squareLength), Packet::set1(std::numeric_limits<TType>::min()));
+
+    for (size_t component = 0; component < 4; component++)
+    {
+        Packet::store(rst.m_streams[component].data() + index, Packet::div(rstQuat[component], length));
+    }
+}
+
+template <typename TType>
+template <bool TShortestPath, bool TClampedRatio, bool TSpherical>
+inline
+void QuaternionBatch<TType>::interpolate (const QuaternionBatch& start, const QuaternionBatch& end, TType t) noexcept
+{
+    assert(start.size() == this->size() && end.size() == this->size());
+
+    if constexpr (TClampedRatio)
+        t = std::clamp<TType>(t, static_cast<TType>(0), static_cast<TType>(1));
+
+    const PacketType ratio = Packet::set1(t);
+
+    this->forEachPacket([&](size_t index)
+    {
+        interpolatePacket<TShortestPath, TSpherical>(start, end, *this, index, ratio);
+    });
+}
+
+template <typename TType>
+template <bool TShortestPath, bool TClampedRatio, bool TSpherical>
+inline
+void QuaternionBatch<TType>::interpolate (const QuaternionBatch& start, const QuaternionBatch& end, const TType* ratios) noexcept
+{
+    assert(start.size() == this->size() && end.size() == this->size());
+
+    const size_t packetEnd = this->size() - this->size() % Packet::size;
+
+    this->forEachPacket([&](size_t index)
+    {
+        PacketType ratio;
+
+        if (index < packetEnd)
+        {
+            ratio = Packet::loadUnaligned(ratios + index);
+        }
+        else
+        {
+            /*ratios contain only size() elements : the tail is copied and padding lanes use 0*/
+            TType tail[Packet::size] {};
+
+            for (size_t i = index; i < this->size(); i++)
+            {
+                tail[i - index] = ratios[i];
+            }
+
+            ratio = Packet::loadUnaligned(tail);
+        }
+
+        if constexpr (TClampedRatio)
+            ratio = Packet::min(Packet::max(ratio, Packet::set1(static_cast<TType>(0))), Packet::set1(static_cast<TType>(1)));
+
+        interpolatePacket<TShortestPath, TSpherical>(start, end, *this, index, ratio);
+    });
+}
+
+template <typename TType>
+inline
+QuaternionBatch<TType>::QuaternionBatch (size_t size)
+    : Parent (size)
+{
+    /*Identity quaternion*/
+    std::fill(this->m_streams[3].begin(), this->m_streams[3].end(), static_cast<TType>(1));
+}
+
+template <typename TType>
+inline
+QuaternionBatch<TType>::QuaternionBatch (const Quaternion<TType>* quaternions, size_t count)
+{
+    gather(quaternions, count);
+}
+
+template <typename TType>
+inline
+void QuaternionBatch<TType>::gather (const Quaternion<TType>* quaternions, size_t count, size_t offset)
+{
+    if (offset + count > this->size())
+        this->resize(offset + count);
+
+    TType* const x = this->m_streams[0].data() + offset;
+    TType* const y = this->m_streams[1].data() + offset;
+    TType* const z = this->m_streams[2].data() + offset;
+    TType* const w = this->m_streams[3].data() + offset;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        x[i] = quaternions[i].getX();
+        y[i] = quaternions[i].getY();
+        z[i] = quaternions[i].getZ();
+        w[i] = quaternions[i].getW();
+    }
+}
+
+template <typename TType>
+inline
+void QuaternionBatch<TType>::scatter (Quaternion<TType>* quaternions, size_t count, size_t offset) const noexcept
+{
+    assert(offset + count <= this->size());
+
+    for (size_t i = 0; i < count; i++)
+    {
+        quaternions[i] = getQuaternion(offset + i);
+    }
+}
+
+template <typename TType>
+template <bool TShortestPath, bool TClampedRatio>
+inline
+QuaternionBatch<TType>& QuaternionBatch<TType>::sLerp (const QuaternionBatch& start, const QuaternionBatch& end, TType t) noexcept
+{
+    interpolate<TShortestPath, TClampedRatio, true>(start, end, t);
+    return *this;
+}
+
+template <typename TType>
+template <bool TShortestPath, bool TClampedRatio>
+inline
+QuaternionBatch<TType>& QuaternionBatch<TType>::sLerp (const QuaternionBatch& start, const QuaternionBatch& end, const TType* ratios) noexcept
+{
+    interpolate<TShortestPath, TClampedRatio, true>(start, end, ratios);
+    return *this;
+}
+
+template <typename TType>
+template <bool TShortestPath, bool TClampedRatio>
+inline
+QuaternionBatch<TType>& QuaternionBatch<TType>::nLerp (const QuaternionBatch& start, const QuaternionBatch& end, TType t) noexcept
+{
+    interpolate<TShortestPath, TClampedRatio, false>(start, end, t);
+    return *this;
+}
+
+template <typename TType>
+template <bool TShortestPath, bool TClampedRatio>
+inline
+QuaternionBatch<TType>& QuaternionBatch<TType>::nLerp (const QuaternionBatch& start, const QuaternionBatch& end, const TType* ratios) noexcept
+{
+    interpolate<TShortestPath, TClampedRatio, false>(start, end, ratios);
+    return *this;
+}
+
+template <typename TType>
+inline
+Quaternion<TType> QuaternionBatch<TType>::getQuaternion (size_t index) const noexcept
+{
+    assert(index < this->size());
+    return Quaternion<TType>(this->m_streams[0][index], this->m_streams[1][index], this->m_streams[2][index], this->m_streams[3][index]);
+}
+
+template <typename TType>
+inline
+void QuaternionBatch<TType>::setQuaternion (size_t index, const Quaternion<TType>& quaternion) noexcept
+{
+    assert(index < this->size());
+    this->m_streams[0][index] = quaternion.getX();
+    this->m_streams[1][index] = quaternion.getY();
+    this->m_streams[2][index] = quaternion.getZ();
+    this->m_streams[3][index] = quaternion.getW();
+}
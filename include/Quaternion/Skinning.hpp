@@ -0,0 +1,325 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Quaternion/DualQuaternion.hpp" //DualQuaternion
+#include "Matrix/Matrix4.hpp" //Matrix4
+#include "Vector/VectorBatch.hpp" //VectorBatch
+#include "Numeric/SIMD.hpp" //SIMD::Packet
+#include "Thread/ParallelFor.hpp" //parallelFor
+
+#include <stddef.h> //sizt_t
+#include <limits> //std::numeric_limits
+#include <algorithm> //std::min
+#include <cassert> //assert
+
+/**
+ * @brief Skinning of vertex streams stored in VectorBatch (structure of arrays). Each vertex is influenced by TInfluenceCount bones :
+ * boneIndices and weights hold one stream by influence slot (slot k of all vertices, then slot k + 1...). Unused slots must have a null weight.
+ * Bones of Packet::size vertices are blended in scalar (palette access is a gather) and the blended transformations are applied to the vertices
+ * in SIMD registers. Big batches are split across threads.
+ */
+namespace FoxMath
+{
+    namespace Skinning
+    {
+        /*Minimum number of vertices given to one thread*/
+        inline constexpr size_t parallelGrain = defaultParallelGrain / 16;
+
+        /**
+         * @brief Call functor(laneCount, index) for each packet of vertices in [0, count[. index is a multiple of Packet::size
+         * and the last packet can be partial : streams of VectorBatch are padded so the full packet can be loaded and stored.
+         */
+        template <typename TPacket, typename TFunctor>
+        inline
+        void forEachPacket (size_t count, TFunctor&& functor) noexcept
+        {
+            const size_t packetCount = (count + TPacket::size - 1) / TPacket::size;
+
+            parallelFor(packetCount, parallelGrain / TPacket::size, [&](size_t begin, size_t end)
+            {
+                for (size_t packet = begin; packet < end; packet++)
+                {
+                    const size_t index = packet * TPacket::size;
+                    functor(std::min(TPacket::size, count - index), index);
+                }
+            });
+        }
+
+        /**
+         * @brief Get coefficient of the affine matrix in math notation
+         */
+        template <typename TType, EMatrixConvention TMatrixConvention>
+        [[nodiscard]] inline constexpr
+        TType getCoefficient (const Matrix4<TType, TMatrixConvention>& matrix, size_t row, size_t column) noexcept
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                return matrix.getData(row, column);
+            else
+                return matrix.getData(column, row);
+        }
+
+        /**
+         * @brief Write in lanes[component][lane] the dual quaternion blending of Packet::size vertices from index.
+         * The sign of each bone is flipped if it is not in the same hemisphere than the first bone (q and -q are the same rotation).
+         * Missing lanes are identity.
+         */
+        template <size_t TInfluenceCount, typename TType, size_t TLaneCount>
+        inline
+        void blendDualQuaternions (const DualQuaternion<TType>* palette, const VectorBatch<TInfluenceCount, unsigned int>& boneIndices, const VectorBatch<TInfluenceCount, TType>& weights,
+                                   size_t index, size_t laneCount, TType (&lanes)[8][TLaneCount]) noexcept
+        {
+            for (size_t lane = 0; lane < TLaneCount; lane++)
+            {
+                TType blended[8] {};
+
+                if (lane < laneCount)
+                {
+                    const size_t vertex = index + lane;
+                    const DualQuaternion<TType>& first = palette[boneIndices.getStream(0)[vertex]];
+                    const TType* firstReal = first.getReal().m_data.data();
+
+                    for (size_t influence = 0; influence < TInfluenceCount; influence++)
+                    {
+                        const DualQuaternion<TType>& bone = (influence == 0) ? first : palette[boneIndices.getStream(influence)[vertex]];
+                        const TType* real = bone.getReal().m_data.data();
+                        const TType* dual = bone.getDual().m_data.data();
+
+                        /*Branch free sign : hemisphere of random bones is not predictable*/
+                        const TType dot = firstReal[0] * real[0] + firstReal[1] * real[1] + firstReal[2] * real[2] + firstReal[3] * real[3];
+                        const TType weight = weights.getStream(influence)[vertex] * static_cast<TType>(static_cast<int>(dot >= static_cast<TType>(0)) * 2 - 1);
+
+                        for (size_t component = 0; component < 4; component++)
+                        {
+                            blended[component]     += weight * real[component];
+                            blended[component + 4] += weight * dual[component];
+                        }
+                    }
+                }
+                else
+                {
+                    blended[3] = static_cast<TType>(1);
+                }
+
+                for (size_t component = 0; component < 8; component++)
+                    lanes[component][lane] = blended[component];
+            }
+        }
+
+        /**
+         * @brief Write in lanes[row * 4 + column][lane] the linear blending of the 3 first rows of the affine matrices of Packet::size vertices from index.
+         * Missing lanes are identity.
+         */
+        template <size_t TInfluenceCount, typename TType, EMatrixConvention TMatrixConvention, size_t TLaneCount>
+        inline
+        void blendMatrices (const Matrix4<TType, TMatrixConvention>* palette, const VectorBatch<TInfluenceCount, unsigned int>& boneIndices, const VectorBatch<TInfluenceCount, TType>& weights,
+                            size_t index, size_t laneCount, TType (&lanes)[12][TLaneCount]) noexcept
+        {
+            for (size_t lane = 0; lane < TLaneCount; lane++)
+            {
+                TType blended[12] {};
+
+                if (lane < laneCount)
+                {
+                    const size_t vertex = index + lane;
+
+                    for (size_t influence = 0; influence < TInfluenceCount; influence++)
+                    {
+                        const Matrix4<TType, TMatrixConvention>& bone = palette[boneIndices.getStream(influence)[vertex]];
+                        const TType weight = weights.getStream(influence)[vertex];
+
+                        for (size_t row = 0; row < 3; row++)
+                            for (size_t column = 0; column < 4; column++)
+                                blended[row * 4 + column] += weight * getCoefficient(bone, row, column);
+                    }
+                }
+                else
+                {
+                    blended[0] = blended[5] = blended[10] = static_cast<TType>(1);
+                }
+
+                for (size_t component = 0; component < 12; component++)
+                    lanes[component][lane] = blended[component];
+            }
+        }
+
+    } /*namespace FoxMath::Skinning*/
+
+    /**
+     * @brief Dual quaternion skinning : the bones of each vertex are blended with their weights and normalized, so the vertex is moved by a rigid transformation.
+     * Unlike linear blend skinning, the volume is preserved around joints with big twist (no candy wrapper artifacts). Scale of bones is not supported.
+     * Normals are only rotated.
+     * @example `skinDualQuaternion(bonePalette.data(), boneIndices, weights, bindPositions, bindNormals, positions, normals);`
+     * 
+     * @tparam TInfluenceCount : number of bones by vertex
+     * @param palette : unit dual quaternion of each bone (bind pose to current pose)
+     * @param boneIndices : index in palette of each influence
+     * @param weights : weight of each influence. Sum of weights of a vertex must be one
+     * @param positions : positions in bind pose
+     * @param normals : normals in bind pose. Same size than positions
+     * @param dstPositions : resized to positions size. Can be positions
+     * @param dstNormals : resized to normals size. Can be normals
+     */
+    template <size_t TInfluenceCount, typename TType>
+    inline
+    void skinDualQuaternion (const DualQuaternion<TType>* palette, const VectorBatch<TInfluenceCount, unsigned int>& boneIndices, const VectorBatch<TInfluenceCount, TType>& weights,
+                             const VectorBatch<3, TType>& positions, const VectorBatch<3, TType>& normals, VectorBatch<3, TType>& dstPositions, VectorBatch<3, TType>& dstNormals)
+    {
+        using Packet = SIMD::Packet<TType>;
+        using PacketType = typename Packet::Type;
+
+        assert(boneIndices.size() >= positions.size() && weights.size() >= positions.size() && normals.size() == positions.size());
+
+        dstPositions.resize(positions.size());
+        dstNormals.resize(normals.size());
+
+        Skinning::forEachPacket<Packet>(positions.size(), [&](size_t laneCount, size_t index)
+        {
+            alignas(64) TType lanes[8][Packet::size];
+            Skinning::blendDualQuaternions(palette, boneIndices, weights, index, laneCount, lanes);
+
+            PacketType real[4], dual[4];
+            for (size_t component = 0; component < 4; component++)
+            {
+                real[component] = Packet::load(lanes[component]);
+                dual[component] = Packet::load(lanes[component + 4]);
+            }
+
+            /*Normalize by the magnitude of the real part. Null blending (weights sum is null) stay null*/
+            const PacketType squaredMagnitude = Packet::mulAdd(Packet::mulAdd(Packet::mulAdd(Packet::mul(real[0], real[0]), real[1], real[1]), real[2], real[2]), real[3], real[3]);
+            const PacketType magnitudeReciprocal = Packet::div(Packet::set1(static_cast<TType>(1)), Packet::sqrt(Packet::max(squaredMagnitude, Packet::set1(std::numeric_limits<TType>::min()))));
+
+            for (size_t component = 0; component < 4; component++)
+            {
+                real[component] = Packet::mul(real[component], magnitudeReciprocal);
+                dual[component] = Packet::mul(dual[component], magnitudeReciprocal);
+            }
+
+            const PacketType two = Packet::set1(static_cast<TType>(2));
+
+            /*translation = 2 * (w * dual.xyz - dual.w * xyz + xyz x dual.xyz)*/
+            const PacketType translation[3] = {
+                Packet::mul(two, Packet::add(Packet::sub(Packet::mul(real[3], dual[0]), Packet::mul(dual[3], real[0])), Packet::sub(Packet::mul(real[1], dual[2]), Packet::mul(real[2], dual[1])))),
+                Packet::mul(two, Packet::add(Packet::sub(Packet::mul(real[3], dual[1]), Packet::mul(dual[3], real[1])), Packet::sub(Packet::mul(real[2], dual[0]), Packet::mul(real[0], dual[2])))),
+                Packet::mul(two, Packet::add(Packet::sub(Packet::mul(real[3], dual[2]), Packet::mul(dual[3], real[2])), Packet::sub(Packet::mul(real[0], dual[1]), Packet::mul(real[1], dual[0]))))};
+
+            /*Same rotation than Quaternion::rotateVectorKernel : v' = v + w * t + xyz x t with t = 2 * (xyz x v)*/
+            const auto rotate = [&](const PacketType (&v)[3], PacketType (&rst)[3])
+            {
+                const PacketType t[3] = {Packet::mul(two, Packet::sub(Packet::mul(real[1], v[2]), Packet::mul(real[2], v[1]))),
+                                         Packet::mul(two, Packet::sub(Packet::mul(real[2], v[0]), Packet::mul(real[0], v[2]))),
+                                         Packet::mul(two, Packet::sub(Packet::mul(real[0], v[1]), Packet::mul(real[1], v[0])))};
+
+                rst[0] = Packet::add(Packet::mulAdd(v[0], real[3], t[0]), Packet::sub(Packet::mul(real[1], t[2]), Packet::mul(real[2], t[1])));
+                rst[1] = Packet::add(Packet::mulAdd(v[1], real[3], t[1]), Packet::sub(Packet::mul(real[2], t[0]), Packet::mul(real[0], t[2])));
+                rst[2] = Packet::add(Packet::mulAdd(v[2], real[3], t[2]), Packet::sub(Packet::mul(real[0], t[1]), Packet::mul(real[1], t[0])));
+            };
+
+            PacketType vertex[3], rst[3];
+
+            for (size_t component = 0; component < 3; component++)
+                vertex[component] = Packet::load(positions.getStream(component) + index);
+
+            rotate(vertex, rst);
+
+            for (size_t component = 0; component < 3; component++)
+                Packet::store(dstPositions.getStream(component) + index, Packet::add(rst[component], translation[component]));
+
+            for (size_t component = 0; component < 3; component++)
+                vertex[component] = Packet::load(normals.getStream(component) + index);
+
+            rotate(vertex, rst);
+
+            for (size_t component = 0; component < 3; component++)
+                Packet::store(dstNormals.getStream(component) + index, rst[component]);
+        });
+    }
+
+    /**
+     * @brief Linear blend skinning : the affine matrices of the bones of each vertex are blended with their weights.
+     * Normals are transformed with the blended linear part and normalized (exact only without non uniform scale).
+     * 
+     * @tparam TInfluenceCount : number of bones by vertex
+     * @param palette : affine matrix of each bone (bind pose to current pose)
+     * @param boneIndices : index in palette of each influence
+     * @param weights : weight of each influence. Sum of weights of a vertex must be one
+     * @param positions : positions in bind pose
+     * @param normals : normals in bind pose. Same size than positions
+     * @param dstPositions : resized to positions size. Can be positions
+     * @param dstNormals : resized to normals size. Can be normals
+     */
+    template <size_t TInfluenceCount, typename TType, EMatrixConvention TMatrixConvention>
+    inline
+    void skinLinearBlend (const Matrix4<TType, TMatrixConvention>* palette, const VectorBatch<TInfluenceCount, unsigned int>& boneIndices, const VectorBatch<TInfluenceCount, TType>& weights,
+                          const VectorBatch<3, TType>& positions, const VectorBatch<3, TType>& normals, VectorBatch<3, TType>& dstPositions, VectorBatch<3, TType>& dstNormals)
+    {
+        using Packet = SIMD::Packet<TType>;
+        using PacketType = typename Packet::Type;
+
+        assert(boneIndices.size() >= positions.size() && weights.size() >= positions.size() && normals.size() == positions.size());
+
+        dstPositions.resize(positions.size());
+        dstNormals.resize(normals.size());
+
+        Skinning::forEachPacket<Packet>(positions.size(), [&](size_t laneCount, size_t index)
+        {
+            alignas(64) TType lanes[12][Packet::size];
+            Skinning::blendMatrices(palette, boneIndices, weights, index, laneCount, lanes);
+
+            PacketType m[12];
+            for (size_t component = 0; component < 12; component++)
+                m[component] = Packet::load(lanes[component]);
+
+            PacketType vertex[3], rst[3];
+
+            for (size_t component = 0; component < 3; component++)
+                vertex[component] = Packet::load(positions.getStream(component) + index);
+
+            for (size_t row = 0; row < 3; row++)
+            {
+                rst[row] = Packet::mulAdd(Packet::mulAdd(Packet::mulAdd(m[row * 4 + 3], m[row * 4], vertex[0]), m[row * 4 + 1], vertex[1]), m[row * 4 + 2], vertex[2]);
+                Packet::store(dstPositions.getStream(row) + index, rst[row]);
+            }
+
+            for (size_t component = 0; component < 3; component++)
+                vertex[component] = Packet::load(normals.getStream(component) + index);
+
+            for (size_t row = 0; row < 3; row++)
+                rst[row] = Packet::mulAdd(Packet::mulAdd(Packet::mul(m[row * 4], vertex[0]), m[row * 4 + 1], vertex[1]), m[row * 4 + 2], vertex[2]);
+
+            const PacketType squaredLength = Packet::mulAdd(Packet::mulAdd(Packet::mul(rst[0], rst[0]), rst[1], rst[1]), rst[2], rst[2]);
+            const PacketType lengthReciprocal = Packet::div(Packet::set1(static_cast<TType>(1)), Packet::sqrt(Packet::max(squaredLength, Packet::set1(std::numeric_limits<TType>::min()))));
+
+            for (size_t component = 0; component < 3; component++)
+                Packet::store(dstNormals.getStream(component) + index, Packet::mul(rst[component], lengthReciprocal));
+        });
+    }
+
+} /*namespace FoxMath*/
@@ -0,0 +1,107 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <algorithm> //std::min, std::max
+
+/*Define DONT_USE_THREAD to force every parallel loop to run on the calling thread*/
+#ifndef DONT_USE_THREAD
+#include <thread> //std::thread
+#include <vector> //std::vector
+#endif
+
+namespace FoxMath
+{
+    /**
+     * @brief Default minimum number of elements given to one thread by parallelFor. Under this size, the cost to start a thread is greater than the work.
+     */
+    inline constexpr size_t defaultParallelGrain = 1 << 14;
+
+    /**
+     * @brief Split [0, count) in contiguous ranges and call functor(begin, end) on each range from different threads.
+     * The calling thread process the last range and the function return when all ranges are processed.
+     * If count is smaller than 2 * grain, functor(0, count) is called on the calling thread.
+     * @note functor must not throw and ranges must be independent. If a thread cannot be created, its range is processed on the calling thread.
+     * 
+     * @tparam TFunctor : void(size_t begin, size_t end)
+     * @param count 
+     * @param grain : minimum number of elements by thread
+     * @param functor 
+     */
+    template <typename TFunctor>
+    inline
+    void parallelFor (size_t count, size_t grain, TFunctor&& functor) noexcept
+    {
+#ifndef DONT_USE_THREAD
+        const size_t maxThreadCount = count / std::max<size_t>(grain, 1);
+
+        /*hardware_concurrency is a system call : small loops must not pay it*/
+        static const size_t hardwareThreadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        const size_t threadCount = (maxThreadCount > 1) ? std::min(hardwareThreadCount, maxThreadCount) : 1;
+
+        if (threadCount > 1)
+        {
+            const size_t chunkSize = count / threadCount;
+            const size_t remainder = count % threadCount;
+
+            std::vector<std::thread> workers;
+            size_t begin = 0;
+
+            for (size_t i = 0; i < threadCount - 1; i++)
+            {
+                const size_t end = begin + chunkSize + (i < remainder);
+
+                try
+                {
+                    workers.emplace_back([&functor, begin, end]() { functor(begin, end); });
+                }
+                catch (...)
+                {
+                    functor(begin, end);
+                }
+
+                begin = end;
+            }
+
+            functor(begin, count);
+
+            for (std::thread& worker : workers)
+                worker.join();
+
+            return;
+        }
+#else
+        (void)grain;
+#endif
+        functor(static_cast<size_t>(0), count);
+    }
+
+} /*namespace FoxMath*/
@@ -0,0 +1,308 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <algorithm> //std::min, std::max
+
+/*Define DONT_USE_THREAD to force every parallel loop to run on the calling thread*/
+#ifndef DONT_USE_THREAD
+#include <thread> //std::thread
+#include <vector> //std::vector
+#include <mutex> //std::mutex, std::unique_lock
+#include <condition_variable> //std::condition_variable
+#include <atomic> //std::atomic
+#include <type_traits> //std::remove_reference_t
+#endif
+
+namespace FoxMath
+{
+    /**
+     * @brief Persistent workers that process the ranges of parallelFor. Unlike the free function parallelFor, threads are created once
+     * so loops called many times per frame (like one loop by hierarchy level) do not pay the thread creation.
+     * @note parallelFor calls from different threads are serialized. A parallelFor called from inside a functor given to a pool runs inline on the calling thread,
+     * so nested loops are allowed but do not spread over the workers.
+     * 
+     */
+    class ThreadPool
+    {
+        private:
+
+        protected:
+
+        #pragma region attribut
+
+#ifndef DONT_USE_THREAD
+        std::vector<std::thread>    m_workers;
+
+        std::mutex                  m_submitMutex;
+        std::mutex                  m_mutex;
+        std::condition_variable     m_wakeCondition;
+        std::condition_variable     m_doneCondition;
+
+        /*Current job. Written under m_mutex before m_jobId is incremented*/
+        void                        (*m_invoke)(void* functor, size_t begin, size_t end) = nullptr;
+        void*                       m_functor           = nullptr;
+        size_t                      m_count             = 0;
+        size_t                      m_chunkCount        = 0;
+        size_t                      m_jobId             = 0;
+        size_t                      m_activeWorkerCount = 0;
+        bool                        m_isStopping        = false;
+
+        std::atomic<size_t>         m_nextChunk {0};
+#endif
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+#ifndef DONT_USE_THREAD
+        /**
+         * @brief True while the thread processes a chunk. A loop submitted from a chunk runs on the calling thread : waiting the pool from one of its workers would dead lock
+         * 
+         * @return bool& 
+         */
+        [[nodiscard]] static inline
+        bool& isInsideChunk () noexcept
+        {
+            thread_local bool insideChunk = false;
+            return insideChunk;
+        }
+
+        /**
+         * @brief Process chunks of the current job until all of them are taken
+         * 
+         */
+        inline
+        void runChunks (void (*invoke)(void*, size_t, size_t), void* functor, size_t count, size_t chunkCount) noexcept
+        {
+            const size_t chunkSize = count / chunkCount;
+            const size_t remainder = count % chunkCount;
+
+            isInsideChunk() = true;
+
+            for (size_t chunk = m_nextChunk.fetch_add(1, std::memory_order_relaxed); chunk < chunkCount; chunk = m_nextChunk.fetch_add(1, std::memory_order_relaxed))
+            {
+                const size_t begin = chunk * chunkSize + std::min(chunk, remainder);
+                invoke(functor, begin, begin + chunkSize + (chunk < remainder));
+            }
+
+            isInsideChunk() = false;
+        }
+
+        inline
+        void workerLoop () noexcept
+        {
+            size_t seenJobId = 0;
+
+            for (;;)
+            {
+                void (*invoke)(void*, size_t, size_t);
+                void* functor;
+                size_t count, chunkCount;
+
+                {
+                    std::unique_lock<std::mutex> lock (m_mutex);
+                    m_wakeCondition.wait(lock, [&]{ return m_isStopping || m_jobId != seenJobId; });
+
+                    if (m_isStopping)
+                        return;
+
+                    seenJobId   = m_jobId;
+                    invoke      = m_invoke;
+                    functor     = m_functor;
+                    count       = m_count;
+                    chunkCount  = m_chunkCount;
+                    m_activeWorkerCount++;
+                }
+
+                runChunks(invoke, functor, count, chunkCount);
+
+                {
+                    std::unique_lock<std::mutex> lock (m_mutex);
+                    m_activeWorkerCount--;
+                }
+
+                m_doneCondition.notify_all();
+            }
+        }
+#endif
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Create threadCount - 1 workers, the thread that call parallelFor is the last one. If a worker cannot be created, the pool use less threads.
+         * 
+         * @param threadCount : number of threads that process a loop including the calling thread. Default is the hardware concurrency
+         */
+        explicit inline
+        ThreadPool (size_t threadCount = 0) noexcept
+        {
+#ifndef DONT_USE_THREAD
+            if (threadCount == 0)
+                threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+            try
+            {
+                m_workers.reserve(threadCount - 1);
+
+                for (size_t i = 1; i < threadCount; i++)
+                    m_workers.emplace_back([this]() { workerLoop(); });
+            }
+            catch (...)
+            {}
+#else
+            (void)threadCount;
+#endif
+        }
+
+        ThreadPool (const ThreadPool& other)                = delete;
+
+        ThreadPool (ThreadPool&& other)                     = delete;
+
+        inline
+        ~ThreadPool () noexcept
+        {
+#ifndef DONT_USE_THREAD
+            {
+                std::unique_lock<std::mutex> lock (m_mutex);
+                m_isStopping = true;
+            }
+
+            m_wakeCondition.notify_all();
+
+            for (std::thread& worker : m_workers)
+                worker.join();
+#endif
+        }
+
+        ThreadPool& operator=(ThreadPool const& other)      = delete;
+
+        ThreadPool& operator=(ThreadPool && other)          = delete;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Same contract as the free function parallelFor but ranges are processed by the workers of the pool and the calling thread.
+         * 
+         * @tparam TFunctor : void(size_t begin, size_t end)
+         * @param count 
+         * @param grain : minimum number of elements by range
+         * @param functor 
+         */
+        template <typename TFunctor>
+        inline
+        void parallelFor (size_t count, size_t grain, TFunctor&& functor) noexcept
+        {
+#ifndef DONT_USE_THREAD
+            const size_t chunkCount = std::min(getThreadCount(), count / std::max<size_t>(grain, 1));
+
+            if (chunkCount > 1 && !isInsideChunk())
+            {
+                using Functor = std::remove_reference_t<TFunctor>;
+
+                void (*invoke)(void*, size_t, size_t) = [](void* functorPtr, size_t begin, size_t end)
+                {
+                    (*static_cast<Functor*>(functorPtr))(begin, end);
+                };
+
+                void* functorPtr = const_cast<void*>(static_cast<const void*>(&functor));
+
+                std::unique_lock<std::mutex> submitLock (m_submitMutex);
+
+                {
+                    /*A late worker of the previous job can still read the chunk counter*/
+                    std::unique_lock<std::mutex> lock (m_mutex);
+                    m_doneCondition.wait(lock, [&]{ return m_activeWorkerCount == 0; });
+
+                    m_invoke        = invoke;
+                    m_functor       = functorPtr;
+                    m_count         = count;
+                    m_chunkCount    = chunkCount;
+                    m_nextChunk.store(0, std::memory_order_relaxed);
+                    m_jobId++;
+                }
+
+                m_wakeCondition.notify_all();
+
+                runChunks(invoke, functorPtr, count, chunkCount);
+
+                /*Every chunk is taken, wait the workers that still process one*/
+                std::unique_lock<std::mutex> lock (m_mutex);
+                m_doneCondition.wait(lock, [&]{ return m_activeWorkerCount == 0; });
+                return;
+            }
+#else
+            (void)grain;
+#endif
+            functor(static_cast<size_t>(0), count);
+        }
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        /**
+         * @brief Number of threads that process a loop including the calling thread
+         * 
+         * @return size_t 
+         */
+        [[nodiscard]] inline
+        size_t getThreadCount () const noexcept
+        {
+#ifndef DONT_USE_THREAD
+            return m_workers.size() + 1;
+#else
+            return 1;
+#endif
+        }
+
+        #pragma endregion //!accessor
+    };
+
+    /**
+     * @brief Pool shared by the kernels that split their work automatically (Gemm...). Created with one thread by core at first use
+     * 
+     * @return ThreadPool& 
+     */
+    [[nodiscard]] inline
+    ThreadPool& getGlobalThreadPool () noexcept
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+} /*namespace FoxMath*/
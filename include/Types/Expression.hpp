@@ -0,0 +1,510 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Matrix/GenericMatrix.hpp" //GenericMatrix, GenericVector, EMatrixConvention
+
+#include <stddef.h> //sizt_t
+#include <type_traits> //std::common_type_t, std::enable_if_t, std::is_arithmetic_v
+
+/**
+ * @brief Opt-in lazy layer over GenericVector and GenericMatrix element-wise arithmetic.
+ * Operators on expression nodes build a tree instead of computing intermediate objects. The whole tree is evaluated in a single loop
+ * when it is assigned, so `lazy(rst) = lazy(a) * s + lazy(b) * t - c` doesn't materialize any temporary.
+ * 
+ * @note Leaves keep a reference on their operand : an expression must be evaluated before its operands are destroyed (store it with auto only if operands outlive it).
+ * @note Evaluation reads the index i of each operand before writing the index i of the destination, so the destination can appear in the expression.
+ * @example 
+ * `using namespace FoxMath::Expression;`
+ * `lazy(position) = lazy(position) + lazy(velocity) * deltaTime;`
+ * `GenericVector<16, float> rst = evaluate(lazy(a) * 2.f - b / lazy(c));`
+ */
+namespace FoxMath::Expression
+{
+    #pragma region shape
+
+    template <size_t TLength>
+    struct VectorShape;
+
+    template <size_t TRowSize, size_t TColumnSize, EMatrixConvention TMatrixConvention>
+    struct MatrixShape;
+
+    /*Shape and value type are deduced from the base class so Vector3, SquareMatrix, Matrix4... are also accepted*/
+    template <size_t TLength, typename TType>
+    VectorShape<TLength> shapeOf (const GenericVector<TLength, TType>*);
+
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    MatrixShape<TRowSize, TColumnSize, TMatrixConvention> shapeOf (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>*);
+
+    template <size_t TLength, typename TType>
+    TType valueOf (const GenericVector<TLength, TType>*);
+
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    TType valueOf (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>*);
+
+    /**
+     * @brief Shape of the expression of GenericVector. Define the type of the evaluated object and how to access to the element index
+     * 
+     * @tparam TLength 
+     */
+    template <size_t TLength>
+    struct VectorShape
+    {
+        template <typename TType>
+        using Result = GenericVector<TLength, TType>;
+
+        static constexpr size_t size = TLength;
+
+        template <typename TContainer>
+        [[nodiscard]] static inline constexpr
+        auto read (const TContainer& container, size_t index) noexcept
+        {
+            return container[index];
+        }
+
+        template <typename TContainer, typename TType>
+        static inline constexpr
+        void write (TContainer& container, size_t index, TType value) noexcept
+        {
+            container.setData(index, value);
+        }
+    };
+
+    /**
+     * @brief Shape of the expression of GenericMatrix. Elements are accessed in storage order so both operands must share the same convention
+     * 
+     * @tparam TRowSize 
+     * @tparam TColumnSize 
+     * @tparam TMatrixConvention 
+     */
+    template <size_t TRowSize, size_t TColumnSize, EMatrixConvention TMatrixConvention>
+    struct MatrixShape
+    {
+        template <typename TType>
+        using Result = GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>;
+
+        static constexpr size_t size = TRowSize * TColumnSize;
+
+        template <typename TContainer>
+        [[nodiscard]] static inline constexpr
+        auto read (const TContainer& container, size_t index) noexcept
+        {
+            return container.getData(index);
+        }
+
+        template <typename TContainer, typename TType>
+        static inline constexpr
+        void write (TContainer& container, size_t index, TType value) noexcept
+        {
+            container.getData(index) = static_cast<decltype(valueOf(&container))>(value);
+        }
+    };
+
+    template <typename TContainer, typename = void>
+    struct IsContainer : std::false_type {};
+
+    template <typename TContainer>
+    struct IsContainer<TContainer, std::void_t<decltype(shapeOf(static_cast<const TContainer*>(nullptr)))>> : std::true_type {};
+
+    #pragma endregion //!shape
+
+    #pragma region node
+
+    /**
+     * @brief Base of all nodes. Only used to detect expression
+     */
+    struct Node {};
+
+    template <typename T>
+    inline constexpr bool isExpression = std::is_base_of_v<Node, T>;
+
+    /**
+     * @brief Leaf of the tree that reference a GenericVector or a GenericMatrix.
+     * If TContainer is not const, the leaf can be used as destination of an expression
+     * 
+     * @tparam TContainer 
+     */
+    template <typename TContainer>
+    class Leaf : public Node
+    {
+        protected:
+
+        TContainer& m_container;
+
+        public:
+
+        using Shape = decltype(shapeOf(static_cast<const TContainer*>(nullptr)));
+        using Value = decltype(valueOf(static_cast<const TContainer*>(nullptr)));
+
+        explicit inline constexpr
+        Leaf (TContainer& container) noexcept
+            : m_container {container}
+        {}
+
+        inline constexpr
+        Leaf (const Leaf& other) noexcept = default;
+
+        [[nodiscard]] inline constexpr
+        Value operator[] (size_t index) const noexcept
+        {
+            return Shape::read(m_container, index);
+        }
+
+        /**
+         * @brief Evaluate the other leaf in the referenced container (copy of leaf is not a rebind of the reference)
+         * 
+         * @param other 
+         * @return constexpr TContainer& 
+         */
+        inline constexpr
+        TContainer& operator= (const Leaf& other) noexcept
+        {
+            return operator=<Leaf>(other);
+        }
+
+        /**
+         * @brief Evaluate the expression in a single loop and store the result in the referenced container
+         * 
+         * @tparam TExpression 
+         * @param expression 
+         * @return constexpr TContainer& 
+         */
+        template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool> = true>
+        inline constexpr
+        TContainer& operator= (const TExpression& expression) noexcept;
+
+        template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool> = true>
+        inline constexpr
+        TContainer& operator+= (const TExpression& expression) noexcept;
+
+        template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool> = true>
+        inline constexpr
+        TContainer& operator-= (const TExpression& expression) noexcept;
+
+        template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool> = true>
+        inline constexpr
+        TContainer& operator*= (const TExpression& expression) noexcept;
+
+        template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool> = true>
+        inline constexpr
+        TContainer& operator/= (const TExpression& expression) noexcept;
+    };
+
+    /**
+     * @brief Scalar broadcasted to all the elements. Scalar doesn't promote the value type of the expression : it is converted like with the eager operators
+     * 
+     * @tparam TType 
+     */
+    template <typename TType>
+    class Scalar : public Node
+    {
+        protected:
+
+        TType m_scalar;
+
+        public:
+
+        using Shape = void;
+        using Value = TType;
+
+        explicit inline constexpr
+        Scalar (TType scalar) noexcept
+            : m_scalar {scalar}
+        {}
+
+        [[nodiscard]] inline constexpr
+        Value operator[] (size_t) const noexcept
+        {
+            return m_scalar;
+        }
+    };
+
+    /*Shape of the binary node is the shape of the operand that is not a scalar. Both operands must have the same shape*/
+    template <typename TLhsShape, typename TRhsShape>
+    struct CommonShape
+    {
+        static_assert(std::is_same_v<TLhsShape, TRhsShape>, "Expression operands must have the same length (and the same convention for matrix)");
+        using Type = TLhsShape;
+    };
+
+    template <typename TRhsShape>
+    struct CommonShape<void, TRhsShape> { using Type = TRhsShape; };
+
+    template <typename TLhsShape>
+    struct CommonShape<TLhsShape, void> { using Type = TLhsShape; };
+
+    /*Mixed type operands are promoted like built-in arithmetic. Scalar is converted to the type of the other operand*/
+    template <typename TLhs, typename TRhs>
+    using CommonValue = std::conditional_t<std::is_void_v<typename TLhs::Shape>, typename TRhs::Value,
+                        std::conditional_t<std::is_void_v<typename TRhs::Shape>, typename TLhs::Value,
+                        std::common_type_t<typename TLhs::Value, typename TRhs::Value>>>;
+
+    /**
+     * @brief Element-wise binary operation. Operands are stored by value (leaves are references)
+     * 
+     * @tparam TOperator : Add, Sub, Mul or Div
+     * @tparam TLhs 
+     * @tparam TRhs 
+     */
+    template <typename TOperator, typename TLhs, typename TRhs>
+    class Binary : public Node
+    {
+        protected:
+
+        TLhs m_lhs;
+        TRhs m_rhs;
+
+        public:
+
+        using Shape = typename CommonShape<typename TLhs::Shape, typename TRhs::Shape>::Type;
+        using Value = CommonValue<TLhs, TRhs>;
+
+        inline constexpr
+        Binary (const TLhs& lhs, const TRhs& rhs) noexcept
+            : m_lhs {lhs}, m_rhs {rhs}
+        {}
+
+        [[nodiscard]] inline constexpr
+        Value operator[] (size_t index) const noexcept
+        {
+            return TOperator::apply(static_cast<Value>(m_lhs[index]), static_cast<Value>(m_rhs[index]));
+        }
+    };
+
+    /**
+     * @brief Element-wise unary operation
+     * 
+     * @tparam TOperator : Negate
+     * @tparam TOperand 
+     */
+    template <typename TOperator, typename TOperand>
+    class Unary : public Node
+    {
+        protected:
+
+        TOperand m_operand;
+
+        public:
+
+        using Shape = typename TOperand::Shape;
+        using Value = typename TOperand::Value;
+
+        explicit inline constexpr
+        Unary (const TOperand& operand) noexcept
+            : m_operand {operand}
+        {}
+
+        [[nodiscard]] inline constexpr
+        Value operator[] (size_t index) const noexcept
+        {
+            return TOperator::apply(m_operand[index]);
+        }
+    };
+
+    struct Add      { template <typename T> [[nodiscard]] static inline constexpr T apply (T lhs, T rhs) noexcept { return lhs + rhs; } };
+    struct Sub      { template <typename T> [[nodiscard]] static inline constexpr T apply (T lhs, T rhs) noexcept { return lhs - rhs; } };
+    struct Mul      { template <typename T> [[nodiscard]] static inline constexpr T apply (T lhs, T rhs) noexcept { return lhs * rhs; } };
+    struct Div      { template <typename T> [[nodiscard]] static inline constexpr T apply (T lhs, T rhs) noexcept { return lhs / rhs; } };
+    struct Negate   { template <typename T> [[nodiscard]] static inline constexpr T apply (T operand) noexcept { return -operand; } };
+
+    #pragma endregion //!node
+
+    #pragma region function
+
+    /**
+     * @brief Entry point of the layer. Wrap a GenericVector or a GenericMatrix (or a child class) in a leaf
+     * 
+     * @tparam TContainer 
+     * @param container 
+     * @return constexpr Leaf<TContainer> 
+     */
+    template <typename TContainer, std::enable_if_t<IsContainer<TContainer>::value, bool> = true>
+    [[nodiscard]] inline constexpr
+    Leaf<TContainer> lazy (TContainer& container) noexcept
+    {
+        return Leaf<TContainer>(container);
+    }
+
+    template <typename TContainer, std::enable_if_t<IsContainer<TContainer>::value, bool> = true>
+    [[nodiscard]] inline constexpr
+    Leaf<const TContainer> lazy (const TContainer& container) noexcept
+    {
+        return Leaf<const TContainer>(container);
+    }
+
+    /**
+     * @brief Convert operand of operator to node : expression is kept, container is wrapped in leaf and arithmetic is broadcasted
+     */
+    template <typename T>
+    [[nodiscard]] inline constexpr
+    auto toNode (const T& operand) noexcept
+    {
+        if constexpr (isExpression<T>)
+            return operand;
+        else if constexpr (std::is_arithmetic_v<T>)
+            return Scalar<T>(operand);
+        else
+            return Leaf<const T>(operand);
+    }
+
+    template <typename T>
+    inline constexpr bool isOperand = isExpression<T> || std::is_arithmetic_v<T> || IsContainer<T>::value;
+
+    /*At least one operand must be an expression. Else the eager operators of GenericVector and GenericMatrix are used*/
+    template <typename TLhs, typename TRhs>
+    using IsExpressionOperation = std::enable_if_t<(isExpression<TLhs> || isExpression<TRhs>) && isOperand<TLhs> && isOperand<TRhs>, bool>;
+
+    template <typename TOperator, typename TLhs, typename TRhs>
+    using BinaryOf = Binary<TOperator, decltype(toNode(std::declval<TLhs>())), decltype(toNode(std::declval<TRhs>()))>;
+
+    /**
+     * @brief Evaluate the expression in a new object. Result is a GenericVector or a GenericMatrix with the value type of the expression
+     * 
+     * @tparam TExpression 
+     * @param expression 
+     * @return constexpr auto 
+     */
+    template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool> = true>
+    [[nodiscard]] inline constexpr
+    auto evaluate (const TExpression& expression) noexcept
+    {
+        using Shape = typename TExpression::Shape;
+        static_assert(!std::is_void_v<Shape>, "Expression must contain at least one vector or matrix");
+
+        typename Shape::template Result<typename TExpression::Value> rst {};
+
+        for (size_t i = 0; i < Shape::size; i++)
+        {
+            Shape::write(rst, i, expression[i]);
+        }
+
+        return rst;
+    }
+
+    #pragma endregion //!function
+
+    #pragma region operator
+
+    template <typename TOperand, std::enable_if_t<isExpression<TOperand>, bool> = true>
+    [[nodiscard]] inline constexpr
+    TOperand operator+ (const TOperand& operand) noexcept
+    {
+        return operand;
+    }
+
+    template <typename TOperand, std::enable_if_t<isExpression<TOperand>, bool> = true>
+    [[nodiscard]] inline constexpr
+    Unary<Negate, TOperand> operator- (const TOperand& operand) noexcept
+    {
+        return Unary<Negate, TOperand>(operand);
+    }
+
+    template <typename TLhs, typename TRhs, IsExpressionOperation<TLhs, TRhs> = true>
+    [[nodiscard]] inline constexpr
+    BinaryOf<Add, TLhs, TRhs> operator+ (const TLhs& lhs, const TRhs& rhs) noexcept
+    {
+        return BinaryOf<Add, TLhs, TRhs>(toNode(lhs), toNode(rhs));
+    }
+
+    template <typename TLhs, typename TRhs, IsExpressionOperation<TLhs, TRhs> = true>
+    [[nodiscard]] inline constexpr
+    BinaryOf<Sub, TLhs, TRhs> operator- (const TLhs& lhs, const TRhs& rhs) noexcept
+    {
+        return BinaryOf<Sub, TLhs, TRhs>(toNode(lhs), toNode(rhs));
+    }
+
+    template <typename TLhs, typename TRhs, IsExpressionOperation<TLhs, TRhs> = true>
+    [[nodiscard]] inline constexpr
+    BinaryOf<Mul, TLhs, TRhs> operator* (const TLhs& lhs, const TRhs& rhs) noexcept
+    {
+        return BinaryOf<Mul, TLhs, TRhs>(toNode(lhs), toNode(rhs));
+    }
+
+    template <typename TLhs, typename TRhs, IsExpressionOperation<TLhs, TRhs> = true>
+    [[nodiscard]] inline constexpr
+    BinaryOf<Div, TLhs, TRhs> operator/ (const TLhs& lhs, const TRhs& rhs) noexcept
+    {
+        return BinaryOf<Div, TLhs, TRhs>(toNode(lhs), toNode(rhs));
+    }
+
+    #pragma endregion //!operator
+
+    #pragma region leaf assignment
+
+    template <typename TContainer>
+    template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool>>
+    inline constexpr
+    TContainer& Leaf<TContainer>::operator= (const TExpression& expression) noexcept
+    {
+        static_assert(std::is_same_v<Shape, typename TExpression::Shape> || std::is_void_v<typename TExpression::Shape>, "Expression must have the same length (and the same convention for matrix) as the destination");
+
+        for (size_t i = 0; i < Shape::size; i++)
+        {
+            Shape::write(m_container, i, expression[i]);
+        }
+
+        return m_container;
+    }
+
+    template <typename TContainer>
+    template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool>>
+    inline constexpr
+    TContainer& Leaf<TContainer>::operator+= (const TExpression& expression) noexcept
+    {
+        return *this = *this + expression;
+    }
+
+    template <typename TContainer>
+    template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool>>
+    inline constexpr
+    TContainer& Leaf<TContainer>::operator-= (const TExpression& expression) noexcept
+    {
+        return *this = *this - expression;
+    }
+
+    template <typename TContainer>
+    template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool>>
+    inline constexpr
+    TContainer& Leaf<TContainer>::operator*= (const TExpression& expression) noexcept
+    {
+        return *this = *this * expression;
+    }
+
+    template <typename TContainer>
+    template <typename TExpression, std::enable_if_t<isExpression<TExpression>, bool>>
+    inline constexpr
+    TContainer& Leaf<TContainer>::operator/= (const TExpression& expression) noexcept
+    {
+        return *this = *this / expression;
+    }
+
+    #pragma endregion //!leaf assignment
+
+} /*namespace FoxMath::Expression*/
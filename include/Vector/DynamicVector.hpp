@@ -0,0 +1,450 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Vector/DynamicVectorView.hpp" //DynamicVectorView
+#include "Vector/GenericVector.hpp" //GenericVector
+#include "Memory/AlignedAllocator.hpp" //AlignedAllocator
+#include "Memory/ArenaAllocator.hpp" //ArenaAllocator
+#include "Numeric/EPrecision.hpp" //EPrecision
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>
+#include "Types/Implicit.hpp" //implicit
+
+#include <vector> //std::vector
+#include <initializer_list> //std::initializer_list
+#include <stddef.h> //sizt_t
+#include <iostream> //ostream
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <typename TType = float, typename TAllocator = AlignedAllocator<TType>,
+                IsArithmetic<TType> = true>
+    class DynamicVector;
+
+    /**
+     * @brief Vector with runtime size stored on the heap. Used for solver and regression workloads where the dimension is unknown at compile time.
+     * Storage is aligned by the allocator (64 bytes by default). Use ArenaAllocator for per frame scratch vectors.
+     * In place operations are implemented by DynamicVectorView so GenericVector and DynamicVector can be mixed without copy.
+     * @note Size mismatch between operands is checked with assert
+     * @example `FoxMath::DynamicVector<float> residual (rowCount); residual = b - A * x;`
+     * 
+     * @tparam TType 
+     * @tparam TAllocator 
+     */
+    template <typename TType, typename TAllocator>
+    class DynamicVector<TType, TAllocator>
+    {
+        public:
+
+        using View      = DynamicVectorView<TType>;
+        using ConstView = DynamicVectorView<const TType>;
+
+        protected:
+
+        #pragma region attribut
+
+        std::vector<TType, TAllocator> m_data;
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region constructor/destructor
+
+        inline
+        DynamicVector ()                                                = default;
+
+        inline
+        DynamicVector (const DynamicVector& other)                      = default;
+
+        inline
+        DynamicVector (DynamicVector&& other) noexcept                  = default;
+
+        inline
+        ~DynamicVector ()                                               = default;
+
+        inline
+        DynamicVector& operator=(const DynamicVector& other)            = default;
+
+        inline
+        DynamicVector& operator=(DynamicVector&& other) noexcept        = default;
+
+        /**
+         * @brief Construct vector of size elements init to zero
+         * 
+         * @param size 
+         * @param allocator 
+         */
+        explicit inline
+        DynamicVector (size_t size, const TAllocator& allocator = TAllocator());
+
+        /**
+         * @brief Construct vector of size elements init to scalar
+         * 
+         * @param size 
+         * @param scalar 
+         * @param allocator 
+         */
+        inline
+        DynamicVector (size_t size, TType scalar, const TAllocator& allocator = TAllocator());
+
+        /**
+         * @brief Aggregate initialization
+         * @example `FoxMath::DynamicVector<float> vec {1.f, 2.f, 3.f}`
+         * 
+         * @param values 
+         * @param allocator 
+         */
+        inline
+        DynamicVector (std::initializer_list<TType> values, const TAllocator& allocator = TAllocator());
+
+        /**
+         * @brief Copy viewed data (GenericVector, DynamicVectorView...)
+         * 
+         * @param other 
+         * @param allocator 
+         */
+        explicit inline
+        DynamicVector (ConstView other, const TAllocator& allocator = TAllocator());
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Resize the vector. New elements are init to zero
+         * 
+         * @param size 
+         * @return DynamicVector& 
+         */
+        inline
+        DynamicVector& resize (size_t size);
+
+        inline
+        DynamicVector& fill (TType scalar) noexcept;
+
+        [[nodiscard]] inline
+        TType squareLength () const noexcept;
+
+        template <EPrecision TPrecision = EPrecision::Precise>
+        [[nodiscard]] inline
+        TType length () const noexcept;
+
+        template <EPrecision TPrecision = EPrecision::Precise>
+        inline
+        DynamicVector& normalize () noexcept;
+
+        template <EPrecision TPrecision = EPrecision::Precise>
+        [[nodiscard]] inline
+        DynamicVector getNormalized () const;
+
+        inline
+        DynamicVector& clampLength (TType maxLength) noexcept;
+
+        [[nodiscard]] inline
+        DynamicVector getClampedLength (TType maxLength) const;
+
+        inline
+        DynamicVector& setLength (TType newLength) noexcept;
+
+        [[nodiscard]] inline
+        TType dot (ConstView other) const noexcept;
+
+        inline
+        DynamicVector& lerp (ConstView other, TType t) noexcept;
+
+        [[nodiscard]] inline
+        DynamicVector getLerp (ConstView other, TType t) const;
+
+        inline
+        DynamicVector& reflect (ConstView normalNormalized) noexcept;
+
+        [[nodiscard]] inline
+        DynamicVector getReflection (ConstView normalNormalized) const;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        size_t getSize () const noexcept
+        {
+            return m_data.size();
+        }
+
+        [[nodiscard]] inline
+        TType* getData () noexcept
+        {
+            return m_data.data();
+        }
+
+        [[nodiscard]] inline
+        const TType* getData () const noexcept
+        {
+            return m_data.data();
+        }
+
+        [[nodiscard]] inline
+        TAllocator getAllocator () const noexcept
+        {
+            return m_data.get_allocator();
+        }
+
+        [[nodiscard]] inline
+        View getView () noexcept
+        {
+            return View(m_data.data(), m_data.size());
+        }
+
+        [[nodiscard]] inline
+        ConstView getView () const noexcept
+        {
+            return ConstView(m_data.data(), m_data.size());
+        }
+
+        /**
+         * @brief Returns a const reference to the data at index. Bound-checked, throw out_of_range exception
+         * 
+         * @param index 
+         * @return const TType& 
+         */
+        [[nodiscard]] inline
+        const TType& at (size_t index) const;
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        template<typename TscalarType, IsArithmetic<TscalarType> = true>
+        inline
+        DynamicVector& setData (size_t index, TscalarType scalar) noexcept;
+
+        #pragma endregion //!mutator
+
+        #pragma region operator
+        #pragma region member access operators
+
+        [[nodiscard]] inline
+        TType& operator[] (size_t index) noexcept
+        {
+            assert(index < m_data.size());
+            return m_data[index];
+        }
+
+        [[nodiscard]] inline
+        const TType& operator[] (size_t index) const noexcept
+        {
+            assert(index < m_data.size());
+            return m_data[index];
+        }
+
+        #pragma endregion //!member access operators
+        #pragma region convertor
+
+        implicit inline
+        operator View () noexcept
+        {
+            return getView();
+        }
+
+        implicit inline
+        operator ConstView () const noexcept
+        {
+            return getView();
+        }
+
+        #pragma endregion //!convertor
+        #pragma region assignment operators
+
+        /**
+         * @brief Copy viewed data. Vector is resized to the size of other
+         * 
+         * @param other 
+         * @return DynamicVector& 
+         */
+        inline
+        DynamicVector& operator=(ConstView other);
+
+        inline
+        DynamicVector& operator+=(TType scalar) noexcept;
+
+        inline
+        DynamicVector& operator+=(ConstView other) noexcept;
+
+        inline
+        DynamicVector& operator-=(TType scalar) noexcept;
+
+        inline
+        DynamicVector& operator-=(ConstView other) noexcept;
+
+        inline
+        DynamicVector& operator*=(TType scalar) noexcept;
+
+        inline
+        DynamicVector& operator*=(ConstView other) noexcept;
+
+        inline
+        DynamicVector& operator/=(TType scalar) noexcept;
+
+        inline
+        DynamicVector& operator/=(ConstView other) noexcept;
+
+        #pragma endregion //!assignment operators
+        #pragma region arithmetic operators
+
+        /*Hidden friends : operands are converted to view (GenericVector, DynamicVector...) so they are not template*/
+
+        [[nodiscard]] friend inline
+        DynamicVector operator+(DynamicVector vec) noexcept
+        {
+            return vec;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator-(DynamicVector vec) noexcept
+        {
+            return vec *= static_cast<TType>(-1);
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator+(DynamicVector vec, TType scalar) noexcept
+        {
+            return vec += scalar;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator+(TType scalar, DynamicVector vec) noexcept
+        {
+            return vec += scalar;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator+(DynamicVector lhs, ConstView rhs) noexcept
+        {
+            return lhs += rhs;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator-(DynamicVector vec, TType scalar) noexcept
+        {
+            return vec -= scalar;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator-(TType scalar, DynamicVector vec) noexcept
+        {
+            for (TType& data : vec.m_data)
+                data = scalar - data;
+
+            return vec;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator-(DynamicVector lhs, ConstView rhs) noexcept
+        {
+            return lhs -= rhs;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator*(DynamicVector vec, TType scalar) noexcept
+        {
+            return vec *= scalar;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator*(TType scalar, DynamicVector vec) noexcept
+        {
+            return vec *= scalar;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator*(DynamicVector lhs, ConstView rhs) noexcept
+        {
+            return lhs *= rhs;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator/(DynamicVector vec, TType scalar) noexcept
+        {
+            return vec /= scalar;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator/(TType scalar, DynamicVector vec) noexcept
+        {
+            for (TType& data : vec.m_data)
+                data = scalar / data;
+
+            return vec;
+        }
+
+        [[nodiscard]] friend inline
+        DynamicVector operator/(DynamicVector lhs, ConstView rhs) noexcept
+        {
+            return lhs /= rhs;
+        }
+
+        #pragma endregion //!arithmetic operators
+        #pragma region comparison operators
+
+        [[nodiscard]] friend inline
+        bool operator==(const DynamicVector& lhs, ConstView rhs) noexcept
+        {
+            return lhs.getView() == rhs;
+        }
+
+        [[nodiscard]] friend inline
+        bool operator!=(const DynamicVector& lhs, ConstView rhs) noexcept
+        {
+            return lhs.getView() != rhs;
+        }
+
+        #pragma endregion //!comparison operators
+        #pragma endregion //!operator
+    };
+
+    /**
+     * @brief output stream
+     * 
+     */
+    template <typename TType, typename TAllocator>
+    inline
+    std::ostream& 	operator<<		(std::ostream& out, const DynamicVector<TType, TAllocator>& vec) noexcept
+    {
+        return out << vec.getView();
+    }
+
+    #include "DynamicVector.inl"
+
+    template <typename TType = float>
+    using DynamicVectorArena = DynamicVector<TType, ArenaAllocator<TType>>;
+
+} /*namespace FoxMath*/
@@ -0,0 +1,255 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>::DynamicVector (size_t size, const TAllocator& allocator)
+    : m_data (size, static_cast<TType>(0), allocator)
+{}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>::DynamicVector (size_t size, TType scalar, const TAllocator& allocator)
+    : m_data (size, scalar, allocator)
+{}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>::DynamicVector (std::initializer_list<TType> values, const TAllocator& allocator)
+    : m_data (values, allocator)
+{}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>::DynamicVector (ConstView other, const TAllocator& allocator)
+    : m_data (other.begin(), other.end(), allocator)
+{}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::resize (size_t size)
+{
+    m_data.resize(size, static_cast<TType>(0));
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::fill (TType scalar) noexcept
+{
+    getView().fill(scalar);
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+TType DynamicVector<TType, TAllocator>::squareLength () const noexcept
+{
+    return getView().squareLength();
+}
+
+template <typename TType, typename TAllocator>
+template <EPrecision TPrecision>
+inline
+TType DynamicVector<TType, TAllocator>::length () const noexcept
+{
+    return getView().template length<TPrecision>();
+}
+
+template <typename TType, typename TAllocator>
+template <EPrecision TPrecision>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::normalize () noexcept
+{
+    getView().template normalize<TPrecision>();
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+template <EPrecision TPrecision>
+inline
+DynamicVector<TType, TAllocator> DynamicVector<TType, TAllocator>::getNormalized () const
+{
+    return DynamicVector(*this).template normalize<TPrecision>();
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::clampLength (TType maxLength) noexcept
+{
+    getView().clampLength(maxLength);
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator> DynamicVector<TType, TAllocator>::getClampedLength (TType maxLength) const
+{
+    return DynamicVector(*this).clampLength(maxLength);
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::setLength (TType newLength) noexcept
+{
+    getView().setLength(newLength);
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+TType DynamicVector<TType, TAllocator>::dot (ConstView other) const noexcept
+{
+    return getView().dot(other);
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::lerp (ConstView other, TType t) noexcept
+{
+    getView().lerp(other, t);
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator> DynamicVector<TType, TAllocator>::getLerp (ConstView other, TType t) const
+{
+    return DynamicVector(*this).lerp(other, t);
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::reflect (ConstView normalNormalized) noexcept
+{
+    getView().reflect(normalNormalized);
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator> DynamicVector<TType, TAllocator>::getReflection (ConstView normalNormalized) const
+{
+    return DynamicVector(*this).reflect(normalNormalized);
+}
+
+template <typename TType, typename TAllocator>
+inline
+const TType& DynamicVector<TType, TAllocator>::at (size_t index) const
+{
+    if (index < m_data.size()) [[likely]]
+        return m_data[index];
+
+    throw std::out_of_range("DynamicVector::at : index out of range");
+}
+
+template <typename TType, typename TAllocator>
+template<typename TscalarType, IsArithmetic<TscalarType>>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::setData (size_t index, TscalarType scalar) noexcept
+{
+    assert(index < m_data.size());
+
+    m_data[index] = static_cast<TType>(scalar);
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::operator=(ConstView other)
+{
+    m_data.assign(other.begin(), other.end());
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::operator+=(TType scalar) noexcept
+{
+    getView() += scalar;
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::operator+=(ConstView other) noexcept
+{
+    getView() += other;
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::operator-=(TType scalar) noexcept
+{
+    getView() -= scalar;
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::operator-=(ConstView other) noexcept
+{
+    getView() -= other;
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::operator*=(TType scalar) noexcept
+{
+    getView() *= scalar;
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::operator*=(ConstView other) noexcept
+{
+    getView() *= other;
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::operator/=(TType scalar) noexcept
+{
+    getView() /= scalar;
+    return *this;
+}
+
+template <typename TType, typename TAllocator>
+inline
+DynamicVector<TType, TAllocator>& DynamicVector<TType, TAllocator>::operator/=(ConstView other) noexcept
+{
+    getView() /= other;
+    return *this;
+}
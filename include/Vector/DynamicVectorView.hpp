@@ -0,0 +1,491 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 02
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Vector/GenericVector.hpp" //GenericVector
+#include "Vector/GenericLengthedVector.hpp" //GenericLengthedVector
+#include "Numeric/SIMD.hpp" //SIMD::Packet
+#include "Numeric/Math.hpp" //Math::sqrt, Math::rsqrt
+#include "Numeric/EPrecision.hpp" //EPrecision
+#include "Numeric/Limits.hpp" //isSame
+
+#include <stddef.h> //sizt_t
+#include <cassert> //assert
+#include <stdexcept> //std::out_of_range
+#include <iostream> //ostream
+#include <type_traits> //std::remove_const_t, std::is_const_v, std::common_type_t
+
+namespace FoxMath
+{
+    /**
+     * @brief Non owning view of contiguous data seen as a vector with runtime size. Used to reinterpret GenericVector or DynamicVector without copy.
+     * All in place operations of DynamicVector are implemented here.
+     * @note The view doesn't extend the lifetime of the viewed data. Constness of the view is the constness of TType (like std::span)
+     * @example `GenericVector<16, float> fixed; DynamicVectorView<float> view (fixed); view *= 2.f;`
+     * 
+     * @tparam TType : element type, const for read only view
+     */
+    template <typename TType>
+    class DynamicVectorView
+    {
+        public:
+
+        using Type = std::remove_const_t<TType>;
+
+        protected:
+
+        #pragma region attribut
+
+        TType*  m_data  {nullptr};
+        size_t  m_size  {0};
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region constructor/destructor
+
+        constexpr inline
+        DynamicVectorView () noexcept                                       = default;
+
+        constexpr inline
+        DynamicVectorView (const DynamicVectorView& other) noexcept         = default;
+
+        constexpr inline
+        DynamicVectorView& operator=(const DynamicVectorView& other) noexcept = default;
+
+        constexpr inline
+        DynamicVectorView (TType* data, size_t size) noexcept
+            : m_data {data}, m_size {size}
+        {}
+
+        /**
+         * @brief View on a fixed size vector
+         * 
+         * @tparam TLength 
+         * @param vec 
+         */
+        template <size_t TLength>
+        constexpr inline
+        DynamicVectorView (GenericVector<TLength, Type>& vec) noexcept
+            : m_data {vec.getData().data()}, m_size {TLength}
+        {}
+
+        /**
+         * @brief View on a lengthed vector. Its cached length is marked dirty by getData() : writes through the view are seen by the next length().
+         * @note Length is only marked dirty when the view is created. Create a new view to write again after a call to length()
+         * 
+         * @tparam TLength 
+         * @param vec 
+         */
+        template <size_t TLength>
+        constexpr inline
+        DynamicVectorView (GenericLengthedVector<TLength, Type>& vec) noexcept
+            : m_data {vec.getData().data()}, m_size {TLength}
+        {}
+
+        /**
+         * @brief Read only view on a fixed size vector
+         * 
+         * @tparam TLength 
+         * @param vec 
+         */
+        template <size_t TLength, typename T = TType, std::enable_if_t<std::is_const_v<T>, bool> = true>
+        constexpr inline
+        DynamicVectorView (const GenericVector<TLength, Type>& vec) noexcept
+            : m_data {vec.getData().data()}, m_size {TLength}
+        {}
+
+        /**
+         * @brief Read only view from a mutable view
+         * 
+         * @param other 
+         */
+        template <typename T = TType, std::enable_if_t<std::is_const_v<T>, bool> = true>
+        constexpr inline
+        DynamicVectorView (const DynamicVectorView<Type>& other) noexcept
+            : m_data {other.getData()}, m_size {other.getSize()}
+        {}
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Fill the viewed data with scalar value
+         * 
+         * @param scalar 
+         * @return const DynamicVectorView& 
+         */
+        inline
+        const DynamicVectorView& fill (Type scalar) const noexcept
+        {
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] = scalar;
+
+            return *this;
+        }
+
+        /**
+         * @brief Dot product. Accumulate in SIMD packets
+         * 
+         * @param other : same size
+         * @return Type 
+         */
+        [[nodiscard]] inline
+        Type dot (DynamicVectorView<const Type> other) const noexcept
+        {
+            assert(m_size == other.getSize());
+
+            using Packet = SIMD::Packet<Type>;
+
+            const Type* otherData = other.getData();
+            typename Packet::Type acc = Packet::set1(static_cast<Type>(0));
+
+            size_t i = 0;
+            for (; i + Packet::size <= m_size; i += Packet::size)
+                acc = Packet::mulAdd(acc, Packet::loadUnaligned(m_data + i), Packet::loadUnaligned(otherData + i));
+
+            alignas(64) Type lanes[Packet::size];
+            Packet::store(lanes, acc);
+
+            Type sum = static_cast<Type>(0);
+            for (size_t iLane = 0; iLane < Packet::size; iLane++)
+                sum += lanes[iLane];
+
+            for (; i < m_size; i++)
+                sum += m_data[i] * otherData[i];
+
+            return sum;
+        }
+
+        [[nodiscard]] inline
+        Type squareLength () const noexcept
+        {
+            return dot(*this);
+        }
+
+        template <EPrecision TPrecision = EPrecision::Precise>
+        [[nodiscard]] inline
+        Type length () const noexcept
+        {
+            return Math::sqrt<TPrecision>(squareLength());
+        }
+
+        /**
+         * @brief Normalize the viewed data. Null vector is unchanged
+         * 
+         * @tparam TPrecision 
+         * @return const DynamicVectorView& 
+         */
+        template <EPrecision TPrecision = EPrecision::Precise>
+        inline
+        const DynamicVectorView& normalize () const noexcept
+        {
+            const Type sqrLength = squareLength();
+
+            if (sqrLength > static_cast<Type>(0)) [[likely]]
+                *this *= Math::rsqrt<TPrecision>(sqrLength);
+
+            return *this;
+        }
+
+        /**
+         * @brief Clamp the length of the vector to maxLength
+         * 
+         * @param maxLength 
+         * @return const DynamicVectorView& 
+         */
+        inline
+        const DynamicVectorView& clampLength (Type maxLength) const noexcept
+        {
+            const Type currentLength = length();
+
+            if (currentLength > maxLength) [[likely]]
+                *this *= maxLength / currentLength;
+
+            return *this;
+        }
+
+        /**
+         * @brief Set the length of the vector. Null vector is unchanged
+         * 
+         * @param newLength 
+         * @return const DynamicVectorView& 
+         */
+        inline
+        const DynamicVectorView& setLength (Type newLength) const noexcept
+        {
+            const Type currentLength = length();
+
+            if (currentLength > static_cast<Type>(0)) [[likely]]
+                *this *= newLength / currentLength;
+
+            return *this;
+        }
+
+        /**
+         * @brief Linear interpolation to other
+         * 
+         * @param other : same size
+         * @param t 
+         * @return const DynamicVectorView& 
+         */
+        inline
+        const DynamicVectorView& lerp (DynamicVectorView<const Type> other, Type t) const noexcept
+        {
+            assert(m_size == other.getSize());
+
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] += (other[i] - m_data[i]) * t;
+
+            return *this;
+        }
+
+        /**
+         * @brief Reflect the vector on the surface define by the normal
+         * 
+         * @param normalNormalized : same size
+         * @return const DynamicVectorView& 
+         */
+        inline
+        const DynamicVectorView& reflect (DynamicVectorView<const Type> normalNormalized) const noexcept
+        {
+            const Type coef = static_cast<Type>(2) * dot(normalNormalized);
+
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] -= normalNormalized[i] * coef;
+
+            return *this;
+        }
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] constexpr inline
+        TType* getData () const noexcept
+        {
+            return m_data;
+        }
+
+        [[nodiscard]] constexpr inline
+        size_t getSize () const noexcept
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] constexpr inline
+        TType* begin () const noexcept
+        {
+            return m_data;
+        }
+
+        [[nodiscard]] constexpr inline
+        TType* end () const noexcept
+        {
+            return m_data + m_size;
+        }
+
+        /**
+         * @brief Returns a reference to the data at index. Bound-checked, throw out_of_range exception
+         * 
+         * @param index 
+         * @return TType& 
+         */
+        [[nodiscard]] inline
+        TType& at (size_t index) const
+        {
+            if (index < m_size) [[likely]]
+                return m_data[index];
+
+            throw std::out_of_range("DynamicVectorView::at : index out of range");
+        }
+
+        #pragma endregion //!accessor
+
+        #pragma region operator
+
+        [[nodiscard]] constexpr inline
+        TType& operator[] (size_t index) const noexcept
+        {
+            assert(index < m_size);
+            return m_data[index];
+        }
+
+        /**
+         * @brief Copy the data of other in the viewed data
+         * 
+         * @param other : same size
+         * @return const DynamicVectorView& 
+         */
+        inline
+        const DynamicVectorView& assign (DynamicVectorView<const Type> other) const noexcept
+        {
+            assert(m_size == other.getSize());
+
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] = other[i];
+
+            return *this;
+        }
+
+        inline
+        const DynamicVectorView& operator+=(Type scalar) const noexcept
+        {
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] += scalar;
+
+            return *this;
+        }
+
+        inline
+        const DynamicVectorView& operator+=(DynamicVectorView<const Type> other) const noexcept
+        {
+            assert(m_size == other.getSize());
+
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] += other[i];
+
+            return *this;
+        }
+
+        inline
+        const DynamicVectorView& operator-=(Type scalar) const noexcept
+        {
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] -= scalar;
+
+            return *this;
+        }
+
+        inline
+        const DynamicVectorView& operator-=(DynamicVectorView<const Type> other) const noexcept
+        {
+            assert(m_size == other.getSize());
+
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] -= other[i];
+
+            return *this;
+        }
+
+        inline
+        const DynamicVectorView& operator*=(Type scalar) const noexcept
+        {
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] *= scalar;
+
+            return *this;
+        }
+
+        inline
+        const DynamicVectorView& operator*=(DynamicVectorView<const Type> other) const noexcept
+        {
+            assert(m_size == other.getSize());
+
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] *= other[i];
+
+            return *this;
+        }
+
+        inline
+        const DynamicVectorView& operator/=(Type scalar) const noexcept
+        {
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] /= scalar;
+
+            return *this;
+        }
+
+        inline
+        const DynamicVectorView& operator/=(DynamicVectorView<const Type> other) const noexcept
+        {
+            assert(m_size == other.getSize());
+
+            for (size_t i = 0; i < m_size; i++)
+                m_data[i] /= other[i];
+
+            return *this;
+        }
+
+        #pragma endregion //!operator
+    };
+
+    /**
+     * @brief Element-wise equality with epsilon comparison
+     * 
+     * @tparam TType 
+     * @tparam TTypeOther 
+     * @param lhs 
+     * @param rhs 
+     * @return true if same size and all elements are equal
+     */
+    template <typename TType, typename TTypeOther>
+    [[nodiscard]] inline
+    bool operator==(DynamicVectorView<TType> lhs, DynamicVectorView<TTypeOther> rhs) noexcept
+    {
+        using Common = std::common_type_t<std::remove_const_t<TType>, std::remove_const_t<TTypeOther>>;
+
+        if (lhs.getSize() != rhs.getSize())
+            return false;
+
+        for (size_t i = 0; i < lhs.getSize(); i++)
+        {
+            if (!isSame<Common>(static_cast<Common>(lhs[i]), static_cast<Common>(rhs[i])))
+                return false;
+        }
+
+        return true;
+    }
+
+    template <typename TType, typename TTypeOther>
+    [[nodiscard]] inline
+    bool operator!=(DynamicVectorView<TType> lhs, DynamicVectorView<TTypeOther> rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief output stream
+     * 
+     */
+    template <typename TType>
+    inline
+    std::ostream& 	operator<<		(std::ostream& out, DynamicVectorView<TType> vec) noexcept
+    {
+        for (size_t i = 0; i < vec.getSize(); i++)
+            out << vec[i] << "  ";
+
+        return out;
+    }
+
+} /*namespace FoxMath*/
@@ -101,6 +101,24 @@ namespace FoxMath
             return GenericVector<TLength, TType>::fill(scalar);
         }
 
+        /**
+         * @brief Returns a reference to the flat storage. Length is marked as dirty because data can be modified through the reference
+         * 
+         * @return constexpr std::array<TType, TLength>& 
+         */
+        [[nodiscard]] inline constexpr
+        std::array<TType, TLength>& getData () noexcept
+        {
+            m_lengthIsDirty = true;
+            return Parent::getData();
+        }
+
+        [[nodiscard]] inline constexpr
+        const std::array<TType, TLength>& getData () const noexcept
+        {
+            return Parent::getData();
+        }
+
         /**
          * @brief Deprecated to avoid compare distance hack (Less optimized than check directly the length). 
          * If you really want the squart length ask it explicitely with length() * length()
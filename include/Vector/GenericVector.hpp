@@ -33,13 +33,16 @@
 #include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>, IsSame, Pack
 #include "Numeric/Limits.hpp" //isSame
 #include "Angle/Angle.hpp" //Angle
+#include "Numeric/SIMD.hpp" //SIMD::Float4, SIMD::storageAlignment
+#include "Numeric/Math.hpp" //Math::sqrt, Math::rsqrt, Math::SinCos
+#include "Numeric/EPrecision.hpp" //EPrecision
 
 #include <array> //std::array
 #include <stddef.h> //sizt_t
 #include <iostream> //ostream, istream
 #include <cassert> //assert
 #define _USE_MATH_DEFINES
-#include <math.h> //sqrt, lerp (if c++ 2020) //TODO: only include if C++ 20 when own sqrt implemented
+#include <math.h> //lerp (if c++ 2020)
 #include <stdexcept> //std::out_of_range
 
 /*Only if c++ >= 2020*/
@@ -66,7 +69,8 @@ namespace FoxMath
     
         #pragma region attribut
 
-        std::array<TType, TLength> m_data {};
+        /*Vector of 4 floats is aligned on 16 bytes to be loaded in one SIMD register*/
+        alignas(SIMD::storageAlignment<TLength, TType>) std::array<TType, TLength> m_data {};
 
         #pragma endregion //!attribut
     
@@ -153,9 +157,10 @@ namespace FoxMath
         /**
          * @brief return magnitude of the generic vector 
          * 
+         * @tparam TPrecision : EPrecision::Fast use x * rsqrt(x) (max error 4 ulp on float)
          * @return constexpr TType 
          */
-        //TODO: method not constexpr because it use std::sqrt. Replace it by my own function
+        template <EPrecision TPrecision = EPrecision::Precise>
         [[nodiscard]] inline constexpr
         TType length () const noexcept;
 
@@ -182,16 +187,20 @@ namespace FoxMath
         /**
          * @brief Normalize the generic vector. If the generic vector is null (all components are set to 0), nothing is done.
          * 
+         * @tparam TPrecision : EPrecision::Fast multiply by hardware rsqrt refined by one Newton step instead of divide by sqrt (max error 4 ulp on float)
          * @return constexpr GenericVector& 
          */
+        template <EPrecision TPrecision = EPrecision::Precise>
         inline constexpr
 		GenericVector& 	    normalize	        () noexcept;
 
         /**
          * @brief  Returns the normalized generic vector. If the generic vector is null (all components are set to 0), then generic vector zero is returned.
          * 
+         * @tparam TPrecision : see normalize
          * @return constexpr const GenericVector& 
          */
+        template <EPrecision TPrecision = EPrecision::Precise>
         [[nodiscard]] inline constexpr
         GenericVector      getNormalized		() const noexcept;
 
@@ -474,6 +483,28 @@ namespace FoxMath
 
         #pragma region accessor
 
+        /**
+         * @brief Returns a reference to the flat storage of the GenericVector. Used to view the vector without copy (DynamicVectorView...)
+         * 
+         * @return constexpr std::array<TType, TLength>& 
+         */
+        [[nodiscard]] inline constexpr
+		std::array<TType, TLength>& 	    getData	() noexcept
+        {
+            return m_data;
+        }
+
+        /**
+         * @brief Returns a const reference to the flat storage of the GenericVector.
+         * 
+         * @return constexpr const std::array<TType, TLength>& 
+         */
+        [[nodiscard]] inline constexpr
+		const std::array<TType, TLength>& 	    getData	() const noexcept
+        {
+            return m_data;
+        }
+
         /**
          * @brief   Returns a const reference to the data at index in the GenericVector
          * 
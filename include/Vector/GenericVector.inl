@@ -69,6 +69,17 @@ template <size_t TLength, typename TType>
 inline constexpr
 TType GenericVector<TLength, TType>::squareLength () const noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            const SIMD::Float4 vec = SIMD::load<TLength>(m_data.data());
+            return SIMD::dot(vec, vec);
+        }
+    }
+#endif
+
     TType sqrtLength {static_cast<TType>(0)};
 
     //x * x + y * y + z * z + [...]
@@ -80,12 +91,12 @@ TType GenericVector<TLength, TType>::squareLength () const noexcept
 	return sqrtLength;
 }
 
-//TODO: method not constexpr if it use std::sqrt. Replace it by my own function
 template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
 inline constexpr
 TType GenericVector<TLength, TType>::length () const noexcept
 {
-    return std::sqrt(squareLength());
+    return static_cast<TType>(Math::sqrt<TPrecision>(squareLength()));
 }
 
 template <size_t TLength, typename TType>
@@ -108,9 +119,53 @@ GenericVector<TLength, TType> 	    GenericVector<TLength, TType>::getHomogenized
 }
 
 template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::normalize	    () noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            const SIMD::Float4 vec = SIMD::load<TLength>(m_data.data());
+
+            if constexpr (TPrecision == EPrecision::Fast)
+            {
+                /*Square length stay in register : no round trip to scalar before rsqrt*/
+                const SIMD::Float4 squareLengthRst = SIMD::dotSplat(vec, vec);
+
+                if (SIMD::firstLane(squareLengthRst)) [[likely]]
+                    SIMD::store<TLength>(m_data.data(), SIMD::mul(vec, SIMD::rsqrt(squareLengthRst)));
+            }
+            else
+            {
+                const TType squareLengthRst = SIMD::dot(vec, vec);
+
+                if (squareLengthRst) [[likely]]
+                    SIMD::store<TLength>(m_data.data(), SIMD::div(vec, SIMD::set1(std::sqrt(squareLengthRst))));
+            }
+
+            return *this;
+        }
+    }
+#endif
+
+    if constexpr (TPrecision == EPrecision::Fast && std::is_floating_point_v<TType>)
+    {
+        const TType squareLengthRst = squareLength();
+
+        if (squareLengthRst) [[likely]]
+        {
+            const TType invLength = Math::rsqrt<TPrecision>(squareLengthRst);
+
+            for (size_t i = 0; i < TLength; i++)
+                m_data[i] *= invLength;
+        }
+
+        return *this;
+    }
+
     const TType lengthRst = length();
 
     if (lengthRst) [[likely]]
@@ -123,11 +178,12 @@ GenericVector<TLength, TType>& GenericVector<TLength, TType>::normalize	    () n
 }
 
 template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
 inline constexpr
 GenericVector<TLength, TType> GenericVector<TLength, TType>::getNormalized		() const noexcept
 {
     GenericVector<TLength, TType> rst (*this);
-    rst.normalize();
+    rst.normalize<TPrecision>();
     return rst;
 }
 
@@ -158,6 +214,16 @@ template <size_t TLength, typename TType>
 inline constexpr
 TType           GenericVector<TLength, TType>::dot		            (const GenericVector& other) const noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            return SIMD::dot(SIMD::load<TLength>(m_data.data()), SIMD::load<TLength>(other.m_data.data()));
+        }
+    }
+#endif
+
     TType rst {static_cast<TType>(0)};
 
     for (size_t i = 0; i < TLength; i++)
@@ -172,6 +238,17 @@ template <size_t TLength, typename TType>
 inline constexpr
 GenericVector<TLength, TType>&         GenericVector<TLength, TType>::cross	            (const GenericVector& other) noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::store<TLength>(m_data.data(), SIMD::cross<TLength>(SIMD::load<TLength>(m_data.data()), SIMD::load<TLength>(other.m_data.data())));
+            return *this;
+        }
+    }
+#endif
+
     GenericVector<TLength, TType> copyTemp {*this};
 
     for (size_t i = 0; i < TLength; i++)
@@ -199,6 +276,18 @@ template <size_t TLength, typename TType>
 inline constexpr
 GenericVector<TLength, TType>         GenericVector<TLength, TType>::getCross	            (const GenericVector& other) const noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            GenericVector<TLength, TType> rst;
+            SIMD::store<TLength>(rst.m_data.data(), SIMD::cross<TLength>(SIMD::load<TLength>(m_data.data()), SIMD::load<TLength>(other.m_data.data())));
+            return rst;
+        }
+    }
+#endif
+
     GenericVector<TLength, TType> rst;
 
     for (size_t i = 0; i < TLength; i++)
@@ -226,6 +315,18 @@ template <size_t TLength, typename TType>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::lerp		        (const GenericVector& other, TType t) noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            const SIMD::Float4 start = SIMD::load<TLength>(m_data.data());
+            SIMD::store<TLength>(m_data.data(), SIMD::mulAdd(start, SIMD::set1(t), SIMD::sub(SIMD::load<TLength>(other.m_data.data()), start)));
+            return *this;
+        }
+    }
+#endif
+
     GenericVector<TLength, TType> rst;
 
     for (size_t i = 0; i < TLength; i++)
@@ -245,6 +346,19 @@ template <size_t TLength, typename TType>
 inline constexpr
 GenericVector<TLength, TType> GenericVector<TLength, TType>::getLerp		        (const GenericVector& other, TType t) const noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            GenericVector<TLength, TType> rst;
+            const SIMD::Float4 start = SIMD::load<TLength>(m_data.data());
+            SIMD::store<TLength>(rst.m_data.data(), SIMD::mulAdd(start, SIMD::set1(t), SIMD::sub(SIMD::load<TLength>(other.m_data.data()), start)));
+            return rst;
+        }
+    }
+#endif
+
     GenericVector<TLength, TType> rst;
 
     for (size_t i = 0; i < TLength; i++)
@@ -267,6 +381,19 @@ GenericVector<TLength, TType>& GenericVector<TLength, TType>::reflect		        (
     assert(normalNormalized == static_cast<TType>(1) && "You must use unit generic vector. If you want disable assert for unit generic vector guard, please define DONT_USE_DEBUG_ASSERT_FOR_UNIT_VETOR");
 #endif
 
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            const SIMD::Float4 vec      = SIMD::load<TLength>(m_data.data());
+            const SIMD::Float4 normal   = SIMD::load<TLength>(normalNormalized.m_data.data());
+            SIMD::store<TLength>(m_data.data(), SIMD::sub(SIMD::mul(SIMD::set1(static_cast<TType>(2) * SIMD::dot(normal, vec)), normal), vec));
+            return *this;
+        }
+    }
+#endif
+
     *this = static_cast<TType>(2) * normalNormalized.dot(*this) * normalNormalized - (*this);
     return *this;
 }
@@ -279,6 +406,20 @@ GenericVector<TLength, TType> GenericVector<TLength, TType>::getReflection		 (co
     assert(normalNormalized == static_cast<TType>(1) && "You must use unit generic vector. If you want disable assert for unit generic vector guard, please define DONT_USE_DEBUG_ASSERT_FOR_UNIT_VETOR");
 #endif
 
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            GenericVector<TLength, TType> rst;
+            const SIMD::Float4 vec      = SIMD::load<TLength>(m_data.data());
+            const SIMD::Float4 normal   = SIMD::load<TLength>(normalNormalized.m_data.data());
+            SIMD::store<TLength>(rst.m_data.data(), SIMD::sub(SIMD::mul(SIMD::set1(static_cast<TType>(2) * SIMD::dot(normal, vec)), normal), vec));
+            return rst;
+        }
+    }
+#endif
+
     GenericVector<TLength, TType> rst;
     rst = static_cast<TType>(2) * normalNormalized.dot(*this) * normalNormalized - (*this);
     return rst;
@@ -338,10 +479,11 @@ GenericVector<TLength, TType> GenericVector<TLength, TType>::getRotationAroundAx
     assert(unitAxis == static_cast<TType>(1) && "You must use unit generic vector. If you want disable assert for unit generic vector guard, please define DONT_USE_DEBUG_ASSERT_FOR_UNIT_VETOR");
 #endif
 
-	TType cosA = std::cos(static_cast<TType>(angle));
+	const Math::SinCos<Math::Real<TType>> sinCosA = angle.getSinCos();
+	const TType cosA = static_cast<TType>(sinCosA.cos);
 
 	//rodrigues rotation formula
-	return (*this) * cosA + unitAxis.getCross(*this) * std::sin(static_cast<TType>(angle)) + unitAxis * unitAxis.dot(*this) * (static_cast<TType>(1) - cosA);
+	return (*this) * cosA + unitAxis.getCross(*this) * static_cast<TType>(sinCosA.sin) + unitAxis * unitAxis.dot(*this) * (static_cast<TType>(1) - cosA);
 }
 
 template <size_t TLength, typename TType>
@@ -441,6 +583,17 @@ template<typename TscalarType, IsArithmetic<TscalarType> = true>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator+=(TscalarType scalar) noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::store<TLength>(m_data.data(), SIMD::add(SIMD::load<TLength>(m_data.data()), SIMD::set1(static_cast<TType>(scalar))));
+            return *this;
+        }
+    }
+#endif
+
     for (TType& data : m_data)
     {
         data += static_cast<TType>(scalar);
@@ -453,6 +606,17 @@ template <size_t TLengthOther, typename TTypeOther>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator+=(const GenericVector<TLengthOther, TTypeOther>& other) noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType> && TLengthOther == TLength && std::is_same_v<TTypeOther, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::store<TLength>(m_data.data(), SIMD::add(SIMD::load<TLength>(m_data.data()), SIMD::load<TLength>(other.m_data.data())));
+            return *this;
+        }
+    }
+#endif
+
     constexpr size_t minLenght = (TLengthOther < TLength) ? TLengthOther : TLength;
 
     for (size_t i = 0; i < minLenght; i++)
@@ -467,6 +631,17 @@ template<typename TscalarType, IsArithmetic<TscalarType> = true>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator-=(TscalarType scalar) noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::store<TLength>(m_data.data(), SIMD::sub(SIMD::load<TLength>(m_data.data()), SIMD::set1(static_cast<TType>(scalar))));
+            return *this;
+        }
+    }
+#endif
+
     for (TType& data : m_data)
     {
         data -= static_cast<TType>(scalar);
@@ -479,6 +654,17 @@ template <size_t TLengthOther, typename TTypeOther>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator-=(const GenericVector<TLengthOther, TTypeOther>& other) noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType> && TLengthOther == TLength && std::is_same_v<TTypeOther, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::store<TLength>(m_data.data(), SIMD::sub(SIMD::load<TLength>(m_data.data()), SIMD::load<TLength>(other.m_data.data())));
+            return *this;
+        }
+    }
+#endif
+
     constexpr size_t minLenght = (TLengthOther < TLength) ? TLengthOther : TLength;
 
     for (size_t i = 0; i < minLenght; i++)
@@ -493,6 +679,17 @@ template<typename TscalarType, IsArithmetic<TscalarType> = true>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator*=(TscalarType scalar) noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::store<TLength>(m_data.data(), SIMD::mul(SIMD::load<TLength>(m_data.data()), SIMD::set1(static_cast<TType>(scalar))));
+            return *this;
+        }
+    }
+#endif
+
     for (TType& data : m_data)
     {
         data *= static_cast<TType>(scalar);
@@ -505,6 +702,17 @@ template <size_t TLengthOther, typename TTypeOther>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator*=(const GenericVector<TLengthOther, TTypeOther>& other) noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType> && TLengthOther == TLength && std::is_same_v<TTypeOther, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::store<TLength>(m_data.data(), SIMD::mul(SIMD::load<TLength>(m_data.data()), SIMD::load<TLength>(other.m_data.data())));
+            return *this;
+        }
+    }
+#endif
+
     constexpr size_t minLenght = (TLengthOther < TLength) ? TLengthOther : TLength;
 
     for (size_t i = 0; i < minLenght; i++)
@@ -519,6 +727,17 @@ template<typename TscalarType, IsArithmetic<TscalarType> = true>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator/=(TscalarType scalar) noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::store<TLength>(m_data.data(), SIMD::div(SIMD::load<TLength>(m_data.data()), SIMD::set1(static_cast<TType>(scalar))));
+            return *this;
+        }
+    }
+#endif
+
     for (TType& data : m_data)
     {
         data /= static_cast<TType>(scalar);
@@ -531,6 +750,17 @@ template <size_t TLengthOther, typename TTypeOther>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator/=(const GenericVector<TLengthOther, TTypeOther>& other) noexcept
 {
+#ifdef FOXMATH_USE_SIMD
+    if constexpr (SIMD::isFloat4Compatible<TLength, TType> && TLengthOther == TLength && std::is_same_v<TTypeOther, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::store<TLength>(m_data.data(), SIMD::div(SIMD::load<TLength>(m_data.data()), SIMD::load<TLength>(other.m_data.data())));
+            return *this;
+        }
+    }
+#endif
+
     constexpr size_t minLenght = (TLengthOther < TLength) ? TLengthOther : TLength;
 
     for (size_t i = 0; i < minLenght; i++)
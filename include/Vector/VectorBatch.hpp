@@ -0,0 +1,552 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Vector/GenericVector.hpp" //GenericVector
+#include "Matrix/GenericMatrix.hpp" //GenericMatrix
+#include "Memory/AlignedAllocator.hpp" //AlignedAllocator
+#include "Numeric/SIMD.hpp" //SIMD::Packet
+#include "Numeric/EPrecision.hpp" //EPrecision
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>, IsNotEqualTo
+
+#include <array> //std::array
+#include <vector> //std::vector
+#include <stddef.h> //sizt_t
+#include <cassert> //assert
+#include <limits> //std::numeric_limits
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <size_t TLength, typename TType = float, 
+                IsNotEqualTo<TLength, 0> = true, 
+                IsArithmetic<TType> = true>
+    class VectorBatch;
+
+    /**
+     * @brief Structure of arrays container of generic vectors. Each component is stored in its own aligned stream (x0 x1 x2..., y0 y1 y2...)
+     * so bulk operations fill every SIMD lane. Streams are padded to a multiple of laneCount() and kernels process laneCount() vectors per iteration.
+     * @note Use operator[] to get a view of one vector that converts to and from GenericVector without copying the batch
+     * @example `FoxMath::VectorBatch<3, float> positions (1000000); positions += velocity * deltaTime;`
+     * 
+     * @tparam TLength 
+     * @tparam TType 
+     */
+    template <size_t TLength, typename TType>
+    class VectorBatch<TLength, TType>
+    {
+        private:
+
+        using Packet = SIMD::Packet<TType>;
+
+        /*Number of packets processed per iteration*/
+        static constexpr size_t unroll = (Packet::size == 1) ? 8 : 2;
+
+        public:
+
+        #pragma region static attribut
+
+        /*Streams are aligned on cache line*/
+        static constexpr size_t streamAlignment = 64;
+
+        /**
+         * @brief Number of vectors processed by one kernel iteration (8 or 16 with SSE/AVX)
+         * 
+         * @return constexpr size_t 
+         */
+        [[nodiscard]] static inline constexpr
+        size_t laneCount () noexcept
+        {
+            return Packet::size * unroll;
+        }
+
+        /**
+         * @brief Get the vector dimension
+         * 
+         * @return constexpr size_t 
+         */
+        [[nodiscard]] static inline constexpr
+		size_t 	getDimension () noexcept
+        {
+            return TLength;
+        }
+
+        #pragma endregion //! static attribut
+
+        /**
+         * @brief View of one vector of the batch. Read and write directly in the component streams.
+         * 
+         */
+        class Element
+        {
+            private:
+
+            VectorBatch&    m_batch;
+            size_t          m_index;
+
+            public:
+
+            constexpr inline
+            Element (VectorBatch& batch, size_t index) noexcept
+                : m_batch {batch}, m_index {index}
+            {}
+
+            constexpr inline
+            Element (const Element& other) noexcept = default;
+
+            /**
+             * @brief Scatter the vector in component streams
+             * 
+             * @param vec 
+             * @return Element& 
+             */
+            inline
+            Element& operator=(const GenericVector<TLength, TType>& vec) noexcept
+            {
+                m_batch.setVector(m_index, vec);
+                return *this;
+            }
+
+            inline
+            Element& operator=(const Element& other) noexcept
+            {
+                m_batch.setVector(m_index, static_cast<GenericVector<TLength, TType>>(other));
+                return *this;
+            }
+
+            /**
+             * @brief Returns a reference to the component of the vector
+             * 
+             * @param component 
+             * @return TType& 
+             */
+            [[nodiscard]] inline
+            TType& operator[] (size_t component) noexcept
+            {
+                assert(component < TLength);
+                return m_batch.m_streams[component][m_index];
+            }
+
+            /**
+             * @brief Gather the components in a generic vector
+             * 
+             * @return GenericVector<TLength, TType> 
+             */
+            [[nodiscard]] implicit inline
+            operator GenericVector<TLength, TType>() const noexcept
+            {
+                return m_batch.getVector(m_index);
+            }
+        };
+
+        protected:
+
+        #pragma region attribut
+
+        using Stream = std::vector<TType, AlignedAllocator<TType, streamAlignment>>;
+
+        std::array<Stream, TLength> m_streams   {};
+        size_t                      m_size      {0};
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        /**
+         * @brief Call functor with the index of each packet of the padded streams. The loop is unrolled to process laneCount() vectors per iteration
+         * 
+         * @tparam TFunctor : void(size_t index)
+         * @param functor 
+         */
+        template <typename TFunctor>
+        inline
+        void forEachPacket (TFunctor&& functor) const noexcept;
+
+        /**
+         * @brief Call packetFunctor on each full packet inside size() and scalarFunctor on the remaining vectors. Use it to write in user buffer that is not padded.
+         * 
+         * @tparam TPacketFunctor : void(size_t index)
+         * @tparam TScalarFunctor : void(size_t index)
+         * @param packetFunctor 
+         * @param scalarFunctor 
+         */
+        template <typename TPacketFunctor, typename TScalarFunctor>
+        inline
+        void forEachPacketInSize (TPacketFunctor&& packetFunctor, TScalarFunctor&& scalarFunctor) const noexcept;
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        VectorBatch ()                                      = default;
+        VectorBatch (const VectorBatch& other)			    = default;
+        VectorBatch (VectorBatch&& other) noexcept	        = default;
+        ~VectorBatch ()				                        = default;
+        VectorBatch& operator=(VectorBatch const& other)    = default;
+        VectorBatch& operator=(VectorBatch && other)        = default;
+
+        /**
+         * @brief Construct batch of size vectors init to zero
+         * 
+         * @param size 
+         */
+        explicit inline
+        VectorBatch (size_t size);
+
+        /**
+         * @brief Construct batch of size vectors init to vec
+         * 
+         * @param size 
+         * @param vec 
+         */
+        explicit inline
+        VectorBatch (size_t size, const GenericVector<TLength, TType>& vec);
+
+        /**
+         * @brief Construct batch by gathering an array of generic vectors
+         * 
+         * @param vecs 
+         * @param count 
+         */
+        explicit inline
+        VectorBatch (const GenericVector<TLength, TType>* vecs, size_t count);
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Resize the batch. New vectors are init to zero
+         * 
+         * @param newSize 
+         */
+        inline
+        void resize (size_t newSize);
+
+        /**
+         * @brief Reserve memory for capacity vectors
+         * 
+         * @param capacity 
+         */
+        inline
+        void reserve (size_t capacity);
+
+        /**
+         * @brief Remove all vectors
+         * 
+         */
+        inline
+        void clear () noexcept;
+
+        /**
+         * @brief Add a vector at the end of the batch
+         * 
+         * @param vec 
+         */
+        inline
+        void pushBack (const GenericVector<TLength, TType>& vec);
+
+        /**
+         * @brief Gather count generic vectors from array of structure in the batch at index offset. The batch is grown if needed.
+         * 
+         * @param vecs 
+         * @param count 
+         * @param offset 
+         */
+        inline
+        void gather (const GenericVector<TLength, TType>* vecs, size_t count, size_t offset = 0);
+
+        /**
+         * @brief Scatter count vectors of the batch from index offset to array of structure
+         * 
+         * @param vecs 
+         * @param count 
+         * @param offset 
+         */
+        inline
+        void scatter (GenericVector<TLength, TType>* vecs, size_t count, size_t offset = 0) const noexcept;
+
+        /**
+         * @brief Fill all vectors with the same generic vector
+         * 
+         * @param vec 
+         * @return VectorBatch& 
+         */
+        inline
+        VectorBatch& fill (const GenericVector<TLength, TType>& vec) noexcept;
+
+        /**
+         * @brief Write the square length of each vector in rst. rst must contain size() element.
+         * 
+         * @param rst 
+         */
+        inline
+        void squareLength (TType* rst) const noexcept;
+
+        /**
+         * @brief Write the magnitude of each vector in rst. rst must contain size() element.
+         * 
+         * @tparam TPrecision : EPrecision::Fast use x * rsqrt(x) (max error 4 ulp on float)
+         * @param rst 
+         */
+        template <EPrecision TPrecision = EPrecision::Precise>
+        inline
+        void length (TType* rst) const noexcept;
+
+        /**
+         * @brief Normalize each vector. Null vectors stay null.
+         * 
+         * @tparam TPrecision : EPrecision::Fast multiply by hardware rsqrt refined by one Newton step instead of divide by sqrt (max error 4 ulp on float)
+         * @return VectorBatch& 
+         */
+        template <EPrecision TPrecision = EPrecision::Precise>
+        inline
+        VectorBatch& normalize () noexcept;
+
+        /**
+         * @brief Get the Normalized object
+         * 
+         * @tparam TPrecision : see normalize
+         * @return VectorBatch 
+         */
+        template <EPrecision TPrecision = EPrecision::Precise>
+        [[nodiscard]] inline
+        VectorBatch getNormalized () const;
+
+        /**
+         * @brief Write the dot product of each pair of vectors in rst. rst must contain size() element.
+         * 
+         * @param other : batch of same size
+         * @param rst 
+         */
+        inline
+        void dot (const VectorBatch& other, TType* rst) const noexcept;
+
+        /**
+         * @brief Write the dot product of each vector with vec in rst. rst must contain size() element.
+         * 
+         * @param vec 
+         * @param rst 
+         */
+        inline
+        void dot (const GenericVector<TLength, TType>& vec, TType* rst) const noexcept;
+
+        /**
+         * @brief perform cross product of each pair of vectors. Only for 3D vectors
+         * 
+         * @param other : batch of same size
+         * @return VectorBatch& 
+         */
+        inline
+        VectorBatch& cross (const VectorBatch& other) noexcept;
+
+        /**
+         * @brief Get the Cross object
+         * 
+         * @param other 
+         * @return VectorBatch 
+         */
+        [[nodiscard]] inline
+        VectorBatch getCross (const VectorBatch& other) const;
+
+        /**
+         * @brief Performs a linear interpolation between each pair of vectors
+         * 
+         * @param other : batch of same size
+         * @param t 
+         * @return VectorBatch& 
+         */
+        inline
+        VectorBatch& lerp (const VectorBatch& other, TType t) noexcept;
+
+        /**
+         * @brief Get the Lerp object
+         * 
+         * @param other 
+         * @param t 
+         * @return VectorBatch 
+         */
+        [[nodiscard]] inline
+        VectorBatch getLerp (const VectorBatch& other, TType t) const;
+
+        /**
+         * @brief Transform each vector by the matrix (matrix * vector). 3D vectors are extended with w (1 for point, 0 for direction) and the result is not homogenized.
+         * 
+         * @tparam TMatrixConvention 
+         * @param mat 
+         * @param w : implicit fourth component of 3D vectors. Ignored with 4D vectors
+         * @return VectorBatch& 
+         */
+        template <EMatrixConvention TMatrixConvention>
+        inline
+        VectorBatch& transform (const GenericMatrix<4, 4, TType, TMatrixConvention>& mat, TType w = static_cast<TType>(1)) noexcept;
+
+        /**
+         * @brief Get the Transformed object
+         * 
+         * @tparam TMatrixConvention 
+         * @param mat 
+         * @param w 
+         * @return VectorBatch 
+         */
+        template <EMatrixConvention TMatrixConvention>
+        [[nodiscard]] inline
+        VectorBatch getTransformed (const GenericMatrix<4, 4, TType, TMatrixConvention>& mat, TType w = static_cast<TType>(1)) const;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        /**
+         * @brief Number of vectors
+         * 
+         * @return size_t 
+         */
+        [[nodiscard]] inline
+        size_t size () const noexcept { return m_size; }
+
+        /**
+         * @brief Number of vectors stored in streams, including padding
+         * 
+         * @return size_t 
+         */
+        [[nodiscard]] inline
+        size_t paddedSize () const noexcept { return m_streams[0].size(); }
+
+        [[nodiscard]] inline
+        bool empty () const noexcept { return m_size == 0; }
+
+        /**
+         * @brief Get the component stream (i.e. all x). Stream is aligned on streamAlignment and contain paddedSize() element.
+         * 
+         * @param component 
+         * @return TType* 
+         */
+        [[nodiscard]] inline
+        TType* getStream (size_t component) noexcept;
+
+        [[nodiscard]] inline
+        const TType* getStream (size_t component) const noexcept;
+
+        /**
+         * @brief Gather the vector at index
+         * 
+         * @param index 
+         * @return GenericVector<TLength, TType> 
+         */
+        [[nodiscard]] inline
+        GenericVector<TLength, TType> getVector (size_t index) const noexcept;
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        /**
+         * @brief Scatter the vector at index
+         * 
+         * @param index 
+         * @param vec 
+         */
+        inline
+        void setVector (size_t index, const GenericVector<TLength, TType>& vec) noexcept;
+
+        #pragma endregion //!mutator
+
+        #pragma region operator
+        #pragma region member access operators
+
+        /**
+         * @brief Returns a view on the vector at index that converts to and from GenericVector
+         * 
+         * @param index 
+         * @return Element 
+         */
+        [[nodiscard]] inline
+        Element operator[] (size_t index) noexcept;
+
+        [[nodiscard]] inline
+        GenericVector<TLength, TType> operator[] (size_t index) const noexcept;
+
+        #pragma endregion //!member access operators
+        #pragma region assignment operators
+
+        inline VectorBatch& operator+=(TType scalar) noexcept;
+        inline VectorBatch& operator-=(TType scalar) noexcept;
+        inline VectorBatch& operator*=(TType scalar) noexcept;
+        inline VectorBatch& operator/=(TType scalar) noexcept;
+
+        inline VectorBatch& operator+=(const GenericVector<TLength, TType>& vec) noexcept;
+        inline VectorBatch& operator-=(const GenericVector<TLength, TType>& vec) noexcept;
+        inline VectorBatch& operator*=(const GenericVector<TLength, TType>& vec) noexcept;
+        inline VectorBatch& operator/=(const GenericVector<TLength, TType>& vec) noexcept;
+
+        inline VectorBatch& operator+=(const VectorBatch& other) noexcept;
+        inline VectorBatch& operator-=(const VectorBatch& other) noexcept;
+        inline VectorBatch& operator*=(const VectorBatch& other) noexcept;
+        inline VectorBatch& operator/=(const VectorBatch& other) noexcept;
+
+        #pragma endregion //!assignment operators
+        #pragma endregion //!operator
+    };
+
+    #pragma region arithmetic operators
+
+    template <size_t TLength, typename TType, typename TOther>
+    [[nodiscard]] inline
+    VectorBatch<TLength, TType> operator+(VectorBatch<TLength, TType> lhs, const TOther& rhs) noexcept { return lhs += rhs; }
+
+    template <size_t TLength, typename TType, typename TOther>
+    [[nodiscard]] inline
+    VectorBatch<TLength, TType> operator-(VectorBatch<TLength, TType> lhs, const TOther& rhs) noexcept { return lhs -= rhs; }
+
+    template <size_t TLength, typename TType, typename TOther>
+    [[nodiscard]] inline
+    VectorBatch<TLength, TType> operator*(VectorBatch<TLength, TType> lhs, const TOther& rhs) noexcept { return lhs *= rhs; }
+
+    template <size_t TLength, typename TType, typename TOther>
+    [[nodiscard]] inline
+    VectorBatch<TLength, TType> operator/(VectorBatch<TLength, TType> lhs, const TOther& rhs) noexcept { return lhs /= rhs; }
+
+    #pragma endregion //!arithmetic operators
+
+    #include "VectorBatch.inl"
+
+    template <typename TType = float>
+    using Vec3Batch     = VectorBatch<3, TType>;
+
+    template <typename TType = float>
+    using Vec4Batch     = VectorBatch<4, TType>;
+
+    using Vec3fBatch    = Vec3Batch<float>;
+    using Vec4fBatch    = Vec4Batch<float>;
+
+} /*namespace FoxMath*/
@@ -0,0 +1,603 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <size_t TLength, typename TType>
+template <typename TFunctor>
+inline
+void VectorBatch<TLength, TType>::forEachPacket (TFunctor&& functor) const noexcept
+{
+    const size_t streamSize = paddedSize();
+
+    for (size_t i = 0; i < streamSize; i += laneCount())
+    {
+        for (size_t unrollIndex = 0; unrollIndex < unroll; unrollIndex++)
+        {
+            functor(i + unrollIndex * Packet::size);
+        }
+    }
+}
+
+template <size_t TLength, typename TType>
+template <typename TPacketFunctor, typename TScalarFunctor>
+inline
+void VectorBatch<TLength, TType>::forEachPacketInSize (TPacketFunctor&& packetFunctor, TScalarFunctor&& scalarFunctor) const noexcept
+{
+    const size_t packetEnd = m_size - m_size % Packet::size;
+
+    for (size_t i = 0; i < packetEnd; i += Packet::size)
+    {
+        packetFunctor(i);
+    }
+
+    for (size_t i = packetEnd; i < m_size; i++)
+    {
+        scalarFunctor(i);
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>::VectorBatch (size_t size)
+{
+    resize(size);
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>::VectorBatch (size_t size, const GenericVector<TLength, TType>& vec)
+{
+    resize(size);
+    fill(vec);
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>::VectorBatch (const GenericVector<TLength, TType>* vecs, size_t count)
+{
+    gather(vecs, count);
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::resize (size_t newSize)
+{
+    const size_t newPaddedSize = (newSize + laneCount() - 1) / laneCount() * laneCount();
+
+    for (Stream& stream : m_streams)
+    {
+        stream.resize(newPaddedSize, static_cast<TType>(0));
+
+        /*Padding may contain old values : new vectors must be init to zero*/
+        for (size_t i = m_size; i < newSize; i++)
+        {
+            stream[i] = static_cast<TType>(0);
+        }
+    }
+
+    m_size = newSize;
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::reserve (size_t capacity)
+{
+    const size_t paddedCapacity = (capacity + laneCount() - 1) / laneCount() * laneCount();
+
+    for (Stream& stream : m_streams)
+    {
+        stream.reserve(paddedCapacity);
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::clear () noexcept
+{
+    for (Stream& stream : m_streams)
+    {
+        stream.clear();
+    }
+
+    m_size = 0;
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::pushBack (const GenericVector<TLength, TType>& vec)
+{
+    if (m_size == paddedSize()) [[unlikely]]
+        resize(m_size + 1);
+    else
+        m_size++;
+
+    setVector(m_size - 1, vec);
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::gather (const GenericVector<TLength, TType>* vecs, size_t count, size_t offset)
+{
+    if (offset + count > m_size)
+        resize(offset + count);
+
+    for (size_t component = 0; component < TLength; component++)
+    {
+        TType* const stream = m_streams[component].data() + offset;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            stream[i] = vecs[i][component];
+        }
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::scatter (GenericVector<TLength, TType>* vecs, size_t count, size_t offset) const noexcept
+{
+    assert(offset + count <= m_size);
+
+    for (size_t component = 0; component < TLength; component++)
+    {
+        const TType* const stream = m_streams[component].data() + offset;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            vecs[i].setData(component, stream[i]);
+        }
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::fill (const GenericVector<TLength, TType>& vec) noexcept
+{
+    for (size_t component = 0; component < TLength; component++)
+    {
+        std::fill(m_streams[component].begin(), m_streams[component].end(), vec[component]);
+    }
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::squareLength (TType* rst) const noexcept
+{
+    forEachPacketInSize([&](size_t index)
+    {
+        typename Packet::Type sum = Packet::set1(static_cast<TType>(0));
+
+        for (size_t component = 0; component < TLength; component++)
+        {
+            const typename Packet::Type data = Packet::load(m_streams[component].data() + index);
+            sum = Packet::mulAdd(sum, data, data);
+        }
+
+        Packet::storeUnaligned(rst + index, sum);
+    },
+    [&](size_t index)
+    {
+        rst[index] = getVector(index).squareLength();
+    });
+}
+
+template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
+inline
+void VectorBatch<TLength, TType>::length (TType* rst) const noexcept
+{
+    const typename Packet::Type minSquareLength = Packet::set1(std::numeric_limits<TType>::min());
+
+    forEachPacketInSize([&](size_t index)
+    {
+        typename Packet::Type sum = Packet::set1(static_cast<TType>(0));
+
+        for (size_t component = 0; component < TLength; component++)
+        {
+            const typename Packet::Type data = Packet::load(m_streams[component].data() + index);
+            sum = Packet::mulAdd(sum, data, data);
+        }
+
+        if constexpr (TPrecision == EPrecision::Fast)
+            Packet::storeUnaligned(rst + index, Packet::mul(sum, Packet::rsqrt(Packet::max(sum, minSquareLength))));
+        else
+            Packet::storeUnaligned(rst + index, Packet::sqrt(sum));
+    },
+    [&](size_t index)
+    {
+        rst[index] = getVector(index).template length<TPrecision>();
+    });
+}
+
+template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::normalize () noexcept
+{
+    /*Null vector are divided by the smallest normal value to stay null without branch*/
+    const typename Packet::Type minLength = Packet::set1(std::numeric_limits<TType>::min());
+
+    if constexpr (TPrecision == EPrecision::Fast)
+    {
+        forEachPacket([&](size_t index)
+        {
+            typename Packet::Type data[TLength];
+            typename Packet::Type sum = Packet::set1(static_cast<TType>(0));
+
+            for (size_t component = 0; component < TLength; component++)
+            {
+                data[component] = Packet::load(m_streams[component].data() + index);
+                sum = Packet::mulAdd(sum, data[component], data[component]);
+            }
+
+            const typename Packet::Type invMagnitude = Packet::rsqrt(Packet::max(sum, minLength));
+
+            for (size_t component = 0; component < TLength; component++)
+            {
+                Packet::store(m_streams[component].data() + index, Packet::mul(data[component], invMagnitude));
+            }
+        });
+
+        return *this;
+    }
+
+    forEachPacket([&](size_t index)
+    {
+        typename Packet::Type data[TLength];
+        typename Packet::Type sum = Packet::set1(static_cast<TType>(0));
+
+        for (size_t component = 0; component < TLength; component++)
+        {
+            data[component] = Packet::load(m_streams[component].data() + index);
+            sum = Packet::mulAdd(sum, data[component], data[component]);
+        }
+
+        const typename Packet::Type magnitude = Packet::max(Packet::sqrt(sum), minLength);
+
+        for (size_t component = 0; component < TLength; component++)
+        {
+            Packet::store(m_streams[component].data() + index, Packet::div(data[component], magnitude));
+        }
+    });
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
+inline
+VectorBatch<TLength, TType> VectorBatch<TLength, TType>::getNormalized () const
+{
+    VectorBatch rst (*this);
+    rst.template normalize<TPrecision>();
+    return rst;
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::dot (const VectorBatch& other, TType* rst) const noexcept
+{
+    assert(other.size() == m_size);
+
+    forEachPacketInSize([&](size_t index)
+    {
+        typename Packet::Type sum = Packet::set1(static_cast<TType>(0));
+
+        for (size_t component = 0; component < TLength; component++)
+        {
+            sum = Packet::mulAdd(sum, Packet::load(m_streams[component].data() + index), Packet::load(other.m_streams[component].data() + index));
+        }
+
+        Packet::storeUnaligned(rst + index, sum);
+    },
+    [&](size_t index)
+    {
+        rst[index] = getVector(index).dot(other.getVector(index));
+    });
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::dot (const GenericVector<TLength, TType>& vec, TType* rst) const noexcept
+{
+    typename Packet::Type vecComponents[TLength];
+
+    for (size_t component = 0; component < TLength; component++)
+    {
+        vecComponents[component] = Packet::set1(vec[component]);
+    }
+
+    forEachPacketInSize([&](size_t index)
+    {
+        typename Packet::Type sum = Packet::set1(static_cast<TType>(0));
+
+        for (size_t component = 0; component < TLength; component++)
+        {
+            sum = Packet::mulAdd(sum, Packet::load(m_streams[component].data() + index), vecComponents[component]);
+        }
+
+        Packet::storeUnaligned(rst + index, sum);
+    },
+    [&](size_t index)
+    {
+        rst[index] = getVector(index).dot(vec);
+    });
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::cross (const VectorBatch& other) noexcept
+{
+    static_assert(TLength == 3, "Cross product of vector batch is only defined for 3D vectors");
+    assert(other.size() == m_size);
+
+    forEachPacket([&](size_t index)
+    {
+        const typename Packet::Type ax = Packet::load(m_streams[0].data() + index);
+        const typename Packet::Type ay = Packet::load(m_streams[1].data() + index);
+        const typename Packet::Type az = Packet::load(m_streams[2].data() + index);
+        const typename Packet::Type bx = Packet::load(other.m_streams[0].data() + index);
+        const typename Packet::Type by = Packet::load(other.m_streams[1].data() + index);
+        const typename Packet::Type bz = Packet::load(other.m_streams[2].data() + index);
+
+        Packet::store(m_streams[0].data() + index, Packet::sub(Packet::mul(ay, bz), Packet::mul(az, by)));
+        Packet::store(m_streams[1].data() + index, Packet::sub(Packet::mul(az, bx), Packet::mul(ax, bz)));
+        Packet::store(m_streams[2].data() + index, Packet::sub(Packet::mul(ax, by), Packet::mul(ay, bx)));
+    });
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType> VectorBatch<TLength, TType>::getCross (const VectorBatch& other) const
+{
+    VectorBatch rst (*this);
+    rst.cross(other);
+    return rst;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::lerp (const VectorBatch& other, TType t) noexcept
+{
+    assert(other.size() == m_size);
+
+    const typename Packet::Type ratio = Packet::set1(t);
+
+    forEachPacket([&](size_t index)
+    {
+        for (size_t component = 0; component < TLength; component++)
+        {
+            const typename Packet::Type start = Packet::load(m_streams[component].data() + index);
+            const typename Packet::Type end   = Packet::load(other.m_streams[component].data() + index);
+            Packet::store(m_streams[component].data() + index, Packet::mulAdd(start, ratio, Packet::sub(end, start)));
+        }
+    });
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType> VectorBatch<TLength, TType>::getLerp (const VectorBatch& other, TType t) const
+{
+    VectorBatch rst (*this);
+    rst.lerp(other, t);
+    return rst;
+}
+
+template <size_t TLength, typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::transform (const GenericMatrix<4, 4, TType, TMatrixConvention>& mat, TType w) noexcept
+{
+    static_assert(TLength == 3 || TLength == 4, "Vector batch can only be transformed by matrix 4 if vectors are 3D or 4D");
+
+    /*Broadcast coefficients once. coef[row][column] whatever the matrix convention*/
+    constexpr size_t rowCount = TLength;
+    typename Packet::Type coef[rowCount][4];
+
+    for (size_t row = 0; row < rowCount; row++)
+    {
+        for (size_t column = 0; column < 4; column++)
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::RowMajor)
+                coef[row][column] = Packet::set1(mat.getData(row, column));
+            else
+                coef[row][column] = Packet::set1(mat.getData(column, row));
+        }
+    }
+
+    const typename Packet::Type implicitW = Packet::set1(w);
+
+    forEachPacket([&](size_t index)
+    {
+        const typename Packet::Type x = Packet::load(m_streams[0].data() + index);
+        const typename Packet::Type y = Packet::load(m_streams[1].data() + index);
+        const typename Packet::Type z = Packet::load(m_streams[2].data() + index);
+        typename Packet::Type wComponent;
+
+        if constexpr (TLength == 4)
+            wComponent = Packet::load(m_streams[3].data() + index);
+        else
+            wComponent = implicitW;
+
+        for (size_t row = 0; row < rowCount; row++)
+        {
+            typename Packet::Type rst = Packet::mul(coef[row][0], x);
+            rst = Packet::mulAdd(rst, coef[row][1], y);
+            rst = Packet::mulAdd(rst, coef[row][2], z);
+            rst = Packet::mulAdd(rst, coef[row][3], wComponent);
+            Packet::store(m_streams[row].data() + index, rst);
+        }
+    });
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+template <EMatrixConvention TMatrixConvention>
+inline
+VectorBatch<TLength, TType> VectorBatch<TLength, TType>::getTransformed (const GenericMatrix<4, 4, TType, TMatrixConvention>& mat, TType w) const
+{
+    VectorBatch rst (*this);
+    rst.transform(mat, w);
+    return rst;
+}
+
+template <size_t TLength, typename TType>
+inline
+TType* VectorBatch<TLength, TType>::getStream (size_t component) noexcept
+{
+    assert(component < TLength);
+    return m_streams[component].data();
+}
+
+template <size_t TLength, typename TType>
+inline
+const TType* VectorBatch<TLength, TType>::getStream (size_t component) const noexcept
+{
+    assert(component < TLength);
+    return m_streams[component].data();
+}
+
+template <size_t TLength, typename TType>
+inline
+GenericVector<TLength, TType> VectorBatch<TLength, TType>::getVector (size_t index) const noexcept
+{
+    assert(index < m_size);
+
+    GenericVector<TLength, TType> rst;
+
+    for (size_t component = 0; component < TLength; component++)
+    {
+        rst.setData(component, m_streams[component][index]);
+    }
+
+    return rst;
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::setVector (size_t index, const GenericVector<TLength, TType>& vec) noexcept
+{
+    assert(index < m_size);
+
+    for (size_t component = 0; component < TLength; component++)
+    {
+        m_streams[component][index] = vec[component];
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+typename VectorBatch<TLength, TType>::Element VectorBatch<TLength, TType>::operator[] (size_t index) noexcept
+{
+    assert(index < m_size);
+    return Element(*this, index);
+}
+
+template <size_t TLength, typename TType>
+inline
+GenericVector<TLength, TType> VectorBatch<TLength, TType>::operator[] (size_t index) const noexcept
+{
+    return getVector(index);
+}
+
+/*Same kernels for each assignment operator : Packet::packetOperation(lhs, rhs) with scalar, generic vector or batch as rhs*/
+#define FOXMATH_VECTOR_BATCH_ASSIGNMENT_OPERATOR(op, packetOperation)                                                               \
+template <size_t TLength, typename TType>                                                                                           \
+inline                                                                                                                              \
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator op (TType scalar) noexcept                                       \
+{                                                                                                                                   \
+    const typename Packet::Type scalarPacket = Packet::set1(scalar);                                                                \
+                                                                                                                                    \
+    forEachPacket([&](size_t index)                                                                                                 \
+    {                                                                                                                               \
+        for (size_t component = 0; component < TLength; component++)                                                                \
+        {                                                                                                                           \
+            TType* const data = m_streams[component].data() + index;                                                                \
+            Packet::store(data, Packet::packetOperation(Packet::load(data), scalarPacket));                                         \
+        }                                                                                                                           \
+    });                                                                                                                             \
+                                                                                                                                    \
+    return *this;                                                                                                                   \
+}                                                                                                                                   \
+                                                                                                                                    \
+template <size_t TLength, typename TType>                                                                                           \
+inline                                                                                                                              \
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator op (const GenericVector<TLength, TType>& vec) noexcept            \
+{                                                                                                                                   \
+    typename Packet::Type vecComponents[TLength];                                                                       \
+                                                                                                                                    \
+    for (size_t component = 0; component < TLength; component++)                                                                    \
+    {                                                                                                                               \
+        vecComponents[component] = Packet::set1(vec[component]);                                                                    \
+    }                                                                                                                               \
+                                                                                                                                    \
+    forEachPacket([&](size_t index)                                                                                                 \
+    {                                                                                                                               \
+        for (size_t component = 0; component < TLength; component++)                                                                \
+        {                                                                                                                           \
+            TType* const data = m_streams[component].data() + index;                                                                \
+            Packet::store(data, Packet::packetOperation(Packet::load(data), vecComponents[component]));                             \
+        }                                                                                                                           \
+    });                                                                                                                             \
+                                                                                                                                    \
+    return *this;                                                                                                                   \
+}                                                                                                                                   \
+                                                                                                                                    \
+template <size_t TLength, typename TType>                                                                                           \
+inline                                                                                                                              \
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator op (const VectorBatch& other) noexcept                            \
+{                                                                                                                                   \
+    assert(other.size() == m_size);                                                                                                 \
+                                                                                                                                    \
+    forEachPacket([&](size_t index)                                                                                                 \
+    {                                                                                                                               \
+        for (size_t component = 0; component < TLength; component++)                                                                \
+        {                                                                                                                           \
+            TType* const data = m_streams[component].data() + index;                                                                \
+            Packet::store(data, Packet::packetOperation(Packet::load(data), Packet::load(other.m_streams[component].data() + index)));\
+        }                                                                                                                           \
+    });                                                                                                                             \
+                                                                                                                                    \
+    return *this;                                                                                                                   \
+}
+
+FOXMATH_VECTOR_BATCH_ASSIGNMENT_OPERATOR(+=, add)
+FOXMATH_VECTOR_BATCH_ASSIGNMENT_OPERATOR(-=, sub)
+FOXMATH_VECTOR_BATCH_ASSIGNMENT_OPERATOR(*=, mul)
+FOXMATH_VECTOR_BATCH_ASSIGNMENT_OPERATOR(/=, div)
+
+#undef FOXMATH_VECTOR_BATCH_ASSIGNMENT_OPERATOR
@@ -1,77 +1,70 @@
 ﻿#include "GE/Core/Maths/ShapeRelation/OrientedBoxOrientedBox.hpp"
-#include "GE/Core/Maths/ShapeRelation/AabbAabb.hpp"
 #include "Vector/Vector.hpp"
 
-#include <limits>
+#include <cmath>
 
 using namespace FoxMath;
 using namespace FoxMath;
 using namespace FoxMath;
 
-static void affectMinMaxValue(float& min, float& max, float value)
-{
-    min = std::min(min, value);
-    max = std::max(max, value);
-}
-
+/*Added to the absolute value of the relative rotation terms : cross axes of parallel edges are near zero and must not report a false separation*/
+static constexpr float parallelEpsilon = 1e-6f;
 
-static bool isSATFoundedOnAxe(const OrientedBox& box1, const OrientedBox& box2, const Vec3& axe)
+bool OrientedBoxOrientedBox::isBothOrientedBoxCollided(const OrientedBox& box1, const OrientedBox& box2)
 {
-    float minBox1 = std::numeric_limits<float>::max(), maxBox1 = std::numeric_limits<float>::min(), minBox2 = std::numeric_limits<float>::max(), maxBox2 = std::numeric_limits<float>::min();
+    const Referential& referential1 = box1.getReferential();
+    const Referential& referential2 = box2.getReferential();
+    const Vec3 axes1[3] = {referential1.unitI, referential1.unitJ, referential1.unitK};
+    const Vec3 axes2[3] = {referential2.unitI, referential2.unitJ, referential2.unitK};
+    const float a[3] = {box1.getExtI(), box1.getExtJ(), box1.getExtK()};
+    const float b[3] = {box2.getExtI(), box2.getExtJ(), box2.getExtK()};
 
-    affectMinMaxValue(minBox1, maxBox1, Vec3::dot(axe, box1.ptForwardTopLeft()));
-    affectMinMaxValue(minBox1, maxBox1, Vec3::dot(axe, box1.ptForwardTopRight()));
-    affectMinMaxValue(minBox1, maxBox1, Vec3::dot(axe, box1.ptForwardBottomLeft()));
-    affectMinMaxValue(minBox1, maxBox1, Vec3::dot(axe, box1.ptForwardBottomRight()));
-    affectMinMaxValue(minBox1, maxBox1, Vec3::dot(axe, box1.ptBackTopLeft()));
-    affectMinMaxValue(minBox1, maxBox1, Vec3::dot(axe, box1.ptBackTopRight()));
-    affectMinMaxValue(minBox1, maxBox1, Vec3::dot(axe, box1.ptBackBottomLeft()));
-    affectMinMaxValue(minBox1, maxBox1, Vec3::dot(axe, box1.ptBackBottomRight()));
+    /*Rotation of box2 in the frame of box1 and its absolute value, computed once for the 15 axes*/
+    float R[3][3];
+    float absR[3][3];
 
-    affectMinMaxValue(minBox2, maxBox2, Vec3::dot(axe, box2.ptForwardTopLeft()));
-    affectMinMaxValue(minBox2, maxBox2, Vec3::dot(axe, box2.ptForwardTopRight()));
-    affectMinMaxValue(minBox2, maxBox2, Vec3::dot(axe, box2.ptForwardBottomLeft()));
-    affectMinMaxValue(minBox2, maxBox2, Vec3::dot(axe, box2.ptForwardBottomRight()));
-    affectMinMaxValue(minBox2, maxBox2, Vec3::dot(axe, box2.ptBackTopLeft()));
-    affectMinMaxValue(minBox2, maxBox2, Vec3::dot(axe, box2.ptBackTopRight()));
-    affectMinMaxValue(minBox2, maxBox2, Vec3::dot(axe, box2.ptBackBottomLeft()));
-    affectMinMaxValue(minBox2, maxBox2, Vec3::dot(axe, box2.ptBackBottomRight()));
+    for (size_t i = 0; i < 3; ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            R[i][j]    = Vec3::dot(axes1[i], axes2[j]);
+            absR[i][j] = std::abs(R[i][j]) + parallelEpsilon;
+        }
+    }
 
-    //try seg1 on seg2 or seg2 on seg1
-    return ((minBox2 <= maxBox1 && minBox2 >= minBox1) ||
-            (maxBox2 <= maxBox1 && maxBox2 >= minBox1)) ||
-            ((minBox1 <= maxBox2 && minBox1 >= minBox2) ||
-            (maxBox1 <= maxBox2 && maxBox1 >= minBox2));
-}
+    /*Translation in the frame of box1*/
+    const Vec3  translation = referential2.origin - referential1.origin;
+    const float t[3] = {Vec3::dot(translation, axes1[0]), Vec3::dot(translation, axes1[1]), Vec3::dot(translation, axes1[2])};
 
-bool OrientedBoxOrientedBox::isBothOrientedBoxCollided(const OrientedBox& box1, const OrientedBox& box2)
-{
-    /*Exclude the majority case of no collision*/
-    if (!AabbAabb::isBothAABBCollided(box1.getAABB(), box2.getAABB()))
+    /*Face axes of box1*/
+    for (size_t i = 0; i < 3; ++i)
     {
-        return false;
+        if (std::abs(t[i]) > a[i] + b[0] * absR[i][0] + b[1] * absR[i][1] + b[2] * absR[i][2])
+            return false;
     }
 
-    /*Use SAT to know if collision existe*/
-    if (!isSATFoundedOnAxe(box1, box2, box1.getReferential().unitI)) return false;
-    if (!isSATFoundedOnAxe(box1, box2, box1.getReferential().unitJ)) return false;
-    if (!isSATFoundedOnAxe(box1, box2, box1.getReferential().unitK)) return false;
-
-    if (!isSATFoundedOnAxe(box1, box2, box2.getReferential().unitI)) return false;
-    if (!isSATFoundedOnAxe(box1, box2, box2.getReferential().unitJ)) return false;
-    if (!isSATFoundedOnAxe(box1, box2, box2.getReferential().unitK)) return false;
+    /*Face axes of box2*/
+    for (size_t j = 0; j < 3; ++j)
+    {
+        if (std::abs(t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j]) > a[0] * absR[0][j] + a[1] * absR[1][j] + a[2] * absR[2][j] + b[j])
+            return false;
+    }
 
-    if (!isSATFoundedOnAxe(box1, box2, Vec3::cross(box1.getReferential().unitI, box2.getReferential().unitI))) return false;
-    if (!isSATFoundedOnAxe(box1, box2, Vec3::cross(box1.getReferential().unitI, box2.getReferential().unitJ))) return false;
-    if (!isSATFoundedOnAxe(box1, box2, Vec3::cross(box1.getReferential().unitI, box2.getReferential().unitK))) return false;
+    /*Cross products of axis i of box1 and axis j of box2*/
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const size_t i1 = (i + 1) % 3;
+        const size_t i2 = (i + 2) % 3;
 
-    if (!isSATFoundedOnAxe(box1, box2, Vec3::cross(box1.getReferential().unitJ, box2.getReferential().unitI))) return false;
-    if (!isSATFoundedOnAxe(box1, box2, Vec3::cross(box1.getReferential().unitJ, box2.getReferential().unitJ))) return false;
-    if (!isSATFoundedOnAxe(box1, box2, Vec3::cross(box1.getReferential().unitJ, box2.getReferential().unitK))) return false;
+        for (size_t j = 0; j < 3; ++j)
+        {
+            const size_t j1 = (j + 1) % 3;
+            const size_t j2 = (j + 2) % 3;
 
-    if (!isSATFoundedOnAxe(box1, box2, Vec3::cross(box1.getReferential().unitK, box2.getReferential().unitI))) return false;
-    if (!isSATFoundedOnAxe(box1, box2, Vec3::cross(box1.getReferential().unitK, box2.getReferential().unitJ))) return false;
-    if (!isSATFoundedOnAxe(box1, box2, Vec3::cross(box1.getReferential().unitK, box2.getReferential().unitK))) return false;
+            if (std::abs(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > a[i1] * absR[i2][j] + a[i2] * absR[i1][j] + b[j1] * absR[i][j2] + b[j2] * absR[i][j1])
+                return false;
+        }
+    }
 
     return true;
 }
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include <cmath>    /* std::abs */
+#include <iostream> /* std::cout */
+#include <limits>   /* std::numeric_limits */
+#include <random>   /* std::mt19937 */
+#include <vector>   /* std::vector */
+
+#include "Collision/DynamicAABBTree.hpp"
+#include "Collision/NarrowPhaseTests.hpp"
+#include "Collision/SweepAndPrune.hpp"
+#include "Matrix/Matrix4.hpp"
+#include "Matrix/Space/Transform.hpp"
+#include "Vector/DynamicVectorView.hpp"
+#include "Vector/GenericLengthedVector.hpp"
+
+using namespace FoxMath;
+
+static int failureCount = 0;
+
+#define CHECK(condition)                                                                        \
+  do                                                                                            \
+  {                                                                                             \
+    if (!(condition))                                                                           \
+    {                                                                                           \
+      std::cout << __FILE__ << ":" << __LINE__ << " : CHECK(" #condition ") failed" << std::endl; \
+      ++failureCount;                                                                           \
+    }                                                                                           \
+  } while (0)
+
+/*A box with an infinite max on the sweep axis (ground, half space) pass the sweep test of the padding boxes*/
+static void testSweepAndPruneUnboundedBox()
+{
+  constexpr float infinity = std::numeric_limits<float>::infinity();
+
+  for (size_t sweepAxis = 0; sweepAxis < 3; sweepAxis++)
+  {
+    SweepAndPrune<float> broadPhase (sweepAxis);
+
+    BoundingBox3<float> unbounded;
+    unbounded.min = Vector3<float>(-infinity, -infinity, -infinity);
+    unbounded.max = Vector3<float>(infinity, infinity, infinity);
+
+    /*Odd count so the last packet is partial for every lane width*/
+    constexpr size_t boxCount = 13;
+    for (size_t i = 0; i < boxCount; i++)
+    {
+      const float offset = static_cast<float>(i) * 4.f;
+      broadPhase.insert(BoundingBox3<float>::createFromCenterExtents(Vector3<float>(offset, offset, offset), 1.f, 1.f, 1.f), i);
+    }
+    const size_t unboundedProxy = broadPhase.insert(unbounded, boxCount);
+
+    std::vector<SweepAndPrune<float>::Pair> addedPairs;
+    std::vector<SweepAndPrune<float>::Pair> removedPairs;
+    broadPhase.update(addedPairs, removedPairs);
+
+    /*Only the unbounded box overlap the other ones*/
+    CHECK(addedPairs.size() == boxCount);
+    CHECK(removedPairs.empty());
+
+    for (const SweepAndPrune<float>::Pair& pair : addedPairs)
+    {
+      CHECK(pair.first < pair.second);
+      CHECK(pair.first == unboundedProxy || pair.second == unboundedProxy);
+    }
+  }
+}
+
+/*Query must visit every overlapping proxy whatever the height of the tree*/
+static void testDynamicAABBTreeQuery()
+{
+  std::mt19937 generator (7);
+  std::uniform_real_distribution<float> position (0.f, 64.f);
+  std::uniform_real_distribution<float> extent (0.1f, 2.f);
+
+  DynamicAABBTree<float> tree;
+  std::vector<size_t> proxies;
+
+  for (size_t i = 0; i < 2048; i++)
+  {
+    proxies.push_back(tree.insert(BoundingBox3<float>::createFromCenterExtents(Vector3<float>(position(generator), position(generator), position(generator)),
+                                                                              extent(generator), extent(generator), extent(generator)), i));
+  }
+
+  for (size_t i = 0; i < 64; i++)
+  {
+    const BoundingBox3<float> box = BoundingBox3<float>::createFromCenterExtents(Vector3<float>(position(generator), position(generator), position(generator)), 4.f, 4.f, 4.f);
+
+    size_t expectedCount = 0;
+    for (size_t proxy : proxies)
+      expectedCount += tree.getFatBox(proxy).overlaps(box);
+
+    size_t count = 0;
+    tree.query(box, [&](size_t proxy)
+    {
+      count += tree.getFatBox(proxy).overlaps(box);
+      return true;
+    });
+
+    CHECK(count == expectedCount);
+  }
+}
+
+/*Writes through a view must dirty the cached length of a lengthed vector*/
+static void testDynamicVectorViewLengthedVector()
+{
+  GenericLengthedVector<3, float> vec;
+  vec.getData() = {3.f, 4.f, 0.f};
+  CHECK(vec.length() == 5.f);
+
+  DynamicVectorView<float> view (vec);
+  view *= 2.f;
+  CHECK(vec.length() == 10.f);
+
+  DynamicVectorView<float> (vec).fill(0.f);
+  CHECK(vec.length() == 0.f);
+}
+
+/*A matrix and its equivalent transform must give the same decomposition, null scales included*/
+static void testMatrix4TransformDecomposition()
+{
+  const Vector3<float> scales[] = {Vector3<float>(1.f, 2.f, 3.f), Vector3<float>(-2.f, 1.f, 0.5f),
+                                   Vector3<float>(2.f, 0.f, 3.f), Vector3<float>(0.f, 0.f, 3.f)};
+
+  for (const Vector3<float>& scale : scales)
+  {
+    const Matrix4<float> matrix = Matrix4<float>::createTRSMatrix(Vector3<float>(1.f, -2.f, 3.f), Vector3<float>(0.3f, -1.2f, 2.f), scale);
+    const TRSDecomposition<float> matrixDecomposition = matrix.decomposeTRS();
+
+    Vector3<float> translation;
+    Matrix3<float> rotation;
+    Vector3<float> transformScale;
+    const bool isDecomposed = Transform<float>(matrix).decompose(translation, rotation, transformScale);
+    CHECK(isDecomposed == (scale[0] != 0.f || scale[1] != 0.f));
+
+    const Matrix3<float> matrixRotation = matrixDecomposition.rotation.getRotationMatrix();
+    for (size_t i = 0; i < 3; i++)
+    {
+      CHECK(std::abs(matrixDecomposition.translation[i] - translation[i]) < 1e-5f);
+      CHECK(std::abs(matrixDecomposition.scale[i] - transformScale[i]) < 1e-5f);
+
+      for (size_t j = 0; j < 3; j++)
+        CHECK(std::abs(matrixRotation.getData(i, j) - rotation.getData(i, j)) < 1e-5f);
+    }
+  }
+}
+
+/*Oriented boxes separated or pushed apart along the axis of smallest penetration*/
+static void testNarrowPhaseOrientedBoxes()
+{
+  const float halfSqrt2 = std::sqrt(0.5f);
+  const OrientedBox3<float> box1 {Vector3<float>(0.f, 0.f, 0.f), {Vector3<float>(1.f, 0.f, 0.f), Vector3<float>(0.f, 1.f, 0.f), Vector3<float>(0.f, 0.f, 1.f)},
+                                  Vector3<float>(1.f, 1.f, 1.f)};
+
+  /*Box rotated by 45 degrees around z : its corner reach x = center - sqrt(2)*/
+  OrientedBox3<float> box2 {Vector3<float>(2.2f, 0.f, 0.f), {Vector3<float>(halfSqrt2, halfSqrt2, 0.f), Vector3<float>(-halfSqrt2, halfSqrt2, 0.f), Vector3<float>(0.f, 0.f, 1.f)},
+                            Vector3<float>(1.f, 1.f, 1.f)};
+
+  Contact<float> contact;
+  CHECK(NarrowPhaseTests<float>::collide(box1, box2, contact));
+  CHECK(std::abs(contact.penetration - (2.f + std::sqrt(2.f) - 2.2f - 1.f)) < 1e-4f);
+  CHECK(std::abs(contact.normal[0] - 1.f) < 1e-4f);
+  CHECK(std::abs(contact.point[0] - (1.f - contact.penetration / 2.f)) < 1e-4f);
+
+  box2.center = Vector3<float>(2.5f, 0.f, 0.f);
+  CHECK(!NarrowPhaseTests<float>::collide(box1, box2, contact));
+
+  /*Swapped boxes : the normal still points from the first box to the second one*/
+  box2.center = Vector3<float>(-2.2f, 0.f, 0.f);
+  CHECK(NarrowPhaseTests<float>::collide(box2, box1, contact));
+  CHECK(std::abs(contact.normal[0] - 1.f) < 1e-4f);
+}
+
+int main() 
+{
+  testDynamicAABBTreeQuery();
+  testSweepAndPruneUnboundedBox();
+  testDynamicVectorViewLengthedVector();
+  testMatrix4TransformDecomposition();
+  testNarrowPhaseOrientedBoxes();
+
+  if (failureCount != 0)
+  {
+    std::cout << failureCount << " check(s) failed" << std::endl;
+    return 1;
+  }
+
+  std::cout << "All checks passed" << std::endl;
+  return 0;
+}